@@ -551,7 +551,10 @@ class LauncherConfig(Loggable):
                                help="Redirect logs to stdout.")
         dir_group.add_argument("-j", "--jobs", dest="num_jobs",
                                help="Number of tests to execute simultaneously"
-                               " (Defaults to the number of cores of the processor)",
+                               " (Defaults to the number of cores of the processor)."
+                               " Each test runs in its own process; tests declared"
+                               " not parallel-safe by the testsuite are run one at"
+                               " a time once the parallel ones are done.",
                                type=_positive_integer_type)
         dir_group.add_argument("--ignore-numfailures", dest="ignore_numfailures",
                                help="Ignore the number of failed test in exit code",
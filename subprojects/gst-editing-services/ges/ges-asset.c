@@ -117,6 +117,17 @@
  * to take its place once it is removed. You can add a proxy to an asset,
  * or set its default, using ges_asset_set_proxy(), and you can remove
  * them with ges_asset_unproxy().
+ *
+ * A typical proxy workflow for an editing application is to transcode
+ * the original media into one or more edit-friendly versions (say, a
+ * lower resolution all-intra encoding) in the background, for example
+ * with #GstTranscoder, and register the result with
+ * ges_asset_set_proxy() once it is ready. From then on, extracting the
+ * original asset gives objects backed by the proxy, which keeps
+ * timeline preview and scrubbing cheap. At render time the application
+ * removes the proxies with ges_asset_unproxy() and points the existing
+ * clips back at the full quality media with ges_extractable_set_asset(),
+ * without re-creating the timeline.
  */
 #ifdef HAVE_CONFIG_H
 #include "config.h"
@@ -2512,18 +2512,22 @@ _is_ready_to_restart_task (NleComposition * comp, GstEvent * event)
 
 
   if (comp->priv->seqnum_to_restart_task == seqnum) {
-    gchar *name = g_strdup_printf ("%s-new-stack__%" GST_TIME_FORMAT "--%"
-        GST_TIME_FORMAT "", GST_OBJECT_NAME (comp),
-        GST_TIME_ARGS (comp->priv->current_stack_start),
-        GST_TIME_ARGS (comp->priv->current_stack_stop));
-
     GST_INFO_OBJECT (comp, "Got %s with proper seqnum"
         " done with stack reconfiguration %" GST_PTR_FORMAT,
         GST_EVENT_TYPE_NAME (event), event);
 
-    GST_DEBUG_BIN_TO_DOT_FILE_WITH_TS (GST_BIN (comp),
-        GST_DEBUG_GRAPH_SHOW_ALL, name);
-    g_free (name);
+    /* Don't pay for building the dump name on every stack switch when
+     * dot file dumping is not even activated */
+    if (g_getenv ("GST_DEBUG_DUMP_DOT_DIR")) {
+      gchar *name = g_strdup_printf ("%s-new-stack__%" GST_TIME_FORMAT "--%"
+          GST_TIME_FORMAT "", GST_OBJECT_NAME (comp),
+          GST_TIME_ARGS (comp->priv->current_stack_start),
+          GST_TIME_ARGS (comp->priv->current_stack_stop));
+
+      GST_DEBUG_BIN_TO_DOT_FILE_WITH_TS (GST_BIN (comp),
+          GST_DEBUG_GRAPH_SHOW_ALL, name);
+      g_free (name);
+    }
 
     if (GST_EVENT_TYPE (event) == GST_EVENT_EOS) {
       GST_INFO_OBJECT (comp, "update_pipeline DONE");
@@ -3069,10 +3073,6 @@ are_same_stacks (GNode * stack1, GNode * stack2)
     if (!(stack1->data == stack2->data))
       goto beach;
 
-    /* if they don't have the same number of children, not equal */
-    if (!(g_node_n_children (stack1) == g_node_n_children (stack2)))
-      goto beach;
-
     child1 = stack1->children;
     child2 = stack2->children;
     while (child1 && child2) {
@@ -458,6 +458,14 @@ gst_avpacket_init (AVPacket * packet, guint8 * data, guint size)
   packet->size = size;
 }
 
+static void
+gst_ffmpegauddec_unref_avbuffer (gpointer data)
+{
+  AVBufferRef *buf = data;
+
+  av_buffer_unref (&buf);
+}
+
 /*
  * Returns: whether a frame was decoded
  */
@@ -474,6 +482,7 @@ gst_ffmpegauddec_audio_frame (GstFFMpegAudDec * ffmpegdec,
     gint nsamples, channels, byte_per_sample;
     gsize output_size;
     gboolean planar;
+    AVBufferRef *avbuf = NULL;
 
     if (!gst_ffmpegauddec_negotiate (ffmpegdec, ffmpegdec->context,
             ffmpegdec->frame, FALSE)) {
@@ -498,14 +507,14 @@ gst_ffmpegauddec_audio_frame (GstFFMpegAudDec * ffmpegdec,
     /* ffmpegdec->frame->linesize[0] might contain padding, allocate only what's needed */
     output_size = nsamples * byte_per_sample * channels;
 
-    *outbuf =
-        gst_audio_decoder_allocate_output_buffer (GST_AUDIO_DECODER
-        (ffmpegdec), output_size);
-
     if (planar) {
       gint i;
       GstAudioMeta *meta;
 
+      *outbuf =
+          gst_audio_decoder_allocate_output_buffer (GST_AUDIO_DECODER
+          (ffmpegdec), output_size);
+
       meta = gst_buffer_add_audio_meta (*outbuf, &ffmpegdec->info, nsamples,
           NULL);
 
@@ -513,7 +522,17 @@ gst_ffmpegauddec_audio_frame (GstFFMpegAudDec * ffmpegdec,
         gst_buffer_fill (*outbuf, meta->offsets[i],
             ffmpegdec->frame->extended_data[i], nsamples * byte_per_sample);
       }
+    } else if (!ffmpegdec->needs_reorder && ffmpegdec->frame->buf[0] &&
+        (avbuf = av_buffer_ref (ffmpegdec->frame->buf[0]))) {
+      /* Interleaved data in the GStreamer channel order can be pushed
+       * downstream as is, wrap the refcounted AVBuffer instead of copying */
+      *outbuf = gst_buffer_new_wrapped_full (GST_MEMORY_FLAG_READONLY,
+          ffmpegdec->frame->data[0], output_size, 0, output_size,
+          avbuf, gst_ffmpegauddec_unref_avbuffer);
     } else {
+      *outbuf =
+          gst_audio_decoder_allocate_output_buffer (GST_AUDIO_DECODER
+          (ffmpegdec), output_size);
       gst_buffer_fill (*outbuf, 0, ffmpegdec->frame->data[0], output_size);
     }
 
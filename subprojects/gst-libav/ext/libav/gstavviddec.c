@@ -1577,6 +1577,9 @@ get_output_buffer (GstFFMpegVidDec * ffmpegdec, GstVideoCodecFrame * frame)
 
   GST_LOG_OBJECT (ffmpegdec, "get output buffer");
 
+  GST_CAT_DEBUG_OBJECT (GST_CAT_PERFORMANCE, ffmpegdec,
+      "Not using direct rendering, copying decoded frame into output buffer");
+
   if (!ffmpegdec->output_state)
     goto not_negotiated;
 
@@ -2168,12 +2171,10 @@ gst_ffmpegviddec_decide_allocation (GstVideoDecoder * decoder, GstQuery * query)
   GstBufferPool *pool;
   guint size, min, max;
   GstStructure *config;
-  gboolean have_pool, have_videometa, have_alignment, update_pool = FALSE;
+  gboolean have_videometa, have_alignment, update_pool = FALSE;
   GstAllocator *allocator = NULL;
   GstAllocationParams params = DEFAULT_ALLOC_PARAM;
 
-  have_pool = (gst_query_get_n_allocation_pools (query) != 0);
-
   if (!GST_VIDEO_DECODER_CLASS (parent_class)->decide_allocation (decoder,
           query))
     return FALSE;
@@ -2196,7 +2197,6 @@ gst_ffmpegviddec_decide_allocation (GstVideoDecoder * decoder, GstQuery * query)
     pool = gst_video_buffer_pool_new ();
     max = 0;
     update_pool = TRUE;
-    have_pool = FALSE;
 
     /* if there is an allocator, also drop it, as it might be the reason we
      * have this limit. Default will be used */
@@ -2206,13 +2206,29 @@ gst_ffmpegviddec_decide_allocation (GstVideoDecoder * decoder, GstQuery * query)
     }
   }
 
+  have_videometa =
+      gst_query_find_allocation_meta (query, GST_VIDEO_META_API_TYPE, NULL);
+
+  /* The decided pool is the one the decoder renders into with get_buffer2.
+   * If the proposed pool cannot satisfy ffmpeg's padding and alignment
+   * requirements (no GstVideoAlignment support), direct rendering would
+   * silently degrade to a per-frame copy. With GstVideoMeta downstream can
+   * handle any layout, so prefer our own video pool in that case */
+  if (have_videometa && gst_ffmpegviddec_can_direct_render (ffmpegdec) &&
+      !gst_buffer_pool_has_option (pool,
+          GST_BUFFER_POOL_OPTION_VIDEO_ALIGNMENT)) {
+    GST_DEBUG_OBJECT (ffmpegdec, "Downstream pool %" GST_PTR_FORMAT " does "
+        "not support video alignment, replacing it to keep direct rendering",
+        pool);
+    gst_object_unref (pool);
+    pool = gst_video_buffer_pool_new ();
+    update_pool = TRUE;
+  }
+
   config = gst_buffer_pool_get_config (pool);
   gst_buffer_pool_config_set_params (config, state->caps, size, min, max);
   gst_buffer_pool_config_set_allocator (config, allocator, &params);
 
-  have_videometa =
-      gst_query_find_allocation_meta (query, GST_VIDEO_META_API_TYPE, NULL);
-
   if (have_videometa)
     gst_buffer_pool_config_add_option (config,
         GST_BUFFER_POOL_OPTION_VIDEO_META);
@@ -2221,7 +2237,7 @@ gst_ffmpegviddec_decide_allocation (GstVideoDecoder * decoder, GstQuery * query)
       gst_buffer_pool_has_option (pool, GST_BUFFER_POOL_OPTION_VIDEO_ALIGNMENT);
 
   /* If we have videometa, we never have to copy */
-  if (have_videometa && have_pool && have_alignment &&
+  if (have_videometa && have_alignment &&
       gst_ffmpegviddec_can_direct_render (ffmpegdec)) {
     GstStructure *config_copy = gst_structure_copy (config);
 
@@ -1667,7 +1667,7 @@ gst_omx_video_dec_clean_older_frames (GstOMXVideoDec * self,
  * the pool and so reset fields such as outbuf->omx_buf->nFlags.
  * Make sure to handle them all before. */
 static GstBuffer *
-copy_frame (const GstVideoInfo * info, GstBuffer * outbuf)
+copy_frame (GstOMXVideoDec * self, const GstVideoInfo * info, GstBuffer * outbuf)
 {
   GstVideoInfo out_info, tmp_info;
   GstBuffer *tmpbuf;
@@ -1676,7 +1676,11 @@ copy_frame (const GstVideoInfo * info, GstBuffer * outbuf)
   out_info = *info;
   tmp_info = *info;
 
-  tmpbuf = gst_buffer_new_and_alloc (out_info.size);
+  /* Allocate from the negotiated downstream pool instead of doing a fresh
+   * allocation for every copied frame */
+  tmpbuf = gst_video_decoder_allocate_output_buffer (GST_VIDEO_DECODER (self));
+  if (!tmpbuf)
+    tmpbuf = gst_buffer_new_and_alloc (out_info.size);
 
   gst_video_frame_map (&out_frame, &out_info, outbuf, GST_MAP_READ);
   gst_video_frame_map (&tmp_frame, &tmp_info, tmpbuf, GST_MAP_WRITE);
@@ -1899,8 +1903,8 @@ gst_omx_video_dec_loop (GstOMXVideoDec * self)
 
       if (GST_OMX_BUFFER_POOL (self->out_port_pool)->need_copy)
         outbuf =
-            copy_frame (&GST_OMX_BUFFER_POOL (self->out_port_pool)->video_info,
-            outbuf);
+            copy_frame (self,
+            &GST_OMX_BUFFER_POOL (self->out_port_pool)->video_info, outbuf);
 
       buf = NULL;
     } else {
@@ -1949,8 +1953,8 @@ gst_omx_video_dec_loop (GstOMXVideoDec * self)
 
       if (GST_OMX_BUFFER_POOL (self->out_port_pool)->need_copy)
         outbuf =
-            copy_frame (&GST_OMX_BUFFER_POOL (self->out_port_pool)->video_info,
-            outbuf);
+            copy_frame (self,
+            &GST_OMX_BUFFER_POOL (self->out_port_pool)->video_info, outbuf);
 
       frame->output_buffer = outbuf;
 
@@ -243,6 +243,9 @@ gst_curl_http_version_get_type (void)
       {GSTCURL_HTTP_VERSION_1_1, "HTTP Version 1.1", "1.1"},
 #ifdef CURL_VERSION_HTTP2
       {GSTCURL_HTTP_VERSION_2_0, "HTTP Version 2.0", "2.0"},
+#endif
+#ifdef CURL_VERSION_HTTP3
+      {GSTCURL_HTTP_VERSION_3_0, "HTTP Version 3.0", "3.0"},
 #endif
       {0, NULL, NULL}
     };
@@ -315,6 +318,16 @@ gst_curl_http_src_class_init (GstCurlHttpSrcClass * klass)
       } else {
         goto unsupported_http_version;
       }
+#endif
+    } else if (!strcmp (http_env, "3.0")) {
+#ifdef CURL_VERSION_HTTP3
+      if (gst_curl_http_src_curl_capabilities->features & CURL_VERSION_HTTP3) {
+        pref_http_ver = GSTCURL_HTTP_VERSION_3_0;
+      } else {
+        goto unsupported_http_version;
+      }
+#else
+      goto unsupported_http_version;
 #endif
     } else {
     unsupported_http_version:
@@ -936,8 +949,7 @@ retry:
 
   if (src->state == GSTCURL_UNLOCK) {
     if (src->buffer_len > 0) {
-      g_free (src->buffer);
-      src->buffer = NULL;
+      gst_clear_buffer (&src->buffer);
       src->buffer_len = 0;
     }
     g_mutex_unlock (&src->buffer_mutex);
@@ -994,11 +1006,10 @@ retry:
 
     GST_DEBUG_OBJECT (src, "Pushing %u bytes of transfer for URI %s to pad",
         src->buffer_len, src->uri);
-    *outbuf = gst_buffer_new_allocate (NULL, src->buffer_len, NULL);
-    gst_buffer_fill (*outbuf, 0, src->buffer, src->buffer_len);
+    /* hand over the accumulated chunks as-is, no repacking */
+    *outbuf = src->buffer;
     GST_BUFFER_OFFSET (*outbuf) = basesrc->segment.position;
 
-    g_free (src->buffer);
     src->buffer = NULL;
     src->buffer_len = 0;
     src->data_received = TRUE;
@@ -1193,6 +1204,20 @@ gst_curl_http_src_create_easy_handle (GstCurlHttpSrc * s)
         }
       }
       break;
+#endif
+#ifdef CURL_VERSION_HTTP3
+    case GSTCURL_HTTP_VERSION_3_0:
+      GST_DEBUG_OBJECT (s, "Setting version as HTTP/3.0");
+      if (curl_easy_setopt (handle, CURLOPT_HTTP_VERSION,
+              CURL_HTTP_VERSION_3) != CURLE_OK) {
+        if (gst_curl_http_src_curl_capabilities->features & CURL_VERSION_HTTP3) {
+          GST_WARNING_OBJECT (s,
+              "Cannot set unsupported option CURLOPT_HTTP_VERSION");
+        } else {
+          GST_INFO_OBJECT (s, "HTTP/3 unsupported by libcurl at this time");
+        }
+      }
+      break;
 #endif
     default:
       GST_WARNING_OBJECT (s,
@@ -1497,8 +1522,7 @@ gst_curl_http_src_cleanup_instance (GstCurlHttpSrc * src)
 
   g_cond_clear (&src->buffer_cond);
 
-  g_free (src->buffer);
-  src->buffer = NULL;
+  gst_clear_buffer (&src->buffer);
 
   if (src->request_headers) {
     gst_structure_free (src->request_headers);
@@ -2063,13 +2087,15 @@ gst_curl_http_src_get_chunks (void *chunk, size_t size, size_t nmemb, void *src)
     g_mutex_unlock (&s->buffer_mutex);
     return chunk_len;
   }
-  s->buffer =
-      g_realloc (s->buffer, (s->buffer_len + chunk_len + 1) * sizeof (char));
-  if (s->buffer == NULL) {
-    GST_ERROR_OBJECT (s, "Realloc for cURL response message failed!");
-    return 0;
-  }
-  memcpy (s->buffer + s->buffer_len, chunk, chunk_len);
+  /* Copy the chunk into a GstBuffer straight away, appending it to
+   * whatever ::create() hasn't collected yet. This is the only copy the
+   * body makes on its way to the pad; curl owns @chunk so it cannot be
+   * wrapped directly. */
+  if (s->buffer)
+    s->buffer = gst_buffer_append (s->buffer,
+        gst_buffer_new_memdup (chunk, chunk_len));
+  else
+    s->buffer = gst_buffer_new_memdup (chunk, chunk_len);
   s->buffer_len += chunk_len;
   g_cond_signal (&s->buffer_cond);
   g_mutex_unlock (&s->buffer_mutex);
@@ -97,6 +97,9 @@ typedef enum
     GSTCURL_HTTP_VERSION_1_1,
 #ifdef CURL_VERSION_HTTP2
     GSTCURL_HTTP_VERSION_2_0,
+#endif
+#ifdef CURL_VERSION_HTTP3
+    GSTCURL_HTTP_VERSION_3_0,
 #endif
     GSTCURL_HTTP_NOT,           /* For future use if HTTP protocol not used! */
     GSTCURL_HTTP_VERSION_MAX
@@ -204,7 +207,7 @@ struct _GstCurlHttpSrc
   CURL *curl_handle;
   GMutex buffer_mutex;
   GCond buffer_cond;
-  gchar *buffer;
+  GstBuffer *buffer;
   guint buffer_len;
   gboolean transfer_begun;
   gboolean data_received;
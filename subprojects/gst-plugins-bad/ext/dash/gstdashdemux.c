@@ -1046,6 +1046,10 @@ gst_dash_demux_process_manifest (GstAdaptiveDemux * demux, GstBuffer * buf)
     if (gst_mpd_client_parse (dashdemux->client, manifest, mapinfo.size)) {
       if (gst_mpd_client_setup_media_presentation (dashdemux->client, 0, 0,
               NULL)) {
+        g_free (dashdemux->manifest_checksum);
+        dashdemux->manifest_checksum =
+            g_compute_checksum_for_data (G_CHECKSUM_SHA256, mapinfo.data,
+            mapinfo.size);
         ret = TRUE;
       } else {
         GST_ELEMENT_ERROR (demux, STREAM, DECODE,
@@ -1122,6 +1126,9 @@ gst_dash_demux_reset (GstAdaptiveDemux * ademux)
   demux->client = gst_mpd_client_new ();
   gst_mpd_client_set_uri_downloader (demux->client, ademux->downloader);
 
+  g_free (demux->manifest_checksum);
+  demux->manifest_checksum = NULL;
+
   demux->n_audio_streams = 0;
   demux->n_video_streams = 0;
   demux->n_subtitle_streams = 0;
@@ -2404,9 +2411,23 @@ gst_dash_demux_update_manifest_data (GstAdaptiveDemux * demux,
   GstDashDemux *dashdemux = GST_DASH_DEMUX_CAST (demux);
   GstMPDClient *new_client = NULL;
   GstMapInfo mapinfo;
+  gchar *checksum;
 
   GST_DEBUG_OBJECT (demux, "Updating manifest file from URL");
 
+  /* Live servers commonly republish a byte-identical MPD for several
+   * refresh intervals. There is nothing to transfer in that case, so skip
+   * the expensive rebuild of the manifest object model altogether. */
+  gst_buffer_map (buffer, &mapinfo, GST_MAP_READ);
+  checksum = g_compute_checksum_for_data (G_CHECKSUM_SHA256, mapinfo.data,
+      mapinfo.size);
+  gst_buffer_unmap (buffer, &mapinfo);
+  if (g_strcmp0 (checksum, dashdemux->manifest_checksum) == 0) {
+    GST_DEBUG_OBJECT (demux, "Manifest unchanged, skipping update");
+    g_free (checksum);
+    return GST_FLOW_OK;
+  }
+
   /* parse the manifest file */
   new_client = gst_mpd_client_new ();
   gst_mpd_client_set_uri_downloader (new_client, demux->downloader);
@@ -2440,6 +2461,7 @@ gst_dash_demux_update_manifest_data (GstAdaptiveDemux * demux,
         GST_DEBUG_OBJECT (demux, "Error setting up the updated manifest file");
         gst_mpd_client_free (new_client);
         gst_buffer_unmap (buffer, &mapinfo);
+        g_free (checksum);
         return GST_FLOW_EOS;
       }
     } else {
@@ -2447,6 +2469,7 @@ gst_dash_demux_update_manifest_data (GstAdaptiveDemux * demux,
         GST_DEBUG_OBJECT (demux, "Error setting up the updated manifest file");
         gst_mpd_client_free (new_client);
         gst_buffer_unmap (buffer, &mapinfo);
+        g_free (checksum);
         return GST_FLOW_EOS;
       }
     }
@@ -2455,6 +2478,7 @@ gst_dash_demux_update_manifest_data (GstAdaptiveDemux * demux,
       GST_ERROR_OBJECT (demux, "Failed to setup streams on manifest " "update");
       gst_mpd_client_free (new_client);
       gst_buffer_unmap (buffer, &mapinfo);
+      g_free (checksum);
       return GST_FLOW_ERROR;
     }
 
@@ -2482,6 +2506,7 @@ gst_dash_demux_update_manifest_data (GstAdaptiveDemux * demux,
             demux_stream->index);
         gst_mpd_client_free (new_client);
         gst_buffer_unmap (buffer, &mapinfo);
+        g_free (checksum);
         return GST_FLOW_EOS;
       }
 
@@ -2517,6 +2542,10 @@ gst_dash_demux_update_manifest_data (GstAdaptiveDemux * demux,
     gst_mpd_client_free (dashdemux->client);
     dashdemux->client = new_client;
 
+    g_free (dashdemux->manifest_checksum);
+    dashdemux->manifest_checksum = checksum;
+    checksum = NULL;
+
     GST_DEBUG_OBJECT (demux, "Manifest file successfully updated");
     if (dashdemux->clock_drift) {
       gst_dash_demux_poll_clock_drift (dashdemux);
@@ -2528,6 +2557,7 @@ gst_dash_demux_update_manifest_data (GstAdaptiveDemux * demux,
     GST_WARNING_OBJECT (demux, "Error parsing the manifest.");
     gst_mpd_client_free (new_client);
     gst_buffer_unmap (buffer, &mapinfo);
+    g_free (checksum);
     return GST_FLOW_ERROR;
   }
 
@@ -128,6 +128,8 @@ struct _GstDashDemux
   GstMPDClient *client;         /* MPD client */
   GMutex client_lock;
 
+  gchar *manifest_checksum;     /* checksum of the last parsed MPD */
+
   GstDashDemuxClockDrift *clock_drift;
 
   gboolean end_of_period;
@@ -725,26 +725,16 @@ gst_dtls_connection_process (GstDtlsConnection * self, gpointer data, gsize len,
   return flow_ret;
 }
 
-GstFlowReturn
-gst_dtls_connection_send (GstDtlsConnection * self, gconstpointer data,
-    gsize len, gsize * written, GError ** err)
+/* called with the connection lock taken */
+static GstFlowReturn
+gst_dtls_connection_send_unlocked (GstDtlsConnection * self, gconstpointer data,
+    gsize len, gsize * written, gboolean * notify_state, GError ** err)
 {
   GstFlowReturn flow_ret;
   int ret = 0;
-  gboolean notify_state = FALSE;
-
-  g_return_val_if_fail (GST_IS_DTLS_CONNECTION (self), 0);
-
-  g_return_val_if_fail (self->priv->ssl, 0);
-  g_return_val_if_fail (self->priv->bio, 0);
-
-  GST_TRACE_OBJECT (self, "locking @ send");
-  g_mutex_lock (&self->priv->mutex);
-  GST_TRACE_OBJECT (self, "locked @ send");
 
   if (self->priv->connection_state == GST_DTLS_CONNECTION_STATE_FAILED) {
     GST_ERROR_OBJECT (self, "Had a fatal error before");
-    g_mutex_unlock (&self->priv->mutex);
     if (err)
       *err =
           g_error_new_literal (GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_WRITE,
@@ -765,7 +755,7 @@ gst_dtls_connection_send (GstDtlsConnection * self, gconstpointer data,
     if (self->priv->connection_state != GST_DTLS_CONNECTION_STATE_CLOSED &&
         self->priv->connection_state != GST_DTLS_CONNECTION_STATE_FAILED) {
       self->priv->connection_state = GST_DTLS_CONNECTION_STATE_CLOSED;
-      notify_state = TRUE;
+      *notify_state = TRUE;
     }
     if (ret == 1) {
       GST_LOG_OBJECT (self, "received peer close_notify already");
@@ -776,8 +766,7 @@ gst_dtls_connection_send (GstDtlsConnection * self, gconstpointer data,
       flow_ret = GST_FLOW_OK;
     } else {
       flow_ret =
-          handle_error (self, ret, GST_RESOURCE_ERROR_WRITE, &notify_state,
-          err);
+          handle_error (self, ret, GST_RESOURCE_ERROR_WRITE, notify_state, err);
     }
   } else if (SSL_is_init_finished (self->priv->ssl)) {
     GST_DEBUG_OBJECT (self, "sending data of %" G_GSIZE_FORMAT " B", len);
@@ -786,8 +775,7 @@ gst_dtls_connection_send (GstDtlsConnection * self, gconstpointer data,
       if (written)
         *written = 0;
       flow_ret =
-          handle_error (self, ret, GST_RESOURCE_ERROR_WRITE, &notify_state,
-          err);
+          handle_error (self, ret, GST_RESOURCE_ERROR_WRITE, notify_state, err);
     } else {
       if (written)
         *written = ret;
@@ -805,6 +793,29 @@ gst_dtls_connection_send (GstDtlsConnection * self, gconstpointer data,
     flow_ret = GST_FLOW_ERROR;
   }
 
+  return flow_ret;
+}
+
+GstFlowReturn
+gst_dtls_connection_send (GstDtlsConnection * self, gconstpointer data,
+    gsize len, gsize * written, GError ** err)
+{
+  GstFlowReturn flow_ret;
+  gboolean notify_state = FALSE;
+
+  g_return_val_if_fail (GST_IS_DTLS_CONNECTION (self), 0);
+
+  g_return_val_if_fail (self->priv->ssl, 0);
+  g_return_val_if_fail (self->priv->bio, 0);
+
+  GST_TRACE_OBJECT (self, "locking @ send");
+  g_mutex_lock (&self->priv->mutex);
+  GST_TRACE_OBJECT (self, "locked @ send");
+
+  flow_ret =
+      gst_dtls_connection_send_unlocked (self, data, len, written,
+      &notify_state, err);
+
   GST_TRACE_OBJECT (self, "unlocking @ send");
   g_mutex_unlock (&self->priv->mutex);
 
@@ -816,6 +827,66 @@ gst_dtls_connection_send (GstDtlsConnection * self, gconstpointer data,
   return flow_ret;
 }
 
+GstFlowReturn
+gst_dtls_connection_send_list (GstDtlsConnection * self, GstBufferList * list,
+    gsize * written, GError ** err)
+{
+  GstFlowReturn flow_ret = GST_FLOW_OK;
+  gboolean notify_state = FALSE;
+  gsize written_total = 0;
+  guint i, n;
+
+  g_return_val_if_fail (GST_IS_DTLS_CONNECTION (self), 0);
+
+  g_return_val_if_fail (self->priv->ssl, 0);
+  g_return_val_if_fail (self->priv->bio, 0);
+
+  GST_TRACE_OBJECT (self, "locking @ send_list");
+  g_mutex_lock (&self->priv->mutex);
+  GST_TRACE_OBJECT (self, "locked @ send_list");
+
+  n = gst_buffer_list_length (list);
+  for (i = 0; i < n && flow_ret == GST_FLOW_OK; i++) {
+    GstBuffer *buffer = gst_buffer_list_get (list, i);
+    GstMapInfo map_info;
+    gsize to_write, offset = 0;
+
+    if (!gst_buffer_map (buffer, &map_info, GST_MAP_READ))
+      continue;
+
+    to_write = map_info.size;
+    while (to_write > 0 && flow_ret == GST_FLOW_OK) {
+      gsize cur_written = 0;
+
+      flow_ret =
+          gst_dtls_connection_send_unlocked (self, map_info.data + offset,
+          to_write, &cur_written, &notify_state, err);
+      if (flow_ret == GST_FLOW_OK && cur_written == 0) {
+        /* close_notify was sent before, no more data will be accepted */
+        break;
+      }
+      to_write -= cur_written;
+      offset += cur_written;
+      written_total += cur_written;
+    }
+
+    gst_buffer_unmap (buffer, &map_info);
+  }
+
+  GST_TRACE_OBJECT (self, "unlocking @ send_list");
+  g_mutex_unlock (&self->priv->mutex);
+
+  if (notify_state) {
+    g_object_notify_by_pspec (G_OBJECT (self),
+        properties[PROP_CONNECTION_STATE]);
+  }
+
+  if (written)
+    *written = written_total;
+
+  return flow_ret;
+}
+
 /*
      ######   #######  ##    ##
     ##    ## ##     ## ###   ##
@@ -151,6 +151,18 @@ GstFlowReturn gst_dtls_connection_process(GstDtlsConnection *, gpointer ptr, gsi
  */
 GstFlowReturn gst_dtls_connection_send(GstDtlsConnection *, gconstpointer ptr, gsize len, gsize *written, GError **err);
 
+/*
+ * Will encode and send all buffers of the given buffer list while only taking
+ * the connection lock once, which is considerably cheaper than calling
+ * gst_dtls_connection_send() once per buffer.
+ *
+ * Processing stops at the first buffer that does not return GST_FLOW_OK.
+ * written contains the total number of bytes consumed from the list.
+ *
+ * Returns the same flow returns as gst_dtls_connection_send().
+ */
+GstFlowReturn gst_dtls_connection_send_list(GstDtlsConnection *, GstBufferList *list, gsize *written, GError **err);
+
 G_END_DECLS
 
 #endif /* gstdtlsconnection_h */
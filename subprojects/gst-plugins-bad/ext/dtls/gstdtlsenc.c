@@ -99,6 +99,7 @@ static gboolean src_activate_mode (GstPad *, GstObject *, GstPadMode,
 static void src_task_loop (GstPad *);
 
 static GstFlowReturn sink_chain (GstPad *, GstObject *, GstBuffer *);
+static GstFlowReturn sink_chain_list (GstPad *, GstObject *, GstBufferList *);
 static gboolean sink_event (GstPad * pad, GstObject * parent, GstEvent * event);
 
 static void on_key_received (GstDtlsConnection *, gpointer key, guint cipher,
@@ -393,6 +394,7 @@ gst_dtls_enc_request_new_pad (GstElement * element,
   }
 
   gst_pad_set_chain_function (sink, GST_DEBUG_FUNCPTR (sink_chain));
+  gst_pad_set_chain_list_function (sink, GST_DEBUG_FUNCPTR (sink_chain_list));
   gst_pad_set_event_function (sink, GST_DEBUG_FUNCPTR (sink_event));
 
   ret = gst_pad_set_active (sink, TRUE);
@@ -582,6 +584,60 @@ sink_chain (GstPad * pad, GstObject * parent, GstBuffer * buffer)
   return ret;
 }
 
+static GstFlowReturn
+sink_chain_list (GstPad * pad, GstObject * parent, GstBufferList * list)
+{
+  GstDtlsEnc *self = GST_DTLS_ENC (parent);
+  GError *err = NULL;
+  gsize written = 0;
+  GstFlowReturn ret;
+
+  g_mutex_lock (&self->queue_lock);
+  if (self->src_ret != GST_FLOW_OK) {
+    if (G_UNLIKELY (self->src_ret == GST_FLOW_NOT_LINKED
+            || self->src_ret < GST_FLOW_EOS))
+      GST_ERROR_OBJECT (self, "Pushing previous data returned an error: %s",
+          gst_flow_get_name (self->src_ret));
+
+    gst_buffer_list_unref (list);
+    g_mutex_unlock (&self->queue_lock);
+    return self->src_ret;
+  }
+  g_mutex_unlock (&self->queue_lock);
+
+  /* encrypting the whole list in one go only takes the connection lock
+   * once instead of once per buffer */
+  ret = gst_dtls_connection_send_list (self->connection, list, &written, &err);
+
+  switch (ret) {
+    case GST_FLOW_OK:
+      GST_DEBUG_OBJECT (self,
+          "Wrote %" G_GSIZE_FORMAT " B of %u buffers", written,
+          gst_buffer_list_length (list));
+      break;
+    case GST_FLOW_EOS:
+      GST_INFO_OBJECT (self, "Received data after the connection was closed");
+      break;
+    case GST_FLOW_ERROR:
+      GST_WARNING_OBJECT (self, "error sending data: %s", err->message);
+      GST_ELEMENT_ERROR (self, RESOURCE, WRITE, (NULL), ("%s", err->message));
+      g_clear_error (&err);
+      break;
+    case GST_FLOW_FLUSHING:
+      GST_INFO_OBJECT (self, "Flushing");
+      break;
+    default:
+      g_assert_not_reached ();
+      break;
+  }
+
+  g_assert (err == NULL);
+
+  gst_buffer_list_unref (list);
+
+  return ret;
+}
+
 
 static gboolean
 sink_event (GstPad * pad, GstObject * parent, GstEvent * event)
@@ -1560,7 +1560,12 @@ gst_hls_demux_update_playlist (GstHLSDemux * demux, gboolean update,
   gint i;
 
 retry:
-  uri = gst_m3u8_get_uri (demux->current_variant->m3u8);
+  /* On a refresh, request a playlist delta update if the server offers
+   * them; the initial download needs the full playlist */
+  if (update)
+    uri = gst_m3u8_get_update_uri (demux->current_variant->m3u8);
+  else
+    uri = gst_m3u8_get_uri (demux->current_variant->m3u8);
   main_uri = gst_adaptive_demux_get_manifest_ref_uri (adaptive_demux);
   download =
       gst_uri_downloader_fetch_uri (adaptive_demux->downloader, uri, main_uri,
@@ -491,6 +491,7 @@ gst_m3u8_update (GstM3U8 * self, gchar * data)
   guint8 iv[16] = { 0, };
   gint64 size = -1, offset = -1;
   gint64 mediasequence;
+  gint64 skipped_segments = 0;
   GList *previous_files = NULL;
   gboolean have_mediasequence = FALSE;
   GstM3U8InitFile *last_init_file = NULL;
@@ -534,6 +535,7 @@ gst_m3u8_update (GstM3U8 * self, gchar * data)
 
   /* By default, allow caching */
   self->allowcache = TRUE;
+  self->skip_boundary = 0;
 
   duration = 0;
   title = NULL;
@@ -651,6 +653,35 @@ gst_m3u8_update (GstM3U8 * self, gchar * data)
         GST_DEBUG ("FIXME parse date");
       } else if (g_str_has_prefix (data_ext_x, "ALLOW-CACHE:")) {
         self->allowcache = g_ascii_strcasecmp (data + 19, "YES") == 0;
+      } else if (g_str_has_prefix (data_ext_x, "SERVER-CONTROL:")) {
+        gchar *v, *a;
+
+        data = data + 22;
+
+        while (data && parse_attributes (&data, &a, &v)) {
+          if (g_str_equal (a, "CAN-SKIP-UNTIL")) {
+            gdouble fval;
+
+            if (double_from_string (v, &v, &fval))
+              self->skip_boundary = fval * (gdouble) GST_SECOND;
+          }
+        }
+      } else if (g_str_has_prefix (data_ext_x, "SKIP:")) {
+        gchar *v, *a;
+
+        data = data + 12;
+
+        while (data && parse_attributes (&data, &a, &v)) {
+          if (g_str_equal (a, "SKIPPED-SEGMENTS")) {
+            if (!int64_from_string (v, &v, &skipped_segments))
+              skipped_segments = 0;
+          }
+        }
+
+        /* The skipped segments are unchanged since the previous update and
+         * are carried over from it below; sequence numbering of the parsed
+         * tail continues after them */
+        mediasequence += skipped_segments;
       } else if (g_str_has_prefix (data_ext_x, "KEY:")) {
         gchar *v, *a;
 
@@ -772,6 +803,26 @@ gst_m3u8_update (GstM3U8 * self, gchar * data)
   if (last_init_file)
     gst_m3u8_init_file_unref (last_init_file);
 
+  if (skipped_segments > 0 && previous_files) {
+    /* Playlist delta update (EXT-X-SKIP): the server omitted the oldest
+     * segments because they are unchanged since the previous update.
+     * Reuse the segment objects from the previous playlist so only the
+     * new tail had to be parsed and allocated. */
+    GstM3U8MediaFile *first =
+        self->files ? GST_M3U8_MEDIA_FILE (self->files->data) : NULL;
+    GList *l, *head = NULL;
+
+    for (l = previous_files; l; l = l->next) {
+      GstM3U8MediaFile *file = l->data;
+
+      if (first != NULL && file->sequence >= first->sequence)
+        break;
+      head = g_list_prepend (head, gst_m3u8_media_file_ref (file));
+    }
+
+    self->files = g_list_concat (g_list_reverse (head), self->files);
+  }
+
   if (previous_files) {
     gboolean consistent = TRUE;
 
@@ -1150,6 +1201,27 @@ gst_m3u8_get_uri (GstM3U8 * m3u8)
   return uri;
 }
 
+/* Returns the URI to refresh this playlist from. If the server announced
+ * support for playlist delta updates via EXT-X-SERVER-CONTROL, ask it to
+ * skip the unchanged part with the _HLS_skip delivery directive so only
+ * the new tail has to be transferred and parsed. */
+gchar *
+gst_m3u8_get_update_uri (GstM3U8 * m3u8)
+{
+  gchar *uri;
+
+  GST_M3U8_LOCK (m3u8);
+  if (m3u8->skip_boundary > 0 && strstr (m3u8->uri, "_HLS_skip=") == NULL) {
+    uri = g_strdup_printf ("%s%c_HLS_skip=YES", m3u8->uri,
+        strchr (m3u8->uri, '?') ? '&' : '?');
+  } else {
+    uri = g_strdup (m3u8->uri);
+  }
+  GST_M3U8_UNLOCK (m3u8);
+
+  return uri;
+}
+
 gboolean
 gst_m3u8_is_live (GstM3U8 * m3u8)
 {
@@ -63,6 +63,9 @@ struct _GstM3U8
   gint version;                 /* last EXT-X-VERSION */
   GstClockTime targetduration;  /* last EXT-X-TARGETDURATION */
   gboolean allowcache;          /* last EXT-X-ALLOWCACHE */
+  GstClockTime skip_boundary;   /* last EXT-X-SERVER-CONTROL CAN-SKIP-UNTIL,
+                                 * 0 if the server does not offer playlist
+                                 * delta updates */
 
   GList *files;
 
@@ -141,6 +144,8 @@ GstClockTime       gst_m3u8_get_target_duration  (GstM3U8 * m3u8);
 
 gchar *            gst_m3u8_get_uri              (GstM3U8 * m3u8);
 
+gchar *            gst_m3u8_get_update_uri       (GstM3U8 * m3u8);
+
 gboolean           gst_m3u8_is_live              (GstM3U8 * m3u8);
 
 gboolean           gst_m3u8_get_seek_range       (GstM3U8 * m3u8,
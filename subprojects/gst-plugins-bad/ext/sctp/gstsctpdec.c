@@ -424,10 +424,32 @@ gst_sctp_data_srcpad_loop (GstPad * pad)
     GstFlowReturn flow_ret;
 
     buffer = GST_BUFFER (item->object);
-    GST_DEBUG_OBJECT (pad, "Forwarding buffer %" GST_PTR_FORMAT, buffer);
-
-    flow_ret = gst_pad_push (pad, buffer);
     item->object = NULL;
+    item->destroy (item);
+
+    /* we are the only consumer of the queue, so if it is non-empty the pops
+     * below cannot block. Drain what has accumulated and push it as a single
+     * list; with small messages at high rates the per-push overhead adds up */
+    if (!gst_data_queue_is_empty (sctpdec_pad->packet_queue)) {
+      GstBufferList *list = gst_buffer_list_new ();
+
+      gst_buffer_list_add (list, buffer);
+      while (gst_buffer_list_length (list) < 32 &&
+          !gst_data_queue_is_empty (sctpdec_pad->packet_queue)) {
+        if (!gst_data_queue_pop (sctpdec_pad->packet_queue, &item))
+          break;
+        gst_buffer_list_add (list, GST_BUFFER (item->object));
+        item->object = NULL;
+        item->destroy (item);
+      }
+
+      GST_DEBUG_OBJECT (pad, "Forwarding %u buffers",
+          gst_buffer_list_length (list));
+      flow_ret = gst_pad_push_list (pad, list);
+    } else {
+      GST_DEBUG_OBJECT (pad, "Forwarding buffer %" GST_PTR_FORMAT, buffer);
+      flow_ret = gst_pad_push (pad, buffer);
+    }
 
     GST_OBJECT_LOCK (self);
     gst_flow_combiner_update_pad_flow (self->flow_combiner, pad, flow_ret);
@@ -448,8 +470,6 @@ gst_sctp_data_srcpad_loop (GstPad * pad)
       gst_data_queue_flush (sctpdec_pad->packet_queue);
       gst_pad_pause_task (pad);
     }
-
-    item->destroy (item);
   } else {
     GST_OBJECT_LOCK (self);
     gst_flow_combiner_update_pad_flow (self->flow_combiner, pad,
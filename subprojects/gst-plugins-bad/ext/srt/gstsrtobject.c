@@ -80,6 +80,8 @@ typedef struct
   gint poll_id;
   GSocketAddress *sockaddr;
   gboolean sent_headers;
+  /* negotiated SRTO_PAYLOADSIZE, cached to avoid querying it per buffer */
+  gint payload_size;
 } SRTCaller;
 
 static GstStructure *gst_srt_object_accumulate_stats (GstSRTObject * srtobject,
@@ -1411,6 +1413,8 @@ gst_srt_object_close (GstSRTObject * srtobject)
 
     srt_close (srtobject->sock);
     srtobject->sock = SRT_INVALID_SOCK;
+    /* a reconnected socket may negotiate a different payload size */
+    srtobject->payload_size = 0;
   }
 
   if (srtobject->listener_poll_id != SRT_ERROR) {
@@ -1678,7 +1682,6 @@ gst_srt_object_write_to_callers (GstSRTObject * srtobject,
     gssize len = 0;
     const guint8 *msg = mapinfo->data;
     gint sent;
-    gint payload_size, optlen = sizeof (payload_size);
 
     SRTCaller *caller = callers->data;
     callers = callers->next;
@@ -1695,14 +1698,18 @@ gst_srt_object_write_to_callers (GstSRTObject * srtobject,
       caller->sent_headers = TRUE;
     }
 
-    if (srt_getsockflag (caller->sock, SRTO_PAYLOADSIZE, &payload_size,
-            &optlen)) {
-      GST_WARNING_OBJECT (srtobject->element, "%s", srt_getlasterror_str ());
-      goto err;
+    if (caller->payload_size <= 0) {
+      gint optlen = sizeof (caller->payload_size);
+
+      if (srt_getsockflag (caller->sock, SRTO_PAYLOADSIZE,
+              &caller->payload_size, &optlen)) {
+        GST_WARNING_OBJECT (srtobject->element, "%s", srt_getlasterror_str ());
+        goto err;
+      }
     }
 
     while (len < mapinfo->size) {
-      gint rest = MIN (mapinfo->size - len, payload_size);
+      gint rest = MIN (mapinfo->size - len, caller->payload_size);
       sent = srt_sendmsg2 (caller->sock, (char *) (msg + len), rest, 0);
       if (sent < 0) {
         GST_WARNING_OBJECT (srtobject->element, "Dropping caller %d: %s",
@@ -1736,7 +1743,6 @@ gst_srt_object_write_one (GstSRTObject * srtobject,
   gssize len = 0;
   gint poll_timeout;
   const guint8 *msg = mapinfo->data;
-  gint payload_size, optlen = sizeof (payload_size);
   gboolean wait_for_connection;
 
   GST_OBJECT_LOCK (srtobject->element);
@@ -1797,13 +1803,18 @@ gst_srt_object_write_one (GstSRTObject * srtobject,
       continue;
     }
 
-    if (srt_getsockflag (wsock, SRTO_PAYLOADSIZE, &payload_size, &optlen)) {
-      GST_ELEMENT_ERROR (srtobject->element, RESOURCE, WRITE, NULL,
-          ("%s", srt_getlasterror_str ()));
-      break;
+    if (srtobject->payload_size <= 0) {
+      gint optlen = sizeof (srtobject->payload_size);
+
+      if (srt_getsockflag (wsock, SRTO_PAYLOADSIZE, &srtobject->payload_size,
+              &optlen)) {
+        GST_ELEMENT_ERROR (srtobject->element, RESOURCE, WRITE, NULL,
+            ("%s", srt_getlasterror_str ()));
+        break;
+      }
     }
 
-    rest = MIN (mapinfo->size - len, payload_size);
+    rest = MIN (mapinfo->size - len, srtobject->payload_size);
 
     sent = srt_sendmsg2 (wsock, (char *) (msg + len), rest, 0);
     if (sent < 0) {
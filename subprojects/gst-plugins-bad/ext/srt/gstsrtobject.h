@@ -55,6 +55,8 @@ struct _GstSRTObject
   SRTSOCKET                     sock;
   gint                          poll_id;
   gboolean                      sent_headers;
+  /* negotiated SRTO_PAYLOADSIZE, cached to avoid querying it per buffer */
+  gint                          payload_size;
 
   GTask                        *listener_task;
   SRTSOCKET                     listener_sock;
@@ -452,9 +452,30 @@ gst_wl_window_render (GstWlWindow * window, GstWlBuffer * buffer,
   }
 
   if (G_LIKELY (buffer)) {
+    GstVideoRegionOfInterestMeta *roi;
+    gpointer state = NULL;
+    gboolean partial_damage = FALSE;
+
     gst_wl_buffer_attach (buffer, window->video_surface_wrapper);
-    wl_surface_damage_buffer (window->video_surface_wrapper, 0, 0, G_MAXINT32,
-        G_MAXINT32);
+
+    /* an upstream element may tell us which parts of the frame actually
+     * changed by attaching "damage" typed region-of-interest metas; only
+     * post those rectangles then so the compositor repaints less. Any
+     * other (or no) meta keeps the full-surface damage */
+    while ((roi = (GstVideoRegionOfInterestMeta *)
+            gst_buffer_iterate_meta_filtered (buffer->current_gstbuffer,
+                &state, GST_VIDEO_REGION_OF_INTEREST_META_API_TYPE))) {
+      if (roi->roi_type != g_quark_from_static_string ("damage"))
+        continue;
+
+      wl_surface_damage_buffer (window->video_surface_wrapper, roi->x, roi->y,
+          roi->w, roi->h);
+      partial_damage = TRUE;
+    }
+
+    if (!partial_damage)
+      wl_surface_damage_buffer (window->video_surface_wrapper, 0, 0,
+          G_MAXINT32, G_MAXINT32);
     wl_surface_commit (window->video_surface_wrapper);
 
     if (!window->is_area_surface_mapped) {
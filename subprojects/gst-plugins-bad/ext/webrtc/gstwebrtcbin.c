@@ -852,6 +852,88 @@ _unlock_pc_thread (GMutex * lock)
   return G_SOURCE_REMOVE;
 }
 
+/* Optionally run the peerconnection main contexts of all webrtcbin
+ * instances on a small shared set of threads instead of one dedicated
+ * thread per element. Each element is still pinned to a single context,
+ * which keeps the required queue-like task ordering, but hosts with
+ * hundreds of connections no longer pay for one mostly-idle thread each.
+ * Opt-in via GST_WEBRTC_SHARED_PC_THREADS=<n> since a long-running task
+ * of one connection can then delay the others pinned to the same
+ * thread. */
+typedef struct
+{
+  GThread *thread;
+  GMainContext *context;
+  GMainLoop *loop;
+} SharedPCThread;
+
+static GMutex shared_pc_lock;
+static GCond shared_pc_cond;
+static SharedPCThread *shared_pc_threads = NULL;
+static guint shared_pc_n_threads = 0;
+static guint shared_pc_next = 0;
+
+static gpointer
+_gst_shared_pc_thread (SharedPCThread * pc)
+{
+  g_mutex_lock (&shared_pc_lock);
+  pc->context = g_main_context_new ();
+  pc->loop = g_main_loop_new (pc->context, FALSE);
+  g_cond_broadcast (&shared_pc_cond);
+  g_mutex_unlock (&shared_pc_lock);
+
+  /* runs for the remaining lifetime of the process */
+  g_main_loop_run (pc->loop);
+
+  return NULL;
+}
+
+static GMainContext *
+_get_shared_pc_context (void)
+{
+  static gsize once = 0;
+  GMainContext *ctx = NULL;
+
+  if (g_once_init_enter (&once)) {
+    const gchar *env = g_getenv ("GST_WEBRTC_SHARED_PC_THREADS");
+    guint n = 0;
+
+    if (env)
+      n = CLAMP (atoi (env), 0, 64);
+
+    if (n > 0) {
+      guint i;
+
+      shared_pc_threads = g_new0 (SharedPCThread, n);
+      g_mutex_lock (&shared_pc_lock);
+      for (i = 0; i < n; i++) {
+        gchar *name = g_strdup_printf ("webrtc-pc-%u", i);
+
+        shared_pc_threads[i].thread =
+            g_thread_new (name, (GThreadFunc) _gst_shared_pc_thread,
+            &shared_pc_threads[i]);
+        g_free (name);
+      }
+      for (i = 0; i < n; i++) {
+        while (!shared_pc_threads[i].loop)
+          g_cond_wait (&shared_pc_cond, &shared_pc_lock);
+      }
+      shared_pc_n_threads = n;
+      g_mutex_unlock (&shared_pc_lock);
+    }
+    g_once_init_leave (&once, 1);
+  }
+
+  if (shared_pc_n_threads > 0) {
+    g_mutex_lock (&shared_pc_lock);
+    ctx = g_main_context_ref (shared_pc_threads[shared_pc_next++ %
+            shared_pc_n_threads].context);
+    g_mutex_unlock (&shared_pc_lock);
+  }
+
+  return ctx;
+}
+
 static gpointer
 _gst_pc_thread (GstWebRTCBin * webrtc)
 {
@@ -885,8 +967,20 @@ _gst_pc_thread (GstWebRTCBin * webrtc)
 static void
 _start_thread (GstWebRTCBin * webrtc)
 {
+  GMainContext *shared_ctx = _get_shared_pc_context ();
   gchar *name;
 
+  if (shared_ctx) {
+    PC_LOCK (webrtc);
+    webrtc->priv->thread = NULL;
+    GST_OBJECT_LOCK (webrtc);
+    webrtc->priv->main_context = shared_ctx;
+    GST_OBJECT_UNLOCK (webrtc);
+    webrtc->priv->is_closed = FALSE;
+    PC_UNLOCK (webrtc);
+    return;
+  }
+
   PC_LOCK (webrtc);
   name = g_strdup_printf ("%s:pc", GST_OBJECT_NAME (webrtc));
   webrtc->priv->thread = g_thread_new (name, (GThreadFunc) _gst_pc_thread,
@@ -906,6 +1000,16 @@ _stop_thread (GstWebRTCBin * webrtc)
   webrtc->priv->is_closed = TRUE;
   GST_OBJECT_UNLOCK (webrtc);
 
+  if (webrtc->priv->thread == NULL) {
+    /* pinned to a shared pool context; tasks still queued there bail out
+     * via is_closed and hold their own refs on us until they have run */
+    GST_OBJECT_LOCK (webrtc);
+    g_main_context_unref (webrtc->priv->main_context);
+    webrtc->priv->main_context = NULL;
+    GST_OBJECT_UNLOCK (webrtc);
+    return;
+  }
+
   PC_LOCK (webrtc);
   g_main_loop_quit (webrtc->priv->loop);
   while (webrtc->priv->loop)
@@ -913,6 +1017,7 @@ _stop_thread (GstWebRTCBin * webrtc)
   PC_UNLOCK (webrtc);
 
   g_thread_unref (webrtc->priv->thread);
+  webrtc->priv->thread = NULL;
 }
 
 static gboolean
@@ -960,6 +1065,7 @@ _free_op (GstWebRTCBinTask * op)
     op->notify (op->data);
   if (op->promise)
     gst_promise_unref (op->promise);
+  gst_object_unref (op->webrtc);
   g_free (op);
 }
 
@@ -991,7 +1097,9 @@ gst_webrtc_bin_enqueue_task (GstWebRTCBin * webrtc, GstWebRTCBinFunc func,
   GST_OBJECT_UNLOCK (webrtc);
 
   op = g_new0 (GstWebRTCBinTask, 1);
-  op->webrtc = webrtc;
+  /* shared pool contexts outlive the element, so the queued task must
+   * keep it alive until it has run */
+  op->webrtc = gst_object_ref (webrtc);
   op->op = func;
   op->data = data;
   op->notify = notify;
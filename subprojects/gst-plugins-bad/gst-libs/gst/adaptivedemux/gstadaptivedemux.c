@@ -2254,6 +2254,46 @@ gst_adaptive_demux_stream_queue_event (GstAdaptiveDemuxStream * stream,
   stream->pending_events = g_list_append (stream->pending_events, event);
 }
 
+/* Process-wide moving average over the measured fragment bitrates of all
+ * adaptive demuxer instances. When many sessions share the same link, a
+ * freshly created stream has no measurement of its own yet and would
+ * otherwise start from scratch; with this it can start from what the other
+ * downloads in this process are currently seeing. Protected by its own
+ * lock since different demuxers each hold only their own manifest_lock. */
+static GMutex global_bitrate_lock;
+static guint64 global_fragment_bitrates[NUM_LOOKBACK_FRAGMENTS];
+static guint64 global_moving_bitrate;
+static gint global_moving_index;
+
+static void
+gst_adaptive_demux_record_global_bitrate (guint64 new_bitrate)
+{
+  gint index;
+
+  g_mutex_lock (&global_bitrate_lock);
+  index = global_moving_index % NUM_LOOKBACK_FRAGMENTS;
+  global_moving_bitrate -= global_fragment_bitrates[index];
+  global_fragment_bitrates[index] = new_bitrate;
+  global_moving_bitrate += new_bitrate;
+  global_moving_index += 1;
+  g_mutex_unlock (&global_bitrate_lock);
+}
+
+static guint64
+gst_adaptive_demux_get_global_bitrate (void)
+{
+  guint64 bitrate = 0;
+
+  g_mutex_lock (&global_bitrate_lock);
+  if (global_moving_index >= NUM_LOOKBACK_FRAGMENTS)
+    bitrate = global_moving_bitrate / NUM_LOOKBACK_FRAGMENTS;
+  else if (global_moving_index > 0)
+    bitrate = global_moving_bitrate / global_moving_index;
+  g_mutex_unlock (&global_bitrate_lock);
+
+  return bitrate;
+}
+
 /* must be called with manifest_lock taken */
 static guint64
 _update_average_bitrate (GstAdaptiveDemux * demux,
@@ -2288,6 +2328,16 @@ gst_adaptive_demux_stream_update_current_bitrate (GstAdaptiveDemux * demux,
   }
 
   fragment_bitrate = stream->last_bitrate;
+  if (fragment_bitrate == 0) {
+    /* No measurement for this stream yet, start from what the other
+     * downloads in this process are currently seeing */
+    fragment_bitrate = gst_adaptive_demux_get_global_bitrate ();
+    GST_DEBUG_OBJECT (demux,
+        "No bitrate measured yet, using process-wide estimate of %"
+        G_GUINT64_FORMAT " bps", fragment_bitrate);
+  } else {
+    gst_adaptive_demux_record_global_bitrate (fragment_bitrate);
+  }
   GST_DEBUG_OBJECT (demux, "Download bitrate is : %" G_GUINT64_FORMAT " bps",
       fragment_bitrate);
 
@@ -2209,22 +2209,9 @@ gst_h264_pps_clear (GstH264PPS * pps)
   pps->slice_group_id = NULL;
 }
 
-/**
- * gst_h264_parser_parse_slice_hdr:
- * @nalparser: a #GstH264NalParser
- * @nalu: The #GST_H264_NAL_SLICE to #GST_H264_NAL_SLICE_IDR #GstH264NalUnit to parse
- * @slice: The #GstH264SliceHdr to fill.
- * @parse_pred_weight_table: Whether to parse the pred_weight_table or not
- * @parse_dec_ref_pic_marking: Whether to parse the dec_ref_pic_marking or not
- *
- * Parses @nalu containing a coded slice, and fills @slice.
- *
- * Returns: a #GstH264ParserResult
- */
-GstH264ParserResult
-gst_h264_parser_parse_slice_hdr (GstH264NalParser * nalparser,
-    GstH264NalUnit * nalu, GstH264SliceHdr * slice,
-    gboolean parse_pred_weight_table, gboolean parse_dec_ref_pic_marking)
+static GstH264ParserResult
+gst_h264_parser_parse_slice_hdr_internal (GstH264NalParser * nalparser,
+    GstH264NalUnit * nalu, GstH264SliceHdr * slice, gboolean prefix_only)
 {
   NalReader nr;
   gint pps_id;
@@ -2325,6 +2312,11 @@ gst_h264_parser_parse_slice_hdr (GstH264NalParser * nalparser,
   slice->pic_order_cnt_bit_size = (nal_reader_get_pos (&nr) - start_pos) -
       (8 * (nal_reader_get_epb_count (&nr) - start_epb));
 
+  /* Everything needed for stream routing / splicing decisions has been read
+   * at this point, the remaining fields are only needed for decoding */
+  if (prefix_only)
+    goto done;
+
   if (pps->redundant_pic_cnt_present_flag)
     READ_UE_MAX (&nr, slice->redundant_pic_cnt, G_MAXINT8);
 
@@ -2390,6 +2382,7 @@ gst_h264_parser_parse_slice_hdr (GstH264NalParser * nalparser,
     READ_UINT16 (&nr, slice->slice_group_change_cycle, n);
   }
 
+done:
   slice->header_size = nal_reader_get_pos (&nr);
   slice->n_emulation_prevention_bytes = nal_reader_get_epb_count (&nr);
 
@@ -2400,6 +2393,54 @@ error:
   return GST_H264_PARSER_ERROR;
 }
 
+/**
+ * gst_h264_parser_parse_slice_hdr:
+ * @nalparser: a #GstH264NalParser
+ * @nalu: The #GST_H264_NAL_SLICE to #GST_H264_NAL_SLICE_IDR #GstH264NalUnit to parse
+ * @slice: The #GstH264SliceHdr to fill.
+ * @parse_pred_weight_table: Whether to parse the pred_weight_table or not
+ * @parse_dec_ref_pic_marking: Whether to parse the dec_ref_pic_marking or not
+ *
+ * Parses @nalu containing a coded slice, and fills @slice.
+ *
+ * Returns: a #GstH264ParserResult
+ */
+GstH264ParserResult
+gst_h264_parser_parse_slice_hdr (GstH264NalParser * nalparser,
+    GstH264NalUnit * nalu, GstH264SliceHdr * slice,
+    gboolean parse_pred_weight_table, gboolean parse_dec_ref_pic_marking)
+{
+  return gst_h264_parser_parse_slice_hdr_internal (nalparser, nalu, slice,
+      FALSE);
+}
+
+/**
+ * gst_h264_parser_parse_slice_hdr_prefix:
+ * @nalparser: a #GstH264NalParser
+ * @nalu: The #GST_H264_NAL_SLICE to #GST_H264_NAL_SLICE_IDR #GstH264NalUnit to parse
+ * @slice: The #GstH264SliceHdr to fill.
+ *
+ * Parses only the leading fields of @nalu containing a coded slice, up to and
+ * including the picture order count. This fills first_mb_in_slice, type,
+ * pps, frame_num, the field flags, idr_pic_id and the pic_order_cnt fields
+ * of @slice, which is all that stream routing or splicing needs, at a
+ * fraction of the cost of a full slice header parse. The remaining fields of
+ * @slice are zeroed; use gst_h264_parser_parse_slice_hdr() when the
+ * reference list modifications, prediction weights or reference picture
+ * marking are needed. slice->header_size only covers the parsed prefix.
+ *
+ * Returns: a #GstH264ParserResult
+ *
+ * Since: 1.22
+ */
+GstH264ParserResult
+gst_h264_parser_parse_slice_hdr_prefix (GstH264NalParser * nalparser,
+    GstH264NalUnit * nalu, GstH264SliceHdr * slice)
+{
+  return gst_h264_parser_parse_slice_hdr_internal (nalparser, nalu, slice,
+      TRUE);
+}
+
 /* Free MVC-specific data from subset SPS header */
 static void
 gst_h264_sps_mvc_clear (GstH264SPS * sps)
@@ -2414,21 +2414,9 @@ gst_h265_parser_parse_pps (GstH265Parser * parser,
   return res;
 }
 
-/**
- * gst_h265_parser_parse_slice_hdr:
- * @parser: a #GstH265Parser
- * @nalu: The `GST_H265_NAL_SLICE` #GstH265NalUnit to parse
- * @slice: The #GstH265SliceHdr to fill.
- *
- * Parses @data, and fills the @slice structure.
- * The resulting @slice_hdr structure shall be deallocated with
- * gst_h265_slice_hdr_free() when it is no longer needed
- *
- * Returns: a #GstH265ParserResult
- */
-GstH265ParserResult
-gst_h265_parser_parse_slice_hdr (GstH265Parser * parser,
-    GstH265NalUnit * nalu, GstH265SliceHdr * slice)
+static GstH265ParserResult
+gst_h265_parser_parse_slice_hdr_internal (GstH265Parser * parser,
+    GstH265NalUnit * nalu, GstH265SliceHdr * slice, gboolean prefix_only)
 {
   NalReader nr;
   gint pps_id;
@@ -2505,10 +2493,17 @@ gst_h265_parser_parse_slice_hdr (GstH265Parser * parser,
     if (sps->separate_colour_plane_flag == 1)
       READ_UINT8 (&nr, slice->colour_plane_id, 2);
 
-    if (!GST_H265_IS_NAL_TYPE_IDR (nalu->type)) {
+    if (!GST_H265_IS_NAL_TYPE_IDR (nalu->type))
       READ_UINT16 (&nr, slice->pic_order_cnt_lsb,
           (sps->log2_max_pic_order_cnt_lsb_minus4 + 4));
 
+    /* Everything needed for stream routing / splicing decisions has been
+     * read at this point, the remaining fields are only needed for
+     * decoding */
+    if (prefix_only)
+      goto done;
+
+    if (!GST_H265_IS_NAL_TYPE_IDR (nalu->type)) {
       READ_UINT8 (&nr, slice->short_term_ref_pic_set_sps_flag, 1);
       if (!slice->short_term_ref_pic_set_sps_flag) {
         guint pos = nal_reader_get_pos (&nr);
@@ -2675,6 +2670,11 @@ gst_h265_parser_parse_slice_hdr (GstH265Parser * parser,
       READ_UINT8 (&nr, slice->loop_filter_across_slices_enabled_flag, 1);
   }
 
+  /* Dependent slice segments carry no fields beyond this point that matter
+   * for the prefix, stop before the entry point offsets are allocated */
+  if (prefix_only)
+    goto done;
+
   if (pps->tiles_enabled_flag || pps->entropy_coding_sync_enabled_flag) {
     guint32 offset_max;
 
@@ -2715,6 +2715,7 @@ gst_h265_parser_parse_slice_hdr (GstH265Parser * parser,
       goto error;
   }
 
+done:
   slice->header_size = nal_reader_get_pos (&nr);
   slice->n_emulation_prevention_bytes = nal_reader_get_epb_count (&nr);
 
@@ -2728,6 +2729,58 @@ error:
   return GST_H265_PARSER_ERROR;
 }
 
+/**
+ * gst_h265_parser_parse_slice_hdr:
+ * @parser: a #GstH265Parser
+ * @nalu: The `GST_H265_NAL_SLICE` #GstH265NalUnit to parse
+ * @slice: The #GstH265SliceHdr to fill.
+ *
+ * Parses @data, and fills the @slice structure.
+ * The resulting @slice_hdr structure shall be deallocated with
+ * gst_h265_slice_hdr_free() when it is no longer needed
+ *
+ * Returns: a #GstH265ParserResult
+ */
+GstH265ParserResult
+gst_h265_parser_parse_slice_hdr (GstH265Parser * parser,
+    GstH265NalUnit * nalu, GstH265SliceHdr * slice)
+{
+  return gst_h265_parser_parse_slice_hdr_internal (parser, nalu, slice, FALSE);
+}
+
+/**
+ * gst_h265_parser_parse_slice_hdr_prefix:
+ * @parser: a #GstH265Parser
+ * @nalu: The `GST_H265_NAL_SLICE` #GstH265NalUnit to parse
+ * @slice: The #GstH265SliceHdr to fill.
+ *
+ * Parses only the leading fields of the slice header of @nalu, stopping
+ * after the picture order count. This fills
+ * @slice->first_slice_segment_in_pic_flag, @slice->dependent_slice_segment_flag,
+ * @slice->segment_address, @slice->pps, @slice->type and
+ * @slice->pic_order_cnt_lsb; all remaining fields are left zeroed and
+ * @slice->header_size only covers the parsed prefix.
+ *
+ * This is considerably cheaper than gst_h265_parser_parse_slice_hdr() and is
+ * sufficient for applications that only need to identify slice boundaries,
+ * picture order or slice types, for example for splicing or stream routing.
+ * Call gst_h265_parser_parse_slice_hdr() on the same NAL when the complete
+ * header is needed.
+ *
+ * The resulting @slice structure shall be deallocated with
+ * gst_h265_slice_hdr_free() when it is no longer needed.
+ *
+ * Returns: a #GstH265ParserResult
+ *
+ * Since: 1.22
+ */
+GstH265ParserResult
+gst_h265_parser_parse_slice_hdr_prefix (GstH265Parser * parser,
+    GstH265NalUnit * nalu, GstH265SliceHdr * slice)
+{
+  return gst_h265_parser_parse_slice_hdr_internal (parser, nalu, slice, TRUE);
+}
+
 static gboolean
 nal_reader_has_more_data_in_payload (NalReader * nr,
     guint32 payload_start_pos_bit, guint32 payloadSize)
@@ -150,6 +150,14 @@ struct _GstH264DecoderPrivate
   GArray *ref_pic_list0;
   GArray *ref_pic_list1;
 
+  /* Slice header fields the lists above were built from, so that
+   * rebuilding can be skipped for further slices of the same picture
+   * using identical reference list parameters */
+  gboolean ref_pic_lists_valid;
+  guint ref_pic_lists_slice_type;
+  gint ref_pic_lists_num_ref_idx_l0;
+  gint ref_pic_lists_num_ref_idx_l1;
+
   /* For delayed output */
   GstQueueArray *output_queue;
 };
@@ -2564,9 +2572,8 @@ gst_h264_decoder_decode_slice (GstH264Decoder * self)
   }
 
 beach:
-  g_array_set_size (priv->ref_pic_list0, 0);
-  g_array_set_size (priv->ref_pic_list1, 0);
-
+  /* The lists are kept around (and cleared together with the per frame
+   * lists) so that identical further slices can reuse them */
   return ret;
 }
 
@@ -3023,6 +3030,10 @@ gst_h264_decoder_prepare_ref_pic_lists (GstH264Decoder * self,
   gint i;
   GArray *dpb_array = gst_h264_dpb_get_pictures_all (priv->dpb);
 
+  /* The per slice lists were built from the previous picture's frame
+   * lists, they cannot be reused for this picture */
+  priv->ref_pic_lists_valid = FALSE;
+
   /* 8.2.4.2.1 ~ 8.2.4.2.4
    * When this process is invoked, there shall be at least one reference entry
    * that is currently marked as "used for reference"
@@ -3060,6 +3071,9 @@ gst_h264_decoder_clear_ref_pic_lists (GstH264Decoder * self)
   g_array_set_size (priv->ref_pic_list_p0, 0);
   g_array_set_size (priv->ref_pic_list_b0, 0);
   g_array_set_size (priv->ref_pic_list_b1, 0);
+  g_array_set_size (priv->ref_pic_list0, 0);
+  g_array_set_size (priv->ref_pic_list1, 0);
+  priv->ref_pic_lists_valid = FALSE;
 }
 
 static gint
@@ -3266,6 +3280,22 @@ gst_h264_decoder_modify_ref_pic_lists (GstH264Decoder * self)
 {
   GstH264DecoderPrivate *priv = self->priv;
   GstH264SliceHdr *slice_hdr = &priv->current_slice.header;
+  gboolean ret = TRUE;
+
+  /* Slices of a multi-slice picture typically use identical reference
+   * list parameters, in which case the lists built for the previous
+   * slice are still valid and rebuilding them can be skipped */
+  if (priv->ref_pic_lists_valid &&
+      !slice_hdr->ref_pic_list_modification_flag_l0 &&
+      !slice_hdr->ref_pic_list_modification_flag_l1 &&
+      slice_hdr->type % 5 == priv->ref_pic_lists_slice_type &&
+      slice_hdr->num_ref_idx_l0_active_minus1 ==
+      priv->ref_pic_lists_num_ref_idx_l0 &&
+      slice_hdr->num_ref_idx_l1_active_minus1 ==
+      priv->ref_pic_lists_num_ref_idx_l1)
+    return TRUE;
+
+  priv->ref_pic_lists_valid = FALSE;
 
   g_array_set_size (priv->ref_pic_list0, 0);
   g_array_set_size (priv->ref_pic_list1, 0);
@@ -3273,16 +3303,28 @@ gst_h264_decoder_modify_ref_pic_lists (GstH264Decoder * self)
   if (GST_H264_IS_P_SLICE (slice_hdr) || GST_H264_IS_SP_SLICE (slice_hdr)) {
     /* 8.2.4 fill reference picture list RefPicList0 for P or SP slice */
     copy_pic_list_into (priv->ref_pic_list0, priv->ref_pic_list_p0);
-    return modify_ref_pic_list (self, 0);
+    ret = modify_ref_pic_list (self, 0);
   } else if (GST_H264_IS_B_SLICE (slice_hdr)) {
     /* 8.2.4 fill reference picture list RefPicList0 and RefPicList1 for B slice */
     copy_pic_list_into (priv->ref_pic_list0, priv->ref_pic_list_b0);
     copy_pic_list_into (priv->ref_pic_list1, priv->ref_pic_list_b1);
-    return modify_ref_pic_list (self, 0)
+    ret = modify_ref_pic_list (self, 0)
         && modify_ref_pic_list (self, 1);
   }
 
-  return TRUE;
+  /* Only lists without explicit modification commands are reused, they
+   * depend solely on the slice header fields compared above */
+  if (ret && !slice_hdr->ref_pic_list_modification_flag_l0 &&
+      !slice_hdr->ref_pic_list_modification_flag_l1) {
+    priv->ref_pic_lists_valid = TRUE;
+    priv->ref_pic_lists_slice_type = slice_hdr->type % 5;
+    priv->ref_pic_lists_num_ref_idx_l0 =
+        slice_hdr->num_ref_idx_l0_active_minus1;
+    priv->ref_pic_lists_num_ref_idx_l1 =
+        slice_hdr->num_ref_idx_l1_active_minus1;
+  }
+
+  return ret;
 }
 
 /**
@@ -497,43 +497,73 @@ gst_d3d11_memory_update_size (GstMemory * mem)
 {
   GstD3D11Memory *dmem = GST_D3D11_MEMORY_CAST (mem);
   GstD3D11MemoryPrivate *priv = dmem->priv;
+  GstD3D11Allocator *alloc = GST_D3D11_ALLOCATOR (mem->allocator);
+  GstD3D11AllocatorPrivate *alloc_priv = alloc->priv;
   gsize offset[GST_VIDEO_MAX_PLANES];
   gint stride[GST_VIDEO_MAX_PLANES];
   gsize size;
   D3D11_TEXTURE2D_DESC *desc = &priv->desc;
-  gboolean ret = FALSE;
+  GstD3D11Device *probed_device;
+  guint row_pitch = 0;
+
+  /* The row pitch only depends on the device and the texture desc, so reuse
+   * the last probed value when allocating a run of identical textures instead
+   * of creating a staging texture per allocation just to query it. The
+   * staging texture is then created lazily on the first CPU map */
+  GST_OBJECT_LOCK (alloc);
+  probed_device =
+      (GstD3D11Device *) g_weak_ref_get (&alloc_priv->probed_device);
+  if (probed_device == dmem->device &&
+      alloc_priv->probed_format == desc->Format &&
+      alloc_priv->probed_width == desc->Width &&
+      alloc_priv->probed_height == desc->Height) {
+    row_pitch = alloc_priv->probed_row_pitch;
+  }
+  GST_OBJECT_UNLOCK (alloc);
+  gst_clear_object (&probed_device);
 
-  if (!priv->staging) {
-    priv->staging = gst_d3d11_allocate_staging_texture (dmem->device,
-        &priv->desc);
+  if (row_pitch == 0) {
     if (!priv->staging) {
-      GST_ERROR_OBJECT (mem->allocator, "Couldn't create staging texture");
+      priv->staging = gst_d3d11_allocate_staging_texture (dmem->device,
+          &priv->desc);
+      if (!priv->staging) {
+        GST_ERROR_OBJECT (mem->allocator, "Couldn't create staging texture");
+        return FALSE;
+      }
+
+      GST_MINI_OBJECT_FLAG_SET (mem, GST_D3D11_MEMORY_TRANSFER_NEED_DOWNLOAD);
+    }
+
+    gst_d3d11_device_lock (dmem->device);
+    if (!gst_d3d11_memory_map_cpu_access (dmem, D3D11_MAP_READ_WRITE)) {
+      GST_ERROR_OBJECT (mem->allocator, "Couldn't map staging texture");
+      gst_d3d11_device_unlock (dmem->device);
       return FALSE;
     }
 
-    GST_MINI_OBJECT_FLAG_SET (mem, GST_D3D11_MEMORY_TRANSFER_NEED_DOWNLOAD);
-  }
+    gst_d3d11_memory_unmap_cpu_access (dmem);
+    gst_d3d11_device_unlock (dmem->device);
 
-  gst_d3d11_device_lock (dmem->device);
-  if (!gst_d3d11_memory_map_cpu_access (dmem, D3D11_MAP_READ_WRITE)) {
-    GST_ERROR_OBJECT (mem->allocator, "Couldn't map staging texture");
-    return FALSE;
-  }
+    row_pitch = priv->map.RowPitch;
 
-  gst_d3d11_memory_unmap_cpu_access (dmem);
+    GST_OBJECT_LOCK (alloc);
+    g_weak_ref_set (&alloc_priv->probed_device, dmem->device);
+    alloc_priv->probed_format = desc->Format;
+    alloc_priv->probed_width = desc->Width;
+    alloc_priv->probed_height = desc->Height;
+    alloc_priv->probed_row_pitch = row_pitch;
+    GST_OBJECT_UNLOCK (alloc);
+  }
 
   if (!gst_d3d11_dxgi_format_get_size (desc->Format, desc->Width, desc->Height,
-          priv->map.RowPitch, offset, stride, &size)) {
+          row_pitch, offset, stride, &size)) {
     GST_ERROR_OBJECT (mem->allocator, "Couldn't calculate memory size");
-    goto out;
+    return FALSE;
   }
 
   mem->maxsize = mem->size = size;
-  ret = TRUE;
 
-out:
-  gst_d3d11_device_unlock (dmem->device);
-  return ret;
+  return TRUE;
 }
 
 /**
@@ -1252,6 +1282,16 @@ gst_d3d11_memory_get_processor_output_view (GstD3D11Memory * mem,
 struct _GstD3D11AllocatorPrivate
 {
   GstMemoryCopyFunction fallback_copy;
+
+  /* Cached layout of the most recently probed texture desc, so that
+   * allocating a run of identical textures (the pool allocator case)
+   * doesn't need a throw-away staging texture per allocation just to
+   * query the driver's row pitch. Protected by the allocator object lock */
+  GWeakRef probed_device;
+  DXGI_FORMAT probed_format;
+  guint probed_width;
+  guint probed_height;
+  guint probed_row_pitch;
 };
 
 #define gst_d3d11_allocator_parent_class alloc_parent_class
@@ -1264,16 +1304,30 @@ static GstMemory *gst_d3d11_allocator_alloc_internal (GstD3D11Allocator * self,
     GstD3D11Device * device, const D3D11_TEXTURE2D_DESC * desc);
 static void gst_d3d11_allocator_free (GstAllocator * allocator,
     GstMemory * mem);
+static void gst_d3d11_allocator_finalize (GObject * object);
 
 static void
 gst_d3d11_allocator_class_init (GstD3D11AllocatorClass * klass)
 {
+  GObjectClass *gobject_class = G_OBJECT_CLASS (klass);
   GstAllocatorClass *allocator_class = GST_ALLOCATOR_CLASS (klass);
 
+  gobject_class->finalize = gst_d3d11_allocator_finalize;
+
   allocator_class->alloc = gst_d3d11_allocator_dummy_alloc;
   allocator_class->free = gst_d3d11_allocator_free;
 }
 
+static void
+gst_d3d11_allocator_finalize (GObject * object)
+{
+  GstD3D11Allocator *self = GST_D3D11_ALLOCATOR (object);
+
+  g_weak_ref_clear (&self->priv->probed_device);
+
+  G_OBJECT_CLASS (alloc_parent_class)->finalize (object);
+}
+
 static GstMemory *
 gst_d3d11_memory_copy (GstMemory * mem, gssize offset, gssize size)
 {
@@ -1369,6 +1423,8 @@ gst_d3d11_allocator_init (GstD3D11Allocator * allocator)
   priv = allocator->priv = (GstD3D11AllocatorPrivate *)
       gst_d3d11_allocator_get_instance_private (allocator);
 
+  g_weak_ref_init (&priv->probed_device, NULL);
+
   alloc->mem_type = GST_D3D11_MEMORY_NAME;
   alloc->mem_map_full = gst_d3d11_memory_map_full;
   alloc->mem_unmap_full = gst_d3d11_memory_unmap_full;
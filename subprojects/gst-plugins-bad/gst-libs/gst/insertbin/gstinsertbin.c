@@ -249,6 +249,11 @@ gst_insert_bin_class_init (GstInsertBinClass * klass)
 static void
 change_data_free (struct ChangeData *data)
 {
+  /* The element may have been pre-activated without ever making it into
+   * the bin, make sure we don't drop it in a non-NULL state */
+  if (data->action == GST_INSERT_BIN_ACTION_ADD
+      && GST_OBJECT_PARENT (data->element) == NULL)
+    gst_element_set_state (data->element, GST_STATE_NULL);
   gst_object_unref (data->element);
   if (data->sibling)
     gst_object_unref (data->sibling);
@@ -370,6 +375,48 @@ is_right_direction_for_block (GstPad * pad)
   return right_direction;
 }
 
+static void
+gst_insert_bin_prepare_element (GstInsertBin * self, GstElement * element,
+    GstPad * pad)
+{
+  GstState state, pending;
+  GstCaps *caps;
+  GstPad *sinkpad;
+
+  /* Bring the element to the bin's state before the pad is blocked so that
+   * the expensive part of activation runs outside of the blocked window and
+   * the sync_state_with_parent() after linking has nothing left to do.
+   * PLAYING needs a clock and a base time which the element only gets once
+   * it is part of the bin, so stop at PAUSED here. */
+  gst_element_get_state (GST_ELEMENT_CAST (self), &state, &pending, 0);
+  if (pending != GST_STATE_VOID_PENDING)
+    state = pending;
+  if (state > GST_STATE_PAUSED)
+    state = GST_STATE_PAUSED;
+
+  if (gst_element_set_state (element, state) == GST_STATE_CHANGE_FAILURE) {
+    GST_WARNING_OBJECT (self, "Could not pre-activate element %s",
+        GST_OBJECT_NAME (element));
+    return;
+  }
+
+  /* Check the element against the caps that currently flow at the insertion
+   * point: if it does not accept them, resuming dataflow will force a full
+   * renegotiation round and glitch live streams. */
+  caps = gst_pad_get_current_caps (pad);
+  if (caps) {
+    sinkpad = get_single_pad (element, GST_PAD_SINK);
+    if (sinkpad) {
+      if (!gst_pad_query_accept_caps (sinkpad, caps))
+        GST_WARNING_OBJECT (self, "Element %s does not accept the current"
+            " caps %" GST_PTR_FORMAT ", inserting it will force a"
+            " renegotiation", GST_OBJECT_NAME (element), caps);
+      gst_object_unref (sinkpad);
+    }
+    gst_caps_unref (caps);
+  }
+}
+
 static void
 gst_insert_bin_block_pad_unlock (GstInsertBin * self)
 {
@@ -454,6 +501,10 @@ again:
     probetype = GST_PAD_PROBE_TYPE_BLOCK_UPSTREAM;
 
   GST_OBJECT_UNLOCK (self);
+
+  if (data->action == GST_INSERT_BIN_ACTION_ADD)
+    gst_insert_bin_prepare_element (self, data->element, pad);
+
   gst_pad_add_probe (pad, GST_PAD_PROBE_TYPE_IDLE | probetype, pad_blocked_cb,
       self, NULL);
   gst_object_unref (pad);
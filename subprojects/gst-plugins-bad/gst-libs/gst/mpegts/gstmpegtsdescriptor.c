@@ -867,6 +867,79 @@ gst_mpegts_find_descriptor_with_extension (GPtrArray * descriptors, guint8 tag,
   return NULL;
 }
 
+/**
+ * gst_mpegts_descriptor_iterator_init:
+ * @iter: an uninitialized #GstMpegtsDescriptorIterator
+ * @data: (transfer none): the descriptor loop to iterate
+ * @length: size of @data in bytes
+ *
+ * Initializes @iter for iterating the descriptors present in @data.
+ *
+ * @data is neither copied nor validated up-front; invalid descriptor
+ * lengths are detected while iterating.
+ *
+ * Since: 1.22
+ */
+void
+gst_mpegts_descriptor_iterator_init (GstMpegtsDescriptorIterator * iter,
+    const guint8 * data, gsize length)
+{
+  g_return_if_fail (iter != NULL);
+  g_return_if_fail (data != NULL || length == 0);
+
+  iter->data = data;
+  iter->end = data + length;
+}
+
+/**
+ * gst_mpegts_descriptor_iterator_next:
+ * @iter: a #GstMpegtsDescriptorIterator
+ * @desc: (out caller-allocates): a #GstMpegtsDescriptor to fill in
+ *
+ * Advances @iter to the next descriptor and fills in @desc with its tag,
+ * length and a pointer into the iterated data. Nothing is allocated; see
+ * #GstMpegtsDescriptorIterator for the lifetime rules of @desc.
+ *
+ * Returns: %TRUE if @desc was filled in, %FALSE when the end of the
+ * descriptor loop was reached or the remaining data does not contain a
+ * valid descriptor.
+ *
+ * Since: 1.22
+ */
+gboolean
+gst_mpegts_descriptor_iterator_next (GstMpegtsDescriptorIterator * iter,
+    GstMpegtsDescriptor * desc)
+{
+  const guint8 *data;
+
+  g_return_val_if_fail (iter != NULL, FALSE);
+  g_return_val_if_fail (desc != NULL, FALSE);
+
+  data = iter->data;
+
+  if (data == iter->end)
+    return FALSE;
+
+  if (iter->end - data < 2 || iter->end - data < 2 + data[1]) {
+    GST_WARNING ("invalid descriptor length %d with %d bytes remaining",
+        iter->end - data < 2 ? -1 : data[1], (gint) (iter->end - data));
+    iter->data = iter->end;
+    return FALSE;
+  }
+
+  memset (desc, 0, sizeof (*desc));
+  desc->data = (guint8 *) data;
+  desc->tag = data[0];
+  desc->length = data[1];
+  /* extended descriptors */
+  if (G_UNLIKELY (desc->tag == 0x7f) && desc->length > 0)
+    desc->tag_extension = data[2];
+
+  iter->data = data + 2 + desc->length;
+
+  return TRUE;
+}
+
 /* GST_MTS_DESC_REGISTRATION (0x05) */
 /**
  * gst_mpegts_descriptor_from_registration:
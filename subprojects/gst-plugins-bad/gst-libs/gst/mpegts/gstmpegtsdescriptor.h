@@ -212,6 +212,42 @@ const GstMpegtsDescriptor * gst_mpegts_find_descriptor (GPtrArray *descriptors,
 GST_MPEGTS_API
 const GstMpegtsDescriptor * gst_mpegts_find_descriptor_with_extension (GPtrArray *descriptors,
 							guint8 tag, guint8 tag_extension);
+
+typedef struct _GstMpegtsDescriptorIterator GstMpegtsDescriptorIterator;
+
+/**
+ * GstMpegtsDescriptorIterator:
+ *
+ * An iterator over a loop of descriptors in raw section data.
+ *
+ * Unlike gst_mpegts_parse_descriptors() iterating does not allocate
+ * anything: each call to gst_mpegts_descriptor_iterator_next() fills in a
+ * caller-provided #GstMpegtsDescriptor whose @data field points into the
+ * iterated memory. The filled-in descriptor is only valid for as long as
+ * the iterated data is, and must not be passed to
+ * gst_mpegts_descriptor_free(). Use g_boxed_copy() with
+ * %GST_TYPE_MPEGTS_DESCRIPTOR to materialize a heap copy when a
+ * descriptor needs to outlive the section it was found in.
+ *
+ * Since: 1.22
+ */
+struct _GstMpegtsDescriptorIterator
+{
+  /*< private >*/
+  const guint8 *data;
+  const guint8 *end;
+
+  gpointer _gst_reserved[GST_PADDING];
+};
+
+GST_MPEGTS_API
+void gst_mpegts_descriptor_iterator_init (GstMpegtsDescriptorIterator *iter,
+					  const guint8 *data, gsize length);
+
+GST_MPEGTS_API
+gboolean gst_mpegts_descriptor_iterator_next (GstMpegtsDescriptorIterator *iter,
+					      GstMpegtsDescriptor *desc);
+
 /**
  * GstMpegtsRegistrationId:
  * @GST_MTS_REGISTRATION_0: Undefined registration id
@@ -1328,6 +1328,121 @@ gst_mpegts_section_packetize (GstMpegtsSection * section, gsize * output_size)
   return section->data;
 }
 
+struct _GstMpegtsSectionCache
+{
+  /* (pid | table_id | subtable_extension | section_number) =>
+   * (version_number | crc) */
+  GHashTable *table;
+};
+
+static guint64
+_section_cache_key (const GstMpegtsSection * section)
+{
+  return ((guint64) section->pid << 32) |
+      ((guint64) section->table_id << 24) |
+      ((guint64) section->subtable_extension << 8) |
+      (guint64) section->section_number;
+}
+
+/**
+ * gst_mpegts_section_cache_new:
+ *
+ * Allocates a new empty #GstMpegtsSectionCache.
+ *
+ * Returns: (transfer full): a new #GstMpegtsSectionCache. Free with
+ * gst_mpegts_section_cache_free() when done with it.
+ *
+ * Since: 1.22
+ */
+GstMpegtsSectionCache *
+gst_mpegts_section_cache_new (void)
+{
+  GstMpegtsSectionCache *cache;
+
+  cache = g_new (GstMpegtsSectionCache, 1);
+  cache->table =
+      g_hash_table_new_full (g_int64_hash, g_int64_equal, g_free, g_free);
+
+  return cache;
+}
+
+/**
+ * gst_mpegts_section_cache_add:
+ * @cache: a #GstMpegtsSectionCache
+ * @section: (transfer none): the #GstMpegtsSection to check
+ *
+ * Checks whether @section is a retransmission of a section previously
+ * added to @cache and records it for future checks.
+ *
+ * Returns: %TRUE if @section was not seen before or changed since it was
+ * last added, %FALSE if it is a duplicate of the cached section.
+ *
+ * Since: 1.22
+ */
+gboolean
+gst_mpegts_section_cache_add (GstMpegtsSectionCache * cache,
+    GstMpegtsSection * section)
+{
+  guint64 key, value, *stored;
+
+  g_return_val_if_fail (cache != NULL, FALSE);
+  g_return_val_if_fail (section != NULL, FALSE);
+
+  /* short sections have no version number or CRC to compare */
+  if (section->short_section)
+    return TRUE;
+
+  key = _section_cache_key (section);
+  value = ((guint64) section->version_number << 32) | section->crc;
+
+  stored = g_hash_table_lookup (cache->table, &key);
+  if (stored != NULL && *stored == value)
+    return FALSE;
+
+  if (stored == NULL) {
+    g_hash_table_insert (cache->table, g_memdup2 (&key, sizeof (key)),
+        g_memdup2 (&value, sizeof (value)));
+  } else {
+    *stored = value;
+  }
+
+  return TRUE;
+}
+
+/**
+ * gst_mpegts_section_cache_clear:
+ * @cache: a #GstMpegtsSectionCache
+ *
+ * Removes all cached sections from @cache, for example after tuning to a
+ * different transport stream.
+ *
+ * Since: 1.22
+ */
+void
+gst_mpegts_section_cache_clear (GstMpegtsSectionCache * cache)
+{
+  g_return_if_fail (cache != NULL);
+
+  g_hash_table_remove_all (cache->table);
+}
+
+/**
+ * gst_mpegts_section_cache_free:
+ * @cache: (transfer full): a #GstMpegtsSectionCache
+ *
+ * Frees @cache and all cached entries.
+ *
+ * Since: 1.22
+ */
+void
+gst_mpegts_section_cache_free (GstMpegtsSectionCache * cache)
+{
+  g_return_if_fail (cache != NULL);
+
+  g_hash_table_unref (cache->table);
+  g_free (cache);
+}
+
 void
 __initialize_sections (void)
 {
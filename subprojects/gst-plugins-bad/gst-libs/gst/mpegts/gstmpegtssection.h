@@ -503,6 +503,37 @@ GstMpegtsSection *gst_mpegts_section_new (guint16 pid,
 GST_MPEGTS_API
 guint8 *gst_mpegts_section_packetize (GstMpegtsSection * section, gsize * output_size);
 
+/**
+ * GstMpegtsSectionCache:
+ *
+ * An opaque cache for detecting retransmitted sections.
+ *
+ * Tables in a transport stream are repeated continuously; applications
+ * that parse sections straight from the stream usually only care about a
+ * section the first time it is seen or when its content changed. The
+ * cache is keyed by PID, `table_id`, `subtable_extension` and
+ * `section_number`, and a section is considered a duplicate when both its
+ * `version_number` and CRC match the cached entry.
+ *
+ * Short sections carry neither a version number nor a CRC and are never
+ * reported as duplicates.
+ *
+ * Since: 1.22
+ */
+typedef struct _GstMpegtsSectionCache GstMpegtsSectionCache;
+
+GST_MPEGTS_API
+GstMpegtsSectionCache *gst_mpegts_section_cache_new (void);
+
+GST_MPEGTS_API
+gboolean gst_mpegts_section_cache_add (GstMpegtsSectionCache * cache, GstMpegtsSection * section);
+
+GST_MPEGTS_API
+void gst_mpegts_section_cache_clear (GstMpegtsSectionCache * cache);
+
+GST_MPEGTS_API
+void gst_mpegts_section_cache_free (GstMpegtsSectionCache * cache);
+
 G_END_DECLS
 
 #endif				/* GST_MPEGTS_SECTION_H */
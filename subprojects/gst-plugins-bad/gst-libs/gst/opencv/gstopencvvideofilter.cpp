@@ -138,10 +138,14 @@ gst_opencv_video_filter_transform_frame (GstVideoFilter * trans,
 
   g_return_val_if_fail (fclass->cv_trans_func != NULL, GST_FLOW_ERROR);
 
-  transform->cvImage.data = (unsigned char *) inframe->data[0];
-  transform->cvImage.datastart = (unsigned char *) inframe->data[0];
-  transform->out_cvImage.data = (unsigned char *) outframe->data[0];
-  transform->out_cvImage.datastart = (unsigned char *) outframe->data[0];
+  /* Wrap the mapped frames without copying or allocating, keeping the
+   * frame's own stride */
+  transform->cvImage = cv::Mat (transform->cvImage.size (),
+      transform->cvImage.type (), inframe->data[0],
+      GST_VIDEO_FRAME_PLANE_STRIDE (inframe, 0));
+  transform->out_cvImage = cv::Mat (transform->out_cvImage.size (),
+      transform->out_cvImage.type (), outframe->data[0],
+      GST_VIDEO_FRAME_PLANE_STRIDE (outframe, 0));
   ret = fclass->cv_trans_func (transform, inframe->buffer, transform->cvImage,
       outframe->buffer, transform->out_cvImage);
 
@@ -161,8 +165,9 @@ gst_opencv_video_filter_transform_frame_ip (GstVideoFilter * trans,
 
   g_return_val_if_fail (fclass->cv_trans_ip_func != NULL, GST_FLOW_ERROR);
 
-  transform->cvImage.data = (unsigned char *) frame->data[0];
-  transform->cvImage.datastart = (unsigned char *) frame->data[0];
+  transform->cvImage = cv::Mat (transform->cvImage.size (),
+      transform->cvImage.type (), frame->data[0],
+      GST_VIDEO_FRAME_PLANE_STRIDE (frame, 0));
 
   ret = fclass->cv_trans_ip_func (transform, frame->buffer, transform->cvImage);
 
@@ -205,8 +210,13 @@ gst_opencv_video_filter_set_info (GstVideoFilter * trans, GstCaps * incaps,
       return FALSE;
   }
 
-  transform->cvImage.create (cv::Size (in_width, in_height), in_cv_type);
-  transform->out_cvImage.create (cv::Size (out_width, out_height), out_cv_type);
+  /* Only set up headers here; the data pointers are filled in per frame
+   * from the mapped buffers, so allocating backing store for these would
+   * just waste two frames worth of memory per element */
+  transform->cvImage = cv::Mat (cv::Size (in_width, in_height), in_cv_type,
+      NULL);
+  transform->out_cvImage = cv::Mat (cv::Size (out_width, out_height),
+      out_cv_type, NULL);
 
   gst_base_transform_set_in_place (GST_BASE_TRANSFORM (transform),
       transform->in_place);
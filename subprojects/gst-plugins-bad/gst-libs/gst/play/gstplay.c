@@ -597,8 +597,9 @@ gst_play_set_playbin_video_sink (GstPlay * self)
   if (self->video_renderer != NULL)
     video_sink =
         gst_play_video_renderer_create_video_sink (self->video_renderer, self);
-  if (video_sink)
-    g_object_set (self->playbin, "video-sink", video_sink, NULL);
+  /* Also set a NULL sink so that dropping the renderer detaches the
+   * current sink again instead of keeping it around forever */
+  g_object_set (self->playbin, "video-sink", video_sink, NULL);
 }
 
 static void
@@ -690,6 +691,11 @@ gst_play_get_property (GObject * object, guint prop_id,
   GstPlay *self = GST_PLAY (object);
 
   switch (prop_id) {
+    case PROP_VIDEO_RENDERER:
+      g_mutex_lock (&self->lock);
+      g_value_set_object (value, self->video_renderer);
+      g_mutex_unlock (&self->lock);
+      break;
     case PROP_URI:
       g_mutex_lock (&self->lock);
       g_value_set_string (value, self->uri);
@@ -2665,6 +2671,51 @@ gst_play_new (GstPlayVideoRenderer * video_renderer)
   return self;
 }
 
+/**
+ * gst_play_set_video_renderer:
+ * @play: #GstPlay instance
+ * @video_renderer: (allow-none): #GstPlayVideoRenderer to use or %NULL to
+ * detach the current one
+ *
+ * Sets the video renderer to render into. This can be changed at any time,
+ * also on a prerolled or playing instance, which allows applications to keep
+ * a set of warm, prerolled #GstPlay instances around and only attach the
+ * output surface to the one that should become visible.
+ *
+ * Since: 1.22
+ */
+void
+gst_play_set_video_renderer (GstPlay * self,
+    GstPlayVideoRenderer * video_renderer)
+{
+  g_return_if_fail (GST_IS_PLAY (self));
+  g_return_if_fail (video_renderer == NULL
+      || GST_IS_PLAY_VIDEO_RENDERER (video_renderer));
+
+  g_object_set (self, "video-renderer", video_renderer, NULL);
+}
+
+/**
+ * gst_play_get_video_renderer:
+ * @play: #GstPlay instance
+ *
+ * Returns: (transfer full) (nullable): the current #GstPlayVideoRenderer or
+ * %NULL if none is set
+ *
+ * Since: 1.22
+ */
+GstPlayVideoRenderer *
+gst_play_get_video_renderer (GstPlay * self)
+{
+  GstPlayVideoRenderer *video_renderer;
+
+  g_return_val_if_fail (GST_IS_PLAY (self), NULL);
+
+  g_object_get (self, "video-renderer", &video_renderer, NULL);
+
+  return video_renderer;
+}
+
 /**
  * gst_play_get_message_bus:
  * @play: #GstPlay instance
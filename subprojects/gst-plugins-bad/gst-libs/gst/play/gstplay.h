@@ -201,6 +201,13 @@ GType        gst_play_get_type                      (void);
 GST_PLAY_API
 GstPlay *    gst_play_new                           (GstPlayVideoRenderer * video_renderer);
 
+GST_PLAY_API
+void         gst_play_set_video_renderer            (GstPlay    * play,
+                                                     GstPlayVideoRenderer * video_renderer);
+
+GST_PLAY_API
+GstPlayVideoRenderer * gst_play_get_video_renderer  (GstPlay    * play);
+
 GST_PLAY_API
 GstBus *     gst_play_get_message_bus               (GstPlay    * play);
 
@@ -63,6 +63,8 @@ enum
   PROP_PIPELINE,
   PROP_POSITION_UPDATE_INTERVAL,
   PROP_AVOID_REENCODING,
+  PROP_TRIM_START,
+  PROP_TRIM_STOP,
   PROP_LAST
 };
 
@@ -88,6 +90,10 @@ struct _GstTranscoder
   guint position_update_interval_ms;
   gint wanted_cpu_usage;
 
+  GstClockTime trim_start;
+  GstClockTime trim_stop;
+  gboolean trim_done;
+
   GstClockTime last_duration;
 
   GstTranscoderState app_state;
@@ -156,6 +162,8 @@ gst_transcoder_init (GstTranscoder * self)
   self->wanted_cpu_usage = 100;
 
   self->position_update_interval_ms = DEFAULT_POSITION_UPDATE_INTERVAL_MS;
+  self->trim_start = GST_CLOCK_TIME_NONE;
+  self->trim_stop = GST_CLOCK_TIME_NONE;
 
   GST_TRACE_OBJECT (self, "Initialized");
 }
@@ -216,6 +224,34 @@ gst_transcoder_class_init (GstTranscoderClass * klass)
       "Whether to re-encode portions of compatible video streams that lay on segment boundaries",
       DEFAULT_AVOID_REENCODING, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS);
 
+  /**
+   * GstTranscoder:trim-start:
+   *
+   * Position in the source where transcoding should start, or
+   * %GST_CLOCK_TIME_NONE to start from the beginning.
+   *
+   * Since: 1.22
+   */
+  param_specs[PROP_TRIM_START] =
+      g_param_spec_uint64 ("trim-start", "Trim start",
+      "Position in the source where transcoding starts",
+      0, G_MAXUINT64, GST_CLOCK_TIME_NONE,
+      G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS);
+
+  /**
+   * GstTranscoder:trim-stop:
+   *
+   * Position in the source where transcoding should stop, or
+   * %GST_CLOCK_TIME_NONE to transcode until the end.
+   *
+   * Since: 1.22
+   */
+  param_specs[PROP_TRIM_STOP] =
+      g_param_spec_uint64 ("trim-stop", "Trim stop",
+      "Position in the source where transcoding stops",
+      0, G_MAXUINT64, GST_CLOCK_TIME_NONE,
+      G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS);
+
   g_object_class_install_properties (gobject_class, PROP_LAST, param_specs);
 }
 
@@ -330,6 +366,16 @@ gst_transcoder_set_property (GObject * object, guint prop_id,
       g_object_set (self->transcodebin, "avoid-reencoding",
           g_value_get_boolean (value), NULL);
       break;
+    case PROP_TRIM_START:
+      GST_OBJECT_LOCK (self);
+      self->trim_start = g_value_get_uint64 (value);
+      GST_OBJECT_UNLOCK (self);
+      break;
+    case PROP_TRIM_STOP:
+      GST_OBJECT_LOCK (self);
+      self->trim_stop = g_value_get_uint64 (value);
+      GST_OBJECT_UNLOCK (self);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -399,6 +445,16 @@ gst_transcoder_get_property (GObject * object, guint prop_id,
       g_value_set_boolean (value, avoid_reencoding);
       break;
     }
+    case PROP_TRIM_START:
+      GST_OBJECT_LOCK (self);
+      g_value_set_uint64 (value, self->trim_start);
+      GST_OBJECT_UNLOCK (self);
+      break;
+    case PROP_TRIM_STOP:
+      GST_OBJECT_LOCK (self);
+      g_value_set_uint64 (value, self->trim_stop);
+      GST_OBJECT_UNLOCK (self);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -673,6 +729,39 @@ state_changed_cb (G_GNUC_UNUSED GstBus * bus, GstMessage * msg,
 
     self->current_state = new_state;
 
+    if (old_state == GST_STATE_READY && new_state == GST_STATE_PAUSED
+        && !self->trim_done) {
+      GstClockTime trim_start, trim_stop;
+
+      GST_OBJECT_LOCK (self);
+      trim_start = self->trim_start;
+      trim_stop = self->trim_stop;
+      GST_OBJECT_UNLOCK (self);
+
+      self->trim_done = TRUE;
+
+      if (GST_CLOCK_TIME_IS_VALID (trim_start)
+          || GST_CLOCK_TIME_IS_VALID (trim_stop)) {
+        GST_DEBUG_OBJECT (self, "Trimming source to %" GST_TIME_FORMAT
+            " - %" GST_TIME_FORMAT, GST_TIME_ARGS (trim_start),
+            GST_TIME_ARGS (trim_stop));
+
+        if (!gst_element_seek (self->transcodebin, 1.0, GST_FORMAT_TIME,
+                GST_SEEK_FLAG_FLUSH | GST_SEEK_FLAG_ACCURATE,
+                GST_SEEK_TYPE_SET,
+                GST_CLOCK_TIME_IS_VALID (trim_start) ? trim_start : 0,
+                GST_CLOCK_TIME_IS_VALID (trim_stop) ? GST_SEEK_TYPE_SET :
+                GST_SEEK_TYPE_NONE, trim_stop)) {
+          GError *err = g_error_new (GST_TRANSCODER_ERROR,
+              GST_TRANSCODER_ERROR_FAILED,
+              "The source does not support trimming");
+          api_bus_post_message (self, GST_TRANSCODER_MESSAGE_ERROR,
+              GST_TRANSCODER_MESSAGE_DATA_ERROR, G_TYPE_ERROR, err, NULL);
+          g_error_free (err);
+        }
+      }
+    }
+
     if (new_state == GST_STATE_PAUSED
         && pending_state == GST_STATE_VOID_PENDING) {
       remove_tick_source (self);
@@ -1027,6 +1116,7 @@ gst_transcoder_run_async (GstTranscoder * self)
   }
 
   self->target_state = GST_STATE_PLAYING;
+  self->trim_done = FALSE;
   state_ret = gst_element_set_state (self->transcodebin, GST_STATE_PLAYING);
 
   if (state_ret == GST_STATE_CHANGE_FAILURE) {
@@ -1233,6 +1323,36 @@ gst_transcoder_set_avoid_reencoding (GstTranscoder * self,
   g_object_set (self->transcodebin, "avoid-reencoding", avoid_reencoding, NULL);
 }
 
+/**
+ * gst_transcoder_set_trim:
+ * @self: The #GstTranscoder to restrict to a range of the source.
+ * @start: Position where transcoding should start, or %GST_CLOCK_TIME_NONE
+ * to start from the beginning.
+ * @stop: Position where transcoding should stop, or %GST_CLOCK_TIME_NONE
+ * to transcode until the end.
+ *
+ * Restricts transcoding to the given range of the source. The range is
+ * applied with an accurate flushing seek once the pipeline has prerolled,
+ * so the source has to be seekable. This makes it possible to split a long
+ * source into keyframe-aligned segments, transcode the segments concurrently
+ * with one #GstTranscoder each and concatenate the results afterwards.
+ *
+ * This has to be called before gst_transcoder_run() or
+ * gst_transcoder_run_async().
+ *
+ * Since: 1.22
+ */
+void
+gst_transcoder_set_trim (GstTranscoder * self, GstClockTime start,
+    GstClockTime stop)
+{
+  g_return_if_fail (GST_IS_TRANSCODER (self));
+  g_return_if_fail (!GST_CLOCK_TIME_IS_VALID (start)
+      || !GST_CLOCK_TIME_IS_VALID (stop) || start < stop);
+
+  g_object_set (self, "trim-start", start, "trim-stop", stop, NULL);
+}
+
 /**
  * gst_transcoder_error_get_name:
  * @error: a #GstTranscoderError
@@ -163,6 +163,11 @@ GST_TRANSCODER_API
 void gst_transcoder_set_avoid_reencoding                  (GstTranscoder * self,
                                                            gboolean avoid_reencoding);
 
+GST_TRANSCODER_API
+void gst_transcoder_set_trim                              (GstTranscoder * self,
+                                                           GstClockTime start,
+                                                           GstClockTime stop);
+
 #include "gsttranscoder-signal-adapter.h"
 
 GST_TRANSCODER_API
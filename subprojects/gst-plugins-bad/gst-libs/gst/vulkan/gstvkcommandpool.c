@@ -34,6 +34,10 @@
 
 #define GST_VULKAN_COMMAND_POOL_LARGE_OUTSTANDING 1024
 
+/* number of command buffers allocated in one vkAllocateCommandBuffers call
+ * when the available queue runs empty */
+#define GST_VULKAN_COMMAND_POOL_ALLOC_BATCH 4
+
 #define GET_PRIV(pool) gst_vulkan_command_pool_get_instance_private (pool)
 
 #define GST_CAT_DEFAULT gst_vulkan_command_pool_debug
@@ -121,28 +125,45 @@ gst_vulkan_command_pool_get_queue (GstVulkanCommandPool * pool)
   return pool->queue ? gst_object_ref (pool->queue) : NULL;
 }
 
+static gboolean gst_vulkan_command_pool_can_reset (GstVulkanCommandPool *
+    pool);
+
 static GstVulkanCommandBuffer *
 command_alloc (GstVulkanCommandPool * pool, GError ** error)
 {
+  GstVulkanCommandPoolPrivate *priv = GET_PRIV (pool);
   VkResult err;
   VkCommandBufferAllocateInfo cmd_info = { 0, };
   GstVulkanCommandBuffer *buf;
-  VkCommandBuffer cmd;
+  VkCommandBuffer cmd[GST_VULKAN_COMMAND_POOL_ALLOC_BATCH];
+  guint i, n_alloc;
+
+  /* allocate a batch in one driver call and keep the extra buffers for
+   * later creates. Only recyclable buffers may sit in the available
+   * queue, so allocate a single one otherwise */
+  n_alloc = gst_vulkan_command_pool_can_reset (pool) ?
+      GST_VULKAN_COMMAND_POOL_ALLOC_BATCH : 1;
 
   cmd_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
   cmd_info.pNext = NULL;
   cmd_info.commandPool = pool->pool;
   cmd_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-  cmd_info.commandBufferCount = 1;
+  cmd_info.commandBufferCount = n_alloc;
 
   gst_vulkan_command_pool_lock (pool);
-  err = vkAllocateCommandBuffers (pool->queue->device->device, &cmd_info, &cmd);
+  err = vkAllocateCommandBuffers (pool->queue->device->device, &cmd_info, cmd);
+  if (err == VK_SUCCESS) {
+    for (i = 1; i < n_alloc; i++)
+      g_queue_push_tail (priv->available,
+          gst_vulkan_command_buffer_new_wrapped (cmd[i],
+              VK_COMMAND_BUFFER_LEVEL_PRIMARY));
+  }
   gst_vulkan_command_pool_unlock (pool);
   if (gst_vulkan_error_to_g_error (err, error, "vkCreateCommandBuffer") < 0)
     return NULL;
 
   buf =
-      gst_vulkan_command_buffer_new_wrapped (cmd,
+      gst_vulkan_command_buffer_new_wrapped (cmd[0],
       VK_COMMAND_BUFFER_LEVEL_PRIMARY);
   GST_LOG_OBJECT (pool, "created cmd buffer %p", buf);
 
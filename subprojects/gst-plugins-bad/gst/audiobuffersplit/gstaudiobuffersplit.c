@@ -399,6 +399,7 @@ gst_audio_buffer_split_output (GstAudioBufferSplit * self, gboolean force,
   gint size, avail;
   GstFlowReturn ret = GST_FLOW_OK;
   GstClockTime resync_pts;
+  GstBufferList *list = NULL;
 
   resync_pts = self->resync_pts;
   size = samples_per_buffer * bpf;
@@ -462,9 +463,11 @@ gst_audio_buffer_split_output (GstAudioBufferSplit * self, gboolean force,
         GST_TIME_ARGS (GST_BUFFER_PTS (buffer)),
         GST_TIME_ARGS (GST_BUFFER_DURATION (buffer)), size / bpf);
 
-    ret = gst_pad_push (self->srcpad, buffer);
-    if (ret != GST_FLOW_OK)
-      break;
+    /* Collect all buffers of this cycle and push them in one go, one pad
+     * push per split interval adds up for small output durations */
+    if (list == NULL)
+      list = gst_buffer_list_new ();
+    gst_buffer_list_add (list, buffer);
 
     /* Update the size based on the accumulated error we have now after
      * taking out a buffer. Same code as above */
@@ -474,6 +477,18 @@ gst_audio_buffer_split_output (GstAudioBufferSplit * self, gboolean force,
       size += bpf;
   }
 
+  if (list) {
+    if (gst_buffer_list_length (list) == 1) {
+      GstBuffer *buffer = gst_buffer_list_get (list, 0);
+
+      gst_buffer_ref (buffer);
+      gst_buffer_list_unref (list);
+      ret = gst_pad_push (self->srcpad, buffer);
+    } else {
+      ret = gst_pad_push_list (self->srcpad, list);
+    }
+  }
+
   return ret;
 }
 
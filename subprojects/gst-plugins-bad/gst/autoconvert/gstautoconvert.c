@@ -82,9 +82,12 @@ enum
 enum
 {
   PROP_0,
-  PROP_FACTORIES
+  PROP_FACTORIES,
+  PROP_STANDBY_CONVERTERS
 };
 
+#define DEFAULT_STANDBY_CONVERTERS 0
+
 static void gst_auto_convert_set_property (GObject * object,
     guint prop_id, const GValue * value, GParamSpec * pspec);
 static void gst_auto_convert_get_property (GObject * object,
@@ -182,6 +185,24 @@ gst_auto_convert_class_init (GstAutoConvertClass * klass)
           " ownership of the list (NULL means it will go through all possible"
           " elements), can only be set once",
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstAutoConvert:standby-converters:
+   *
+   * Number of additional matching converter elements to instantiate and keep
+   * in the bin whenever the caps change. Standby elements are created outside
+   * of the switch itself, so a later caps change that selects one of them
+   * becomes a pure pad switch instead of an element construction in the
+   * streaming thread.
+   *
+   * Since: 1.22
+   */
+  g_object_class_install_property (gobject_class, PROP_STANDBY_CONVERTERS,
+      g_param_spec_uint ("standby-converters", "Standby converters",
+          "Number of additional matching converters to pre-instantiate "
+          "on caps changes (0 = disabled)",
+          0, G_MAXUINT, DEFAULT_STANDBY_CONVERTERS,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 }
 
 static void
@@ -259,6 +280,11 @@ gst_auto_convert_set_property (GObject * object,
             " have been set or auto-discovered");
       }
       break;
+    case PROP_STANDBY_CONVERTERS:
+      GST_AUTOCONVERT_LOCK (autoconvert);
+      autoconvert->standby_converters = g_value_get_uint (value);
+      GST_AUTOCONVERT_UNLOCK (autoconvert);
+      break;
   }
 }
 
@@ -276,6 +302,11 @@ gst_auto_convert_get_property (GObject * object,
       g_value_set_pointer (value,
           g_atomic_pointer_get (&autoconvert->factories));
       break;
+    case PROP_STANDBY_CONVERTERS:
+      GST_AUTOCONVERT_LOCK (autoconvert);
+      g_value_set_uint (value, autoconvert->standby_converters);
+      GST_AUTOCONVERT_UNLOCK (autoconvert);
+      break;
   }
 }
 
@@ -716,9 +747,15 @@ gst_auto_convert_sink_setcaps (GstAutoConvert * autoconvert, GstCaps * caps)
   GstCaps *other_caps = NULL;
   GList *factories;
   GstCaps *current_caps;
+  gboolean activated = FALSE;
+  guint standby_left;
 
   g_return_val_if_fail (autoconvert != NULL, FALSE);
 
+  GST_AUTOCONVERT_LOCK (autoconvert);
+  standby_left = autoconvert->standby_converters;
+  GST_AUTOCONVERT_UNLOCK (autoconvert);
+
   current_caps = gst_pad_get_current_caps (autoconvert->sinkpad);
   if (current_caps) {
     if (gst_caps_is_equal_fixed (caps, current_caps)) {
@@ -787,11 +824,26 @@ gst_auto_convert_sink_setcaps (GstAutoConvert * autoconvert, GstCaps * caps)
     if (!element)
       continue;
 
-    /* And make it the current child */
-    if (gst_auto_convert_activate_element (autoconvert, element, caps))
-      break;
-    else
+    if (!activated) {
+      /* And make it the current child */
+      if (gst_auto_convert_activate_element (autoconvert, element, caps)) {
+        activated = TRUE;
+        if (standby_left == 0)
+          break;
+      } else {
+        gst_object_unref (element);
+      }
+    } else {
+      /* Keep a few more matching converters instantiated and synced to our
+       * state as warm standbys, so a later caps change that selects one of
+       * them is a pure pad switch without element construction in the
+       * streaming thread */
+      GST_DEBUG_OBJECT (autoconvert, "Pre-instantiated standby element %s",
+          GST_OBJECT_NAME (element));
       gst_object_unref (element);
+      if (--standby_left == 0)
+        break;
+    }
   }
 
 get_out:
@@ -46,6 +46,8 @@ struct _GstAutoConvert
   GstPad *sinkpad;
   GstPad *srcpad;
 
+  guint standby_converters;
+
   /* Have to be set all at once
    * Protected by the object lock and the stream lock
    * Both must be held to modify these
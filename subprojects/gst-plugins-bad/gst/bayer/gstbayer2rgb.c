@@ -124,6 +124,12 @@ struct _GstBayer2RGB
   int g_off;                    /* offset for green */
   int b_off;                    /* offset for blue */
   int format;
+
+  guint n_threads;
+  GThreadPool *band_pool;
+  GMutex band_lock;
+  GCond band_cond;
+  guint bands_pending;
 };
 
 struct _GstBayer2RGBClass
@@ -139,9 +145,12 @@ struct _GstBayer2RGBClass
 
 enum
 {
-  PROP_0
+  PROP_0,
+  PROP_N_THREADS
 };
 
+#define DEFAULT_N_THREADS 1
+
 GType gst_bayer2rgb_get_type (void);
 
 #define gst_bayer2rgb_parent_class parent_class
@@ -163,6 +172,7 @@ static GstCaps *gst_bayer2rgb_transform_caps (GstBaseTransform * base,
     GstPadDirection direction, GstCaps * caps, GstCaps * filter);
 static gboolean gst_bayer2rgb_get_unit_size (GstBaseTransform * base,
     GstCaps * caps, gsize * size);
+static void gst_bayer2rgb_finalize (GObject * object);
 
 
 static void
@@ -176,6 +186,20 @@ gst_bayer2rgb_class_init (GstBayer2RGBClass * klass)
 
   gobject_class->set_property = gst_bayer2rgb_set_property;
   gobject_class->get_property = gst_bayer2rgb_get_property;
+  gobject_class->finalize = gst_bayer2rgb_finalize;
+
+  /**
+   * GstBayer2RGB:n-threads:
+   *
+   * Maximum number of threads to use for the conversion, 0 for automatic
+   *
+   * Since: 1.22
+   */
+  g_object_class_install_property (gobject_class, PROP_N_THREADS,
+      g_param_spec_uint ("n-threads", "Threads",
+          "Maximum number of threads to use for the conversion, 0 for automatic",
+          0, G_MAXUINT, DEFAULT_N_THREADS,
+          (GParamFlags) (G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
 
   gst_element_class_set_static_metadata (gstelement_class,
       "Bayer to RGB decoder for cameras", "Filter/Converter/Video",
@@ -206,16 +230,37 @@ static void
 gst_bayer2rgb_init (GstBayer2RGB * filter)
 {
   gst_bayer2rgb_reset (filter);
+  filter->n_threads = DEFAULT_N_THREADS;
+  g_mutex_init (&filter->band_lock);
+  g_cond_init (&filter->band_cond);
   gst_base_transform_set_in_place (GST_BASE_TRANSFORM (filter), TRUE);
 }
 
-/* No properties are implemented, so only a warning is produced */
+static void
+gst_bayer2rgb_finalize (GObject * object)
+{
+  GstBayer2RGB *filter = GST_BAYER2RGB (object);
+
+  if (filter->band_pool)
+    g_thread_pool_free (filter->band_pool, FALSE, TRUE);
+  g_mutex_clear (&filter->band_lock);
+  g_cond_clear (&filter->band_cond);
+
+  G_OBJECT_CLASS (parent_class)->finalize (object);
+}
+
 static void
 gst_bayer2rgb_set_property (GObject * object, guint prop_id,
     const GValue * value, GParamSpec * pspec)
 {
+  GstBayer2RGB *filter = GST_BAYER2RGB (object);
 
   switch (prop_id) {
+    case PROP_N_THREADS:
+      GST_OBJECT_LOCK (filter);
+      filter->n_threads = g_value_get_uint (value);
+      GST_OBJECT_UNLOCK (filter);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -226,8 +271,14 @@ static void
 gst_bayer2rgb_get_property (GObject * object, guint prop_id,
     GValue * value, GParamSpec * pspec)
 {
+  GstBayer2RGB *filter = GST_BAYER2RGB (object);
 
   switch (prop_id) {
+    case PROP_N_THREADS:
+      GST_OBJECT_LOCK (filter);
+      g_value_set_uint (value, filter->n_threads);
+      GST_OBJECT_UNLOCK (filter);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -384,9 +435,12 @@ typedef void (*process_func) (guint8 * d0, const guint8 * s0, const guint8 * s1,
     const guint8 * s2, const guint8 * s3, const guint8 * s4, const guint8 * s5,
     int n);
 
+/* Processes the rows [j_start, j_end) of the frame. Bands can be handled
+ * independently as long as the neighbouring source rows exist; the merge
+ * functions only ever look one row up and one row down. */
 static void
 gst_bayer2rgb_process (GstBayer2RGB * bayer2rgb, uint8_t * dest,
-    int dest_stride, uint8_t * src, int src_stride)
+    int dest_stride, uint8_t * src, int src_stride, int j_start, int j_end)
 {
   int j;
   guint8 *tmp;
@@ -429,13 +483,19 @@ gst_bayer2rgb_process (GstBayer2RGB * bayer2rgb, uint8_t * dest,
   tmp = g_malloc (2 * 4 * bayer2rgb->width);
 #define LINE(x) (tmp + ((x)&7) * bayer2rgb->width)
 
-  gst_bayer2rgb_split_and_upsample_horiz (LINE (3 * 2 + 0), LINE (3 * 2 + 1),
-      src + 1 * src_stride, bayer2rgb->width);
-  j = 0;
-  gst_bayer2rgb_split_and_upsample_horiz (LINE (j * 2 + 0), LINE (j * 2 + 1),
-      src + j * src_stride, bayer2rgb->width);
-
-  for (j = 0; j < bayer2rgb->height; j++) {
+  /* Prime the line cache with the row above the band; the frame has no row
+   * above its first one, so mirror the second row there instead */
+  if (j_start == 0)
+    gst_bayer2rgb_split_and_upsample_horiz (LINE (j_start * 2 + 6),
+        LINE (j_start * 2 + 7), src + 1 * src_stride, bayer2rgb->width);
+  else
+    gst_bayer2rgb_split_and_upsample_horiz (LINE (j_start * 2 + 6),
+        LINE (j_start * 2 + 7), src + (j_start - 1) * src_stride,
+        bayer2rgb->width);
+  gst_bayer2rgb_split_and_upsample_horiz (LINE (j_start * 2 + 0),
+      LINE (j_start * 2 + 1), src + j_start * src_stride, bayer2rgb->width);
+
+  for (j = j_start; j < j_end; j++) {
     if (j < bayer2rgb->height - 1) {
       gst_bayer2rgb_split_and_upsample_horiz (LINE ((j + 1) * 2 + 0),
           LINE ((j + 1) * 2 + 1), src + (j + 1) * src_stride, bayer2rgb->width);
@@ -450,8 +510,48 @@ gst_bayer2rgb_process (GstBayer2RGB * bayer2rgb, uint8_t * dest,
   g_free (tmp);
 }
 
+typedef struct
+{
+  GstBayer2RGB *bayer2rgb;
+  guint8 *dest;
+  int dest_stride;
+  guint8 *src;
+  int src_stride;
+  int j_start;
+  int j_end;
+} GstBayer2RGBBand;
 
+static void
+gst_bayer2rgb_process_band (gpointer task_data, gpointer user_data)
+{
+  GstBayer2RGBBand *band = task_data;
+  GstBayer2RGB *bayer2rgb = band->bayer2rgb;
+
+  gst_bayer2rgb_process (bayer2rgb, band->dest, band->dest_stride,
+      band->src, band->src_stride, band->j_start, band->j_end);
+
+  g_mutex_lock (&bayer2rgb->band_lock);
+  bayer2rgb->bands_pending--;
+  g_cond_signal (&bayer2rgb->band_cond);
+  g_mutex_unlock (&bayer2rgb->band_lock);
+}
+
+static guint
+gst_bayer2rgb_get_n_threads (GstBayer2RGB * filter)
+{
+  guint n_threads;
+
+  GST_OBJECT_LOCK (filter);
+  n_threads = filter->n_threads;
+  GST_OBJECT_UNLOCK (filter);
 
+  if (n_threads == 0)
+    n_threads = g_get_num_processors ();
+  /* Give every band a useful amount of rows to chew on */
+  n_threads = MAX (1, MIN (n_threads, (guint) filter->height / 8));
+
+  return n_threads;
+}
 
 static GstFlowReturn
 gst_bayer2rgb_transform (GstBaseTransform * base, GstBuffer * inbuf,
@@ -461,6 +561,7 @@ gst_bayer2rgb_transform (GstBaseTransform * base, GstBuffer * inbuf,
   GstMapInfo map;
   uint8_t *output;
   GstVideoFrame frame;
+  guint n_threads;
 
   GST_DEBUG ("transforming buffer");
 
@@ -473,8 +574,42 @@ gst_bayer2rgb_transform (GstBaseTransform * base, GstBuffer * inbuf,
   }
 
   output = GST_VIDEO_FRAME_PLANE_DATA (&frame, 0);
-  gst_bayer2rgb_process (filter, output, frame.info.stride[0],
-      map.data, GST_ROUND_UP_4 (filter->width));
+
+  n_threads = gst_bayer2rgb_get_n_threads (filter);
+  if (n_threads > 1) {
+    GstBayer2RGBBand *bands = g_newa (GstBayer2RGBBand, n_threads);
+    /* Keep the band boundaries on even rows so every band starts on the
+     * same row of the Bayer pattern */
+    int rows_per_band = GST_ROUND_UP_2 ((filter->height + n_threads - 1) /
+        n_threads);
+    guint i;
+
+    if (!filter->band_pool)
+      filter->band_pool = g_thread_pool_new (gst_bayer2rgb_process_band,
+          filter, -1, FALSE, NULL);
+
+    g_mutex_lock (&filter->band_lock);
+    filter->bands_pending = 0;
+    for (i = 0; i < n_threads; i++) {
+      bands[i].bayer2rgb = filter;
+      bands[i].dest = output;
+      bands[i].dest_stride = frame.info.stride[0];
+      bands[i].src = map.data;
+      bands[i].src_stride = GST_ROUND_UP_4 (filter->width);
+      bands[i].j_start = i * rows_per_band;
+      bands[i].j_end = MIN ((int) (i + 1) * rows_per_band, filter->height);
+      if (bands[i].j_start >= bands[i].j_end)
+        break;
+      filter->bands_pending++;
+      g_thread_pool_push (filter->band_pool, &bands[i], NULL);
+    }
+    while (filter->bands_pending > 0)
+      g_cond_wait (&filter->band_cond, &filter->band_lock);
+    g_mutex_unlock (&filter->band_lock);
+  } else {
+    gst_bayer2rgb_process (filter, output, frame.info.stride[0],
+        map.data, GST_ROUND_UP_4 (filter->width), 0, filter->height);
+  }
 
   gst_video_frame_unmap (&frame);
   gst_buffer_unmap (inbuf, &map);
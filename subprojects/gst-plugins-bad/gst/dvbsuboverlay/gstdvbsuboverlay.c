@@ -941,6 +941,8 @@ gst_dvbsub_overlay_subs_to_comp (GstDVBSubOverlay * overlay,
     gint w, h;
     guint8 *in_data;
     guint32 *palette, *data;
+    guint32 converted_palette[256];
+    gint n_colours;
     gint rx, ry, rw, rh, stride;
     gint k, l;
     GstMapInfo map;
@@ -957,15 +959,16 @@ gst_dvbsub_overlay_subs_to_comp (GstDVBSubOverlay * overlay,
     in_data = srect->pict.data;
     palette = srect->pict.palette;
     stride = srect->pict.rowstride;
-    for (k = 0; k < h; k++) {
-      for (l = 0; l < w; l++) {
-        guint32 ayuv;
 
-        ayuv = palette[*in_data];
-        GST_WRITE_UINT32_BE (data, ayuv);
-        in_data++;
-        data++;
-      }
+    /* The composition buffer is big endian AYUV, convert the palette
+     * once instead of byte swapping every written pixel */
+    n_colours = MIN (1 << srect->pict.palette_bits_count, 256);
+    for (k = 0; k < n_colours; k++)
+      converted_palette[k] = GUINT32_TO_BE (palette[k]);
+
+    for (k = 0; k < h; k++) {
+      for (l = 0; l < w; l++)
+        *data++ = converted_palette[*in_data++];
       in_data += stride - w;
     }
     gst_buffer_unmap (buf, &map);
@@ -92,20 +92,10 @@ gst_byte_writer_write_uint32_syncsafe (GstByteWriter * w, guint32 val)
   gst_byte_writer_write_bytes (w, data, 4);
 }
 
-static void
-gst_byte_writer_copy_bytes (GstByteWriter * w, guint8 * dest, guint offset,
-    gint size)
+static inline guint8 *
+gst_byte_writer_free_and_get_data (GstByteWriter * w)
 {
-  guint length;
-
-  length = gst_byte_writer_get_length (w);
-
-  if (size == -1)
-    size = length - offset;
-
-  g_warn_if_fail (length >= (offset + size));
-
-  memcpy (dest, w->str + offset, MIN (size, length - offset));
+  return (guint8 *) g_string_free ((GString *) w, FALSE);
 }
 
 static inline void
@@ -192,9 +182,8 @@ static GstBuffer *
 id3v2_tag_to_buffer (GstId3v2Tag * tag)
 {
   GstByteWriter *w;
-  GstMapInfo info;
   GstBuffer *buf;
-  guint8 *dest;
+  guint8 *data;
   guint i, size, offset, size_frames = 0;
 
   GST_DEBUG ("Creating buffer for ID3v2 tag containing %d frames",
@@ -218,24 +207,36 @@ id3v2_tag_to_buffer (GstId3v2Tag * tag)
   gst_byte_writer_write_uint8 (w, 0);   /* flags */
   gst_byte_writer_write_uint32_syncsafe (w, size - 10);
 
-  buf = gst_buffer_new_allocate (NULL, size, NULL);
-  gst_buffer_map (buf, &info, GST_MAP_WRITE);
-  dest = info.data;
-  gst_byte_writer_copy_bytes (w, dest, 0, 10);
-  offset = 10;
+  /* hand the already rendered pieces to the buffer as they are instead of
+   * copying everything into one contiguous allocation */
+  buf = gst_buffer_new ();
+  offset = gst_byte_writer_get_length (w);
+  data = gst_byte_writer_free_and_get_data (w);
+  gst_buffer_append_memory (buf,
+      gst_memory_new_wrapped (0, data, offset, 0, offset, data, g_free));
 
   for (i = 0; i < tag->frames->len; ++i) {
     GstId3v2Frame *frame = &g_array_index (tag->frames, GstId3v2Frame, i);
-
-    gst_byte_writer_copy_bytes (frame->writer, dest + offset, 0, -1);
-    offset += id3v2_frame_get_size (tag, frame);
+    guint frame_size = gst_byte_writer_get_length (frame->writer);
+
+    offset += frame_size;
+    data = gst_byte_writer_free_and_get_data (frame->writer);
+    gst_buffer_append_memory (buf,
+        gst_memory_new_wrapped (0, data, frame_size, 0, frame_size, data,
+            g_free));
+    frame->writer = NULL;
   }
 
-  /* Zero out any additional space in our buffer as padding. */
-  memset (dest + offset, 0, size - offset);
+  /* any additional space in our buffer is zeroed out as padding */
+  if (size > offset) {
+    GstMapInfo info;
+    GstMemory *padding = gst_allocator_alloc (NULL, size - offset, NULL);
 
-  gst_byte_writer_free (w);
-  gst_buffer_unmap (buf, &info);
+    gst_memory_map (padding, &info, GST_MAP_WRITE);
+    memset (info.data, 0, info.size);
+    gst_memory_unmap (padding, &info);
+    gst_buffer_append_memory (buf, padding);
+  }
 
   return buf;
 }
@@ -310,7 +311,9 @@ id3v2_frame_get_size (GstId3v2Tag * tag, GstId3v2Frame * frame)
 static void
 id3v2_frame_unset (GstId3v2Frame * frame)
 {
-  gst_byte_writer_free (frame->writer);
+  /* the writer may already have been handed off to the tag buffer */
+  if (frame->writer)
+    gst_byte_writer_free (frame->writer);
   memset (frame, 0, sizeof (GstId3v2Frame));
 }
 
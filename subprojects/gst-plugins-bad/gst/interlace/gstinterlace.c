@@ -108,6 +108,7 @@ struct _GstInterlace
   guint pattern_offset;         /* initial offset into the pattern */
   gboolean passthrough;
   gboolean switch_fields;
+  gboolean downstream_video_meta;
 };
 
 struct _GstInterlaceClass
@@ -610,6 +611,21 @@ gst_interlace_setcaps (GstInterlace * interlace, GstCaps * caps)
   GST_DEBUG_OBJECT (interlace->srcpad, "set caps %" GST_PTR_FORMAT, othercaps);
 
   ret = gst_pad_set_caps (interlace->srcpad, othercaps);
+
+  /* Check whether downstream supports GstVideoMeta, in which case single
+   * fields can be pushed as references into the progressive input frames
+   * instead of being copied out line by line */
+  interlace->downstream_video_meta = FALSE;
+  if (ret && !interlace->passthrough) {
+    GstQuery *query = gst_query_new_allocation (othercaps, FALSE);
+
+    if (gst_pad_peer_query (interlace->srcpad, query)) {
+      interlace->downstream_video_meta =
+          gst_query_find_allocation_meta (query, GST_VIDEO_META_API_TYPE,
+          NULL);
+    }
+    gst_query_unref (query);
+  }
   gst_caps_unref (othercaps);
 
   interlace->info = info;
@@ -1139,6 +1155,57 @@ src_map_failed:
   }
 }
 
+/* Creates a buffer representing one field of @src without copying, by
+ * pointing a GstVideoMeta at every second line of the source planes.
+ * Returns NULL when this is not possible, in which case the caller
+ * should fall back to copying. */
+static GstBuffer *
+ref_field (GstInterlace * interlace, GstBuffer * src, int field_index)
+{
+  GstVideoInfo *in_info = &interlace->info;
+  GstVideoInfo *out_info = &interlace->out_info;
+  GstVideoMeta *in_meta;
+  gsize offset[GST_VIDEO_MAX_PLANES] = { 0, };
+  gint stride[GST_VIDEO_MAX_PLANES] = { 0, };
+  guint i, n_planes;
+  GstBuffer *dest;
+
+  if (!interlace->downstream_video_meta)
+    return NULL;
+
+  /* The bottom field of the last line pair would point past the end of
+   * the source planes for odd heights */
+  if (GST_VIDEO_INFO_HEIGHT (in_info) & 1)
+    return NULL;
+
+  in_meta = gst_buffer_get_video_meta (src);
+  n_planes = GST_VIDEO_INFO_N_PLANES (in_info);
+
+  for (i = 0; i < n_planes; i++) {
+    gint ss = in_meta ? in_meta->stride[i] :
+        GST_VIDEO_INFO_PLANE_STRIDE (in_info, i);
+    gsize so = in_meta ? in_meta->offset[i] :
+        GST_VIDEO_INFO_PLANE_OFFSET (in_info, i);
+
+    if (ss < 0)
+      return NULL;
+
+    offset[i] = so + field_index * (gsize) ss;
+    stride[i] = ss * 2;
+  }
+
+  dest = gst_buffer_copy_region (src, GST_BUFFER_COPY_FLAGS |
+      GST_BUFFER_COPY_TIMESTAMPS | GST_BUFFER_COPY_MEMORY, 0, -1);
+  GST_BUFFER_FLAG_UNSET (dest,
+      GST_VIDEO_BUFFER_FLAG_INTERLACED | GST_VIDEO_BUFFER_FLAG_TFF |
+      GST_VIDEO_BUFFER_FLAG_RFF | GST_VIDEO_BUFFER_FLAG_ONEFIELD);
+  gst_buffer_add_video_meta_full (dest, GST_VIDEO_FRAME_FLAG_NONE,
+      GST_VIDEO_INFO_FORMAT (out_info), GST_VIDEO_INFO_WIDTH (out_info),
+      GST_VIDEO_INFO_HEIGHT (out_info), n_planes, offset, stride);
+
+  return dest;
+}
+
 static GstBuffer *
 copy_field (GstInterlace * interlace, GstBuffer * src, int field_index)
 {
@@ -1146,6 +1213,10 @@ copy_field (GstInterlace * interlace, GstBuffer * src, int field_index)
   GstVideoFrame dframe, sframe;
   GstBuffer *dest;
 
+  dest = ref_field (interlace, src, field_index);
+  if (dest)
+    return dest;
+
   dest =
       gst_buffer_new_allocate (NULL, GST_VIDEO_INFO_SIZE (&interlace->out_info),
       NULL);
@@ -1308,7 +1379,6 @@ gst_interlace_chain (GstPad * pad, GstObject * parent, GstBuffer * buffer)
     GstBuffer *output_buffer, *output_buffer2 = NULL;
     guint n_output_fields;
     gboolean interlaced = FALSE;
-    GstVideoInfo *in_info = &interlace->info;
     GstVideoInfo *out_info = &interlace->out_info;
 
     GST_DEBUG ("have %d fields, %d current, %d stored",
@@ -1353,32 +1423,14 @@ gst_interlace_chain (GstPad * pad, GstObject * parent, GstBuffer * buffer)
         if (!output_buffer2)
           return GST_FLOW_ERROR;
       } else {
-        GstVideoFrame dframe, sframe;
-
-        output_buffer =
-            gst_buffer_new_and_alloc (GST_VIDEO_INFO_SIZE (out_info));
-
-        if (!gst_video_frame_map (&dframe,
-                out_info, output_buffer, GST_MAP_WRITE)) {
-          GST_ELEMENT_ERROR (interlace, CORE, FAILED,
-              ("Failed to write map buffer"), ("Failed to map output buffer"));
-          gst_buffer_unref (output_buffer);
-          gst_buffer_unref (buffer);
-          return GST_FLOW_ERROR;
-        }
-
-        if (!gst_video_frame_map (&sframe, in_info, buffer, GST_MAP_READ)) {
-          GST_ELEMENT_ERROR (interlace, CORE, FAILED,
-              ("Failed to read map buffer"), ("Failed to map input buffer"));
-          gst_video_frame_unmap (&dframe);
-          gst_buffer_unref (output_buffer);
-          gst_buffer_unref (buffer);
-          return GST_FLOW_ERROR;
-        }
-
-        gst_video_frame_copy (&dframe, &sframe);
-        gst_video_frame_unmap (&dframe);
-        gst_video_frame_unmap (&sframe);
+        /* Both fields come from the incoming buffer, so the output frame
+         * is bit identical to the input. Take a reference instead of
+         * copying the frame, only the buffer metadata needs to be our
+         * own for the decoration below */
+        output_buffer = gst_buffer_make_writable (gst_buffer_ref (buffer));
+        GST_BUFFER_FLAG_UNSET (output_buffer,
+            GST_VIDEO_BUFFER_FLAG_INTERLACED | GST_VIDEO_BUFFER_FLAG_TFF |
+            GST_VIDEO_BUFFER_FLAG_RFF | GST_VIDEO_BUFFER_FLAG_ONEFIELD);
       }
 
       if (num_fields >= 3 && allow_rff) {
@@ -775,9 +775,17 @@ mpegts_try_discover_packet_size (MpegTSPacketizer2 * packetizer)
   data = packetizer->map_data + packetizer->map_offset;
 
   for (i = 0; i + 3 * MPEGTS_MAX_PACKETSIZE < size; i++) {
-    /* find a sync byte */
-    if (data[i] != PACKET_SYNC_BYTE)
-      continue;
+    /* find the next sync byte candidate. memchr uses vectorized byte
+     * search in practice and skips the gaps between candidates much
+     * faster than checking each byte ourselves */
+    guint8 *candidate = memchr (data + i, PACKET_SYNC_BYTE,
+        size - 3 * MPEGTS_MAX_PACKETSIZE - i);
+
+    if (candidate == NULL) {
+      i = size - 3 * MPEGTS_MAX_PACKETSIZE;
+      break;
+    }
+    i = candidate - data;
 
     /* check for 4 consecutive sync bytes with each possible packet size */
     for (j = 0; j < G_N_ELEMENTS (psizes); j++) {
@@ -833,8 +841,18 @@ mpegts_packetizer_sync (MpegTSPacketizer2 * packetizer)
     sync_offset = 0;
 
   for (i = sync_offset; i + 2 * packet_size < size; i++) {
-    if (data[i] == PACKET_SYNC_BYTE &&
-        data[i + packet_size] == PACKET_SYNC_BYTE &&
+    /* as in mpegts_try_discover_packet_size (), let memchr locate the
+     * next sync byte candidate instead of testing every byte */
+    guint8 *candidate = memchr (data + i, PACKET_SYNC_BYTE,
+        size - 2 * packet_size - i);
+
+    if (candidate == NULL) {
+      i = size - 2 * packet_size;
+      break;
+    }
+    i = candidate - data;
+
+    if (data[i + packet_size] == PACKET_SYNC_BYTE &&
         data[i + 2 * packet_size] == PACKET_SYNC_BYTE) {
       found = TRUE;
       break;
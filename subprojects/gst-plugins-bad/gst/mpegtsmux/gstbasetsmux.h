@@ -183,6 +183,10 @@ struct GstBaseTsMux {
   GstAdapter *out_adapter;
   GstBuffer *out_buffer;
   GstClockTimeDiff output_ts_offset;
+
+  /* pool for the fixed-size output packet buffers */
+  GstBufferPool *packet_pool;
+  gsize packet_pool_size;
 };
 
 /**
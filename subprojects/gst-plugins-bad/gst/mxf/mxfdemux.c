@@ -4957,6 +4957,7 @@ collect_index_table_segments (GstMXFDemux * demux)
    * if index table segments were discovered while scanning the file */
   if (demux->random_index_pack) {
     for (i = 0; i < demux->random_index_pack->len; i++) {
+      GstMXFDemuxPartition *p = NULL;
       MXFRandomIndexPackEntry *e =
           &g_array_index (demux->random_index_pack, MXFRandomIndexPackEntry, i);
 
@@ -4965,8 +4966,26 @@ collect_index_table_segments (GstMXFDemux * demux)
         return;
       }
 
+      /* This function is called repeatedly as new index table segments show
+       * up, don't re-read partitions that were already scanned */
+      for (l = demux->partitions; l; l = l->next) {
+        GstMXFDemuxPartition *tmp = l->data;
+
+        if (tmp->partition.this_partition + demux->run_in == e->offset) {
+          p = tmp;
+          break;
+        }
+      }
+      if (p && p->index_scanned)
+        continue;
+
       demux->offset = e->offset;
       read_partition_header (demux);
+
+      if (demux->current_partition
+          && demux->current_partition->partition.this_partition +
+          demux->run_in == e->offset)
+        demux->current_partition->index_scanned = TRUE;
     }
 
     demux->offset = old_offset;
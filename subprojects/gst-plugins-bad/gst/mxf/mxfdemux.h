@@ -83,6 +83,10 @@ struct _GstMXFDemuxPartition
   MXFPrimerPack primer;
   gboolean parsed_metadata;
 
+  /* TRUE if this partition was already scanned for index table segments,
+   * so that repeated index collection doesn't re-read it from disk */
+  gboolean index_scanned;
+
   /* Relative offset at which essence starts within this partition.
    *
    * For Frame wrapping, the position of the first KLV
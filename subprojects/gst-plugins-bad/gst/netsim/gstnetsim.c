@@ -66,6 +66,7 @@ enum
   PROP_MAX_KBPS,
   PROP_MAX_BUCKET_SIZE,
   PROP_ALLOW_REORDERING,
+  PROP_SEED,
 };
 
 /* these numbers are nothing but wild guesses and don't reflect any reality */
@@ -79,6 +80,7 @@ enum
 #define DEFAULT_MAX_KBPS -1
 #define DEFAULT_MAX_BUCKET_SIZE -1
 #define DEFAULT_ALLOW_REORDERING TRUE
+#define DEFAULT_SEED 0
 
 static GstStaticPadTemplate gst_net_sim_sink_template =
 GST_STATIC_PAD_TEMPLATE ("sink",
@@ -542,6 +544,11 @@ gst_net_sim_set_property (GObject * object,
     case PROP_ALLOW_REORDERING:
       netsim->allow_reordering = g_value_get_boolean (value);
       break;
+    case PROP_SEED:
+      netsim->seed = g_value_get_uint (value);
+      if (netsim->seed != 0)
+        g_rand_set_seed (netsim->rand_seed, netsim->seed);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -585,6 +592,9 @@ gst_net_sim_get_property (GObject * object,
     case PROP_ALLOW_REORDERING:
       g_value_set_boolean (value, netsim->allow_reordering);
       break;
+    case PROP_SEED:
+      g_value_set_uint (value, netsim->seed);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -757,6 +767,22 @@ gst_net_sim_class_init (GstNetSimClass * klass)
           DEFAULT_ALLOW_REORDERING,
           G_PARAM_READWRITE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstNetSim:seed:
+   *
+   * Seed for the random number generator driving the drop, duplicate and
+   * delay decisions. With a non-zero seed the generated impairment pattern
+   * is reproducible across runs, which is useful for regression testing.
+   * 0 means a randomly picked seed.
+   *
+   * Since: 1.22
+   */
+  g_object_class_install_property (gobject_class, PROP_SEED,
+      g_param_spec_uint ("seed", "Seed",
+          "Seed for the random impairment decisions (0 = random seed)",
+          0, G_MAXUINT, DEFAULT_SEED,
+          G_PARAM_READWRITE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS));
+
   GST_DEBUG_CATEGORY_INIT (netsim_debug, "netsim", 0, "Network simulator");
 
   gst_type_mark_as_plugin_api (distribution_get_type (), 0);
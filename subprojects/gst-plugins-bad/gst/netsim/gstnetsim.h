@@ -88,6 +88,7 @@ struct _GstNetSim
   gint max_kbps;
   gint max_bucket_size;
   gboolean allow_reordering;
+  guint seed;
 };
 
 struct _GstNetSimClass
@@ -73,7 +73,8 @@ enum
   PROP_SRC_PORT,
   PROP_DST_PORT,
   PROP_CAPS,
-  PROP_TS_OFFSET
+  PROP_TS_OFFSET,
+  PROP_REPLAY_SPEED
 };
 
 GST_DEBUG_CATEGORY_STATIC (gst_pcap_parse_debug);
@@ -150,6 +151,21 @@ gst_pcap_parse_class_init (GstPcapParseClass * klass)
           "Relative timestamp offset (ns) to apply (-1 = use absolute packet time)",
           -1, G_MAXINT64, -1, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstPcapParse:replay-speed:
+   *
+   * Speed up (or slow down) the timestamps of the extracted packets by this
+   * factor. A synchronizing element downstream will then replay the capture
+   * at the scaled rate, which is useful for replaying long captures faster
+   * than real time while keeping the relative packet spacing.
+   *
+   * Since: 1.22
+   */
+  g_object_class_install_property (gobject_class, PROP_REPLAY_SPEED,
+      g_param_spec_double ("replay-speed", "Replay speed",
+          "Factor to scale the packet timestamps by (2.0 = twice as fast)",
+          0.001, 1000.0, 1.0, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   gst_element_class_add_static_pad_template (element_class, &sink_template);
   gst_element_class_add_static_pad_template (element_class, &src_template);
 
@@ -183,6 +199,7 @@ gst_pcap_parse_init (GstPcapParse * self)
   self->src_port = -1;
   self->dst_port = -1;
   self->offset = -1;
+  self->replay_speed = 1.0;
 
   self->adapter = gst_adapter_new ();
 
@@ -256,6 +273,10 @@ gst_pcap_parse_get_property (GObject * object, guint prop_id,
       g_value_set_int64 (value, self->offset);
       break;
 
+    case PROP_REPLAY_SPEED:
+      g_value_set_double (value, self->replay_speed);
+      break;
+
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -310,6 +331,10 @@ gst_pcap_parse_set_property (GObject * object, guint prop_id,
       self->offset = g_value_get_int64 (value);
       break;
 
+    case PROP_REPLAY_SPEED:
+      self->replay_speed = g_value_get_double (value);
+      break;
+
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -554,6 +579,14 @@ gst_pcap_parse_chain (GstPad * pad, GstObject * parent, GstBuffer * buffer)
             if (GST_CLOCK_TIME_IS_VALID (self->cur_ts)) {
               if (!GST_CLOCK_TIME_IS_VALID (self->base_ts))
                 self->base_ts = self->cur_ts;
+              if (self->replay_speed != 1.0) {
+                /* scale the packet spacing, keeping the first timestamp */
+                GstClockTime rel = self->cur_ts - self->base_ts;
+
+                self->cur_ts = self->base_ts +
+                    gst_gdouble_to_guint64 (gst_guint64_to_gdouble (rel) /
+                    self->replay_speed);
+              }
               if (self->offset >= 0) {
                 self->cur_ts -= self->base_ts;
                 self->cur_ts += self->offset;
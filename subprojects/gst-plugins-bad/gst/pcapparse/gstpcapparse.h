@@ -73,6 +73,7 @@ struct _GstPcapParse
   gint32 dst_port;
   GstCaps *caps;
   gint64 offset;
+  gdouble replay_speed;
 
   /* state */
   GstAdapter * adapter;
@@ -91,8 +91,16 @@ enum
 {
   PROP_0,
   PROP_PROXYSINK,
+  PROP_MAX_SIZE_BUFFERS,
+  PROP_MAX_SIZE_BYTES,
+  PROP_MAX_SIZE_TIME,
 };
 
+/* Same defaults as the queue element */
+#define DEFAULT_MAX_SIZE_BUFFERS 200
+#define DEFAULT_MAX_SIZE_BYTES (10 * 1024 * 1024)
+#define DEFAULT_MAX_SIZE_TIME GST_SECOND
+
 /* We're not subclassing from basesrc because we don't want any of the special
  * handling it has for events/queries/etc. We just pass-through everything. */
 
@@ -125,6 +133,11 @@ gst_proxy_src_get_property (GObject * object, guint prop_id, GValue * value,
     case PROP_PROXYSINK:
       g_value_take_object (value, g_weak_ref_get (&self->proxysink));
       break;
+    case PROP_MAX_SIZE_BUFFERS:
+    case PROP_MAX_SIZE_BYTES:
+    case PROP_MAX_SIZE_TIME:
+      g_object_get_property (G_OBJECT (self->queue), spec->name, value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, spec);
       break;
@@ -157,6 +170,11 @@ gst_proxy_src_set_property (GObject * object, guint prop_id,
         g_object_unref (sink);
       }
       break;
+    case PROP_MAX_SIZE_BUFFERS:
+    case PROP_MAX_SIZE_BYTES:
+    case PROP_MAX_SIZE_TIME:
+      g_object_set_property (G_OBJECT (self->queue), spec->name, value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, spec);
   }
@@ -179,6 +197,46 @@ gst_proxy_src_class_init (GstProxySrcClass * klass)
       g_param_spec_object ("proxysink", "Proxysink", "Matching proxysink",
           GST_TYPE_PROXY_SINK, G_PARAM_READWRITE));
 
+  /**
+   * GstProxySrc:max-size-buffers:
+   *
+   * Limit of the internal queue in buffers, 0=disable. Lowering this reduces
+   * the worst-case latency of the handoff between the pipelines.
+   *
+   * Since: 1.22
+   */
+  g_object_class_install_property (gobject_class, PROP_MAX_SIZE_BUFFERS,
+      g_param_spec_uint ("max-size-buffers", "Max. size (buffers)",
+          "Max. number of buffers in the internal queue (0=disable)",
+          0, G_MAXUINT, DEFAULT_MAX_SIZE_BUFFERS,
+          (GParamFlags) (G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+
+  /**
+   * GstProxySrc:max-size-bytes:
+   *
+   * Limit of the internal queue in bytes, 0=disable.
+   *
+   * Since: 1.22
+   */
+  g_object_class_install_property (gobject_class, PROP_MAX_SIZE_BYTES,
+      g_param_spec_uint ("max-size-bytes", "Max. size (kB)",
+          "Max. amount of data in the internal queue (bytes, 0=disable)",
+          0, G_MAXUINT, DEFAULT_MAX_SIZE_BYTES,
+          (GParamFlags) (G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+
+  /**
+   * GstProxySrc:max-size-time:
+   *
+   * Limit of the internal queue in nanoseconds, 0=disable.
+   *
+   * Since: 1.22
+   */
+  g_object_class_install_property (gobject_class, PROP_MAX_SIZE_TIME,
+      g_param_spec_uint64 ("max-size-time", "Max. size (ns)",
+          "Max. amount of data in the internal queue (in ns, 0=disable)",
+          0, G_MAXUINT64, DEFAULT_MAX_SIZE_TIME,
+          (GParamFlags) (G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)));
+
   gstelement_class->change_state = gst_proxy_src_change_state;
   gstelement_class->send_event = gst_proxy_src_send_event;
   gstelement_class->query = gst_proxy_src_query;
@@ -392,19 +392,26 @@ gst_rist_rtx_send_src_event (GstPad * pad, GstObject * parent, GstEvent * event)
       /* This event usually comes from the downstream gstrtpsession */
       if (gst_structure_has_name (s, "GstRTPRetransmissionRequest")) {
         guint seqnum = 0;
+        guint count = 0;
         guint ssrc = 0;
-        GstBuffer *rtx_buf = NULL;
+        GList *rtx_bufs = NULL, *l;
 
         /* retrieve seqnum of the packet that need to be retransmitted */
         if (!gst_structure_get_uint (s, "seqnum", &seqnum))
           seqnum = -1;
 
+        /* number of consecutive packets starting at seqnum, ristsink sends
+         * RIST range NACKs as a single request */
+        if (!gst_structure_get_uint (s, "count", &count) || count == 0)
+          count = 1;
+
         /* retrieve ssrc of the packet that need to be retransmitted */
         if (!gst_structure_get_uint (s, "ssrc", &ssrc))
           ssrc = -1;
 
-        GST_DEBUG_OBJECT (rtx, "got rtx request for seqnum: %u, ssrc: %X",
-            seqnum, ssrc);
+        GST_DEBUG_OBJECT (rtx,
+            "got rtx request for seqnum: %u, count: %u, ssrc: %X", seqnum,
+            count, ssrc);
 
         GST_OBJECT_LOCK (rtx);
         /* check if request is for us */
@@ -412,10 +419,10 @@ gst_rist_rtx_send_src_event (GstPad * pad, GstObject * parent, GstEvent * event)
           SSRCRtxData *data;
           GSequenceIter *iter;
           BufferQueueItem search_item;
-          guint32 extseqnum;
+          guint32 extseqnum, last_extseqnum;
 
           /* update statistics */
-          ++rtx->num_rtx_requests;
+          rtx->num_rtx_requests += count;
 
           data = gst_rist_rtx_send_get_ssrc_data (rtx, ssrc);
 
@@ -426,25 +433,41 @@ gst_rist_rtx_send_src_event (GstPad * pad, GstObject * parent, GstEvent * event)
             guint32 max_extseqnum = data->max_extseqnum;
             extseqnum = gst_rist_rtp_ext_seq (&max_extseqnum, seqnum);
           }
+          last_extseqnum = extseqnum + count - 1;
 
           search_item.extseqnum = extseqnum;
           iter = g_sequence_lookup (data->queue, &search_item,
               (GCompareDataFunc) buffer_queue_items_cmp, NULL);
-          if (iter) {
+          if (!iter && count > 1) {
+            /* the start of the range may already have been trimmed from the
+             * history, resume from the first item that is part of it */
+            iter = g_sequence_search (data->queue, &search_item,
+                (GCompareDataFunc) buffer_queue_items_cmp, NULL);
+          }
+
+          /* collect the whole requested range in one walk instead of looking
+           * up every seqnum from scratch */
+          while (iter && !g_sequence_iter_is_end (iter)) {
             BufferQueueItem *item = g_sequence_get (iter);
+
+            if (item->extseqnum > last_extseqnum)
+              break;
+
             GST_LOG_OBJECT (rtx, "found %u (%u:%u)", item->extseqnum,
                 item->extseqnum >> 16, item->extseqnum & 0xFFFF);
-            rtx_buf = gst_rtp_rist_buffer_new (rtx, item->buffer, ssrc);
+            rtx_bufs = g_list_prepend (rtx_bufs,
+                gst_rtp_rist_buffer_new (rtx, item->buffer, ssrc));
+            iter = g_sequence_iter_next (iter);
           }
 #ifndef GST_DISABLE_DEBUG
-          else {
+          if (rtx_bufs == NULL) {
             BufferQueueItem *item = NULL;
 
             iter = g_sequence_get_begin_iter (data->queue);
             if (!g_sequence_iter_is_end (iter))
               item = g_sequence_get (iter);
 
-            if (item && extseqnum < item->extseqnum) {
+            if (item && last_extseqnum < item->extseqnum) {
               GST_DEBUG_OBJECT (rtx, "requested seqnum %u has already been "
                   "removed from the rtx queue; the first available is %u",
                   seqnum, item->extseqnum);
@@ -454,13 +477,15 @@ gst_rist_rtx_send_src_event (GstPad * pad, GstObject * parent, GstEvent * event)
                   "is not configured correctly, or the source is too slow",
                   seqnum);
             }
-#endif
           }
+#endif
         }
         GST_OBJECT_UNLOCK (rtx);
 
-        if (rtx_buf)
-          gst_rist_rtx_send_push_out (rtx, rtx_buf);
+        rtx_bufs = g_list_reverse (rtx_bufs);
+        for (l = rtx_bufs; l; l = l->next)
+          gst_rist_rtx_send_push_out (rtx, l->data);
+        g_list_free (rtx_bufs);
 
         gst_event_unref (event);
         return TRUE;
@@ -389,18 +389,19 @@ on_app_rtcp (GObject * session, guint32 subtype, guint32 ssrc,
           guint32 dword = GST_READ_UINT32_BE (map.data + i);
           guint16 seqnum = dword >> 16;
           guint16 num = dword & 0x0000FFFF;
-          guint16 j;
 
           GST_DEBUG ("got RIST nack packet, #%u %u", seqnum, num);
 
-          /* num is inclusive, i.e. it can be 0, which means exactly 1 seqnum */
-          for (j = 0; j <= num; j++) {
-            event = gst_event_new_custom (GST_EVENT_CUSTOM_UPSTREAM,
-                gst_structure_new ("GstRTPRetransmissionRequest",
-                    "seqnum", G_TYPE_UINT, (guint) seqnum + j,
-                    "ssrc", G_TYPE_UINT, (guint) ssrc, NULL));
-            gst_pad_push_event (send_rtp_sink, event);
-          }
+          /* num is inclusive, i.e. it can be 0, which means exactly 1 seqnum.
+           * Request the whole range with a single event so that a range NACK
+           * is served with one walk of the retransmission history instead of
+           * one lookup per seqnum. */
+          event = gst_event_new_custom (GST_EVENT_CUSTOM_UPSTREAM,
+              gst_structure_new ("GstRTPRetransmissionRequest",
+                  "seqnum", G_TYPE_UINT, (guint) seqnum,
+                  "count", G_TYPE_UINT, (guint) num + 1,
+                  "ssrc", G_TYPE_UINT, (guint) ssrc, NULL));
+          gst_pad_push_event (send_rtp_sink, event);
         }
 
         gst_buffer_unmap (data, &map);
@@ -32,6 +32,10 @@ static void write_all_bytes_done (GObject * source, GAsyncResult * result,
     gpointer user_data);
 static void write_all_buffer_done (GObject * source, GAsyncResult * result,
     gpointer user_data);
+#if GLIB_CHECK_VERSION (2, 60, 0)
+static void writev_all_buffer_done (GObject * source, GAsyncResult * result,
+    gpointer user_data);
+#endif
 
 void
 gst_rtmp_byte_array_append_bytes (GByteArray * bytearray, GBytes * bytes)
@@ -161,6 +165,9 @@ typedef struct
   GstBuffer *buffer;
   GstMapInfo map;
   gboolean mapped;
+  GstMapInfo *maps;
+  GOutputVector *vectors;
+  guint n_maps;
   gsize bytes_written;
 } WriteAllBufferData;
 
@@ -173,12 +180,27 @@ write_all_buffer_data_new (GstBuffer * buffer)
 }
 
 static void
-write_all_buffer_data_free (gpointer ptr)
+write_all_buffer_data_unmap (WriteAllBufferData * data)
 {
-  WriteAllBufferData *data = ptr;
+  guint i;
+
   if (data->mapped) {
     gst_buffer_unmap (data->buffer, &data->map);
+    data->mapped = FALSE;
+  }
+  for (i = 0; i < data->n_maps; i++) {
+    gst_memory_unmap (data->maps[i].memory, &data->maps[i]);
   }
+  data->n_maps = 0;
+}
+
+static void
+write_all_buffer_data_free (gpointer ptr)
+{
+  WriteAllBufferData *data = ptr;
+  write_all_buffer_data_unmap (data);
+  g_free (data->maps);
+  g_free (data->vectors);
   g_clear_pointer (&data->buffer, gst_buffer_unref);
   g_slice_free (WriteAllBufferData, data);
 }
@@ -199,6 +221,40 @@ gst_rtmp_output_stream_write_all_buffer_async (GOutputStream * stream,
   data = write_all_buffer_data_new (buffer);
   g_task_set_task_data (task, data, write_all_buffer_data_free);
 
+#if GLIB_CHECK_VERSION (2, 60, 0)
+  {
+    guint i, n_mem = gst_buffer_n_memory (buffer);
+
+    /* write the memories as one vector of iovecs; mapping the whole buffer
+     * below would merge them into a freshly allocated copy */
+    data->maps = g_new (GstMapInfo, n_mem);
+    data->vectors = g_new (GOutputVector, n_mem);
+
+    for (i = 0; i < n_mem; i++) {
+      GstMemory *mem = gst_buffer_peek_memory (buffer, i);
+
+      if (!gst_memory_map (mem, &data->maps[i], GST_MAP_READ))
+        break;
+
+      data->vectors[i].buffer = data->maps[i].data;
+      data->vectors[i].size = data->maps[i].size;
+    }
+
+    if (i == n_mem) {
+      data->n_maps = n_mem;
+      g_output_stream_writev_all_async (stream, data->vectors, n_mem,
+          io_priority, cancellable, writev_all_buffer_done, task);
+      return;
+    }
+
+    /* a memory failed to map, fall back to mapping the whole buffer */
+    while (i > 0) {
+      i--;
+      gst_memory_unmap (data->maps[i].memory, &data->maps[i]);
+    }
+  }
+#endif
+
   if (!gst_buffer_map (buffer, &data->map, GST_MAP_READ)) {
     g_task_return_new_error (task, GST_RESOURCE_ERROR, GST_RESOURCE_ERROR_READ,
         "Failed to map buffer for reading");
@@ -225,8 +281,7 @@ write_all_buffer_done (GObject * source, GAsyncResult * result,
   res = g_output_stream_write_all_finish (os, result, &data->bytes_written,
       &error);
 
-  gst_buffer_unmap (data->buffer, &data->map);
-  data->mapped = FALSE;
+  write_all_buffer_data_unmap (data);
 
   if (!res) {
     g_task_return_error (task, error);
@@ -238,6 +293,33 @@ write_all_buffer_done (GObject * source, GAsyncResult * result,
   g_object_unref (task);
 }
 
+#if GLIB_CHECK_VERSION (2, 60, 0)
+static void
+writev_all_buffer_done (GObject * source, GAsyncResult * result,
+    gpointer user_data)
+{
+  GOutputStream *os = G_OUTPUT_STREAM (source);
+  GTask *task = user_data;
+  WriteAllBufferData *data = g_task_get_task_data (task);
+  GError *error = NULL;
+  gboolean res;
+
+  res = g_output_stream_writev_all_finish (os, result, &data->bytes_written,
+      &error);
+
+  write_all_buffer_data_unmap (data);
+
+  if (!res) {
+    g_task_return_error (task, error);
+    g_object_unref (task);
+    return;
+  }
+
+  g_task_return_boolean (task, TRUE);
+  g_object_unref (task);
+}
+#endif
+
 
 gboolean
 gst_rtmp_output_stream_write_all_buffer_finish (GOutputStream * stream,
@@ -194,30 +194,19 @@ _obu_name (GstAV1OBUType type)
 static guint32
 _read_leb128 (guint8 * data, GstAV1ParserResult * retval, guint32 * comsumed)
 {
-  guint8 leb128_byte = 0;
+  guint8 leb128_byte;
   guint64 value = 0;
   gint i;
-  gboolean result;
-  GstBitReader br;
-  guint32 cur_pos;
 
-  gst_bit_reader_init (&br, data, 8);
-
-  cur_pos = gst_bit_reader_get_pos (&br);
+  /* leb128 fields are byte aligned, no need for a bit reader here */
   for (i = 0; i < 8; i++) {
-    leb128_byte = 0;
-    result = gst_bit_reader_get_bits_uint8 (&br, &leb128_byte, 8);
-    if (result == FALSE) {
-      *retval = GST_AV1_PARSER_BITSTREAM_ERROR;
-      return 0;
-    }
-
+    leb128_byte = data[i];
     value |= (((gint) leb128_byte & 0x7f) << (i * 7));
     if (!(leb128_byte & 0x80))
       break;
   }
 
-  *comsumed = (gst_bit_reader_get_pos (&br) - cur_pos) / 8;
+  *comsumed = MIN (i + 1, 8);
   /* check for bitstream conformance see chapter4.10.5 */
   if (value < G_MAXUINT32) {
     *retval = GST_AV1_PARSER_OK;
@@ -1124,7 +1113,7 @@ gst_av1_parse_convert_from_annexb (GstAV1Parse * self, GstBuffer * buffer,
 
 static void
 gst_av1_parse_cache_one_obu (GstAV1Parse * self, GstBuffer * buffer,
-    GstAV1OBU * obu, guint8 * data, guint32 size, gboolean frame_complete)
+    GstAV1OBU * obu, guint32 offset, guint32 size, gboolean frame_complete)
 {
   gboolean need_convert = FALSE;
   GstBuffer *buf;
@@ -1144,11 +1133,9 @@ gst_av1_parse_cache_one_obu (GstAV1Parse * self, GstBuffer * buffer,
     g_assert (self->in_align == GST_AV1_PARSE_ALIGN_TEMPORAL_UNIT_ANNEX_B);
     gst_av1_parse_convert_to_annexb (self, buffer, obu, frame_complete);
   } else {
-    buf = gst_buffer_new_memdup (data, size);
-    GST_BUFFER_PTS (buf) = GST_BUFFER_PTS (buffer);
-    GST_BUFFER_DTS (buf) = GST_BUFFER_DTS (buffer);
-    GST_BUFFER_DURATION (buf) = GST_BUFFER_DURATION (buffer);
-
+    /* no bitstream conversion needed, take a view into the input buffer
+     * instead of copying the OBU payload around */
+    buf = gst_buffer_copy_region (buffer, GST_BUFFER_COPY_ALL, offset, size);
     gst_adapter_push (self->cache_out, buf);
   }
 }
@@ -1578,7 +1565,7 @@ again:
     }
 
     gst_av1_parse_cache_one_obu (self, buffer, &obu,
-        map_info.data + total_consumed, consumed, frame_complete);
+        total_consumed, consumed, frame_complete);
 
     total_consumed += consumed;
 
@@ -3339,24 +3339,28 @@ gst_h264_parse_pre_push_frame (GstBaseParse * parse, GstBaseParseFrame * frame)
     }
   }
 
-  /* Fixme: setting passthrough mode causing multiple issues:
-   * For nal aligned multiresoluton streams, passthrough mode make h264parse
-   * unable to advertise the new resolutions. Also causing issues while
-   * parsing MVC streams when it has two layers.
-   * Disabing passthourgh mode for now */
-#if 0
   /* If SPS/PPS and a keyframe have been parsed, and we're not converting,
    * we might switch to passthrough mode now on the basis that we've seen
    * the SEI packets and know optional caps params (such as multiview).
    * This is an efficiency optimisation that relies on stream properties
-   * remaining uniform in practice. */
-  if (h264parse->can_passthrough) {
+   * remaining uniform in practice.
+   *
+   * This historically caused problems and is therefore restricted to the
+   * provably safe case: upstream must deliver complete AUs (NAL aligned
+   * multi-resolution streams change caps mid-stream and would then need
+   * reparsing), the stream must not be MVC (every NAL of both layers
+   * needs inspection) or carry pic timing SEI (we'd stop producing the
+   * timecode metas), and no periodic SPS/PPS injection may be
+   * configured. */
+  if (h264parse->can_passthrough
+      && h264parse->in_align == GST_H264_PARSE_ALIGN_AU
+      && h264parse->multiview_mode == GST_VIDEO_MULTIVIEW_MODE_NONE
+      && h264parse->num_clock_timestamp == 0 && h264parse->interval == 0) {
     if (h264parse->keyframe && h264parse->have_sps && h264parse->have_pps) {
       GST_LOG_OBJECT (parse, "Switching to passthrough mode");
       gst_base_parse_set_passthrough (parse, TRUE);
     }
   }
-#endif
 
   if (frame->out_buffer) {
     parse_buffer = frame->out_buffer =
@@ -1365,17 +1365,24 @@ retry:
       " flags 0x%08x", idx, buffer_info.offset, buffer_info.size,
       buffer_info.presentation_time_us, buffer_info.flags);
 
-  buf = gst_amc_codec_get_output_buffer (self->codec, idx, &err);
-  if (err) {
-    if (self->flushing) {
-      g_clear_error (&err);
-      goto flushing;
+  if (self->codec_config == AMC_CODEC_CONFIG_WITH_SURFACE) {
+    /* The codec renders into the surface in this mode and never returns a
+     * ByteBuffer for output buffers, so don't pay for a JNI round-trip per
+     * frame just to learn that again */
+    buf = NULL;
+  } else {
+    buf = gst_amc_codec_get_output_buffer (self->codec, idx, &err);
+    if (err) {
+      if (self->flushing) {
+        g_clear_error (&err);
+        goto flushing;
+      }
+      goto failed_to_get_output_buffer;
     }
-    goto failed_to_get_output_buffer;
-  }
 
-  if (self->codec_config != AMC_CODEC_CONFIG_WITH_SURFACE && !buf)
-    goto got_null_output_buffer;
+    if (!buf)
+      goto got_null_output_buffer;
+  }
 
   frame =
       _find_nearest_frame (self,
@@ -1256,10 +1256,12 @@ public:
     }
     *allocatedBuffer = (void *) buf;
 
-    /* If there are still unused buffers in the pool
-     * remove one of them every fifth call */
-    if (gst_queue_array_get_length (m_buffers) > 0) {
-      if (++m_nonEmptyCalls >= 5) {
+    /* Keep a few spare buffers in the pool so that the steady-state
+     * allocation path never has to fall back to g_malloc() while downstream
+     * briefly holds on to frames. Only shrink the pool when it has had more
+     * than that many unused buffers for a while */
+    if (gst_queue_array_get_length (m_buffers) > 2) {
+      if (++m_nonEmptyCalls >= 30) {
         buf = (uint8_t *) gst_queue_array_pop_head (m_buffers);
         uint8_t offset = *(buf - 1);
         void *alloc_buf = buf - 128 + offset;
@@ -33,6 +33,10 @@
 /* read, write */
 #include <io.h>
 #endif
+#ifdef G_OS_UNIX
+/* writev */
+#include <sys/uio.h>
+#endif
 #include <errno.h>
 #include <string.h>
 #include <gst/base/gstbytewriter.h>
@@ -248,6 +252,69 @@ done:
   return ret;
 }
 
+typedef struct
+{
+  const void *data;
+  size_t size;
+} WriteVector;
+
+/* Writes all the vectors to fdout, with a single writev() syscall where
+ * available so the receiving end gets the whole payload in one wakeup */
+static gboolean
+write_vectors_to_fd (GstIpcPipelineComm * comm, WriteVector * vectors,
+    guint n_vectors)
+{
+#ifdef G_OS_UNIX
+  struct iovec iov[4];
+  struct iovec *cur = iov;
+  int left = 0;
+  guint n;
+
+  g_assert (n_vectors <= G_N_ELEMENTS (iov));
+
+  for (n = 0; n < n_vectors; n++) {
+    if (vectors[n].size == 0)
+      continue;
+    cur[left].iov_base = (void *) vectors[n].data;
+    cur[left].iov_len = vectors[n].size;
+    left++;
+  }
+
+  while (left > 0) {
+    ssize_t written = writev (comm->fdout, cur, left);
+
+    if (written < 0) {
+      if (errno == EAGAIN || errno == EINTR)
+        continue;
+      GST_ERROR_OBJECT (comm->element, "Failed to write to fd: %s",
+          strerror (errno));
+      return FALSE;
+    }
+
+    while (written > 0 && (size_t) written >= cur->iov_len) {
+      written -= cur->iov_len;
+      cur++;
+      left--;
+    }
+    if (written > 0) {
+      cur->iov_base = (guint8 *) cur->iov_base + written;
+      cur->iov_len -= written;
+    }
+  }
+
+  return TRUE;
+#else
+  guint n;
+
+  for (n = 0; n < n_vectors; n++) {
+    if (!write_to_fd_raw (comm, vectors[n].data, vectors[n].size))
+      return FALSE;
+  }
+
+  return TRUE;
+#endif
+}
+
 static gboolean
 write_byte_writer_to_fd (GstIpcPipelineComm * comm, GstByteWriter * bw)
 {
@@ -516,7 +583,10 @@ gst_ipc_pipeline_comm_write_buffer_to_fd (GstIpcPipelineComm * comm,
   CommBufferMetadata meta;
   GstFlowReturn ret;
   MetaListRepresentation repr = { comm, 0, 4, NULL };   /* starts a 4 for n_meta */
-  GstByteWriter bw;
+  GstByteWriter bw, meta_bw;
+  guint8 *header_data = NULL, *meta_data = NULL;
+  WriteVector vectors[3];
+  gboolean wret;
 
   g_mutex_lock (&comm->mutex);
   ++comm->send_id;
@@ -525,6 +595,7 @@ gst_ipc_pipeline_comm_write_buffer_to_fd (GstIpcPipelineComm * comm,
       comm->send_id, buffer);
 
   gst_byte_writer_init (&bw);
+  gst_byte_writer_init (&meta_bw);
 
   meta.pts = GST_BUFFER_PTS (buffer);
   meta.dts = GST_BUFFER_DTS (buffer);
@@ -550,51 +621,62 @@ gst_ipc_pipeline_comm_write_buffer_to_fd (GstIpcPipelineComm * comm,
   size = gst_buffer_get_size (buffer);
   if (!gst_byte_writer_put_uint32_le (&bw, size))
     goto write_failed;
-  if (!write_byte_writer_to_fd (comm, &bw))
-    goto write_failed;
-
-  if (!gst_buffer_map (buffer, &map, GST_MAP_READ))
-    goto map_failed;
-  ret = write_to_fd_raw (comm, map.data, map.size);
-  gst_buffer_unmap (buffer, &map);
-  if (!ret)
-    goto write_failed;
 
   /* meta */
-  gst_byte_writer_init (&bw);
-  if (!gst_byte_writer_put_uint32_le (&bw, repr.n_meta))
+  if (!gst_byte_writer_put_uint32_le (&meta_bw, repr.n_meta))
     goto write_failed;
   for (n = 0; n < repr.n_meta; ++n) {
     const MetaBuildInfo *info = repr.info + n;
     guint32 len;
     const char *s;
 
-    if (!gst_byte_writer_put_uint32_le (&bw, info->bytes))
+    if (!gst_byte_writer_put_uint32_le (&meta_bw, info->bytes))
       goto write_failed;
 
-    if (!gst_byte_writer_put_uint32_le (&bw, info->flags))
+    if (!gst_byte_writer_put_uint32_le (&meta_bw, info->flags))
       goto write_failed;
 
     s = g_type_name (info->api);
     len = strlen (s) + 1;
-    if (!gst_byte_writer_put_uint32_le (&bw, len))
+    if (!gst_byte_writer_put_uint32_le (&meta_bw, len))
       goto write_failed;
-    if (!gst_byte_writer_put_data (&bw, (const guint8 *) s, len))
+    if (!gst_byte_writer_put_data (&meta_bw, (const guint8 *) s, len))
       goto write_failed;
 
-    if (!gst_byte_writer_put_uint64_le (&bw, info->size))
+    if (!gst_byte_writer_put_uint64_le (&meta_bw, info->size))
       goto write_failed;
 
     s = info->str;
     len = s ? (strlen (s) + 1) : 0;
-    if (!gst_byte_writer_put_uint32_le (&bw, len))
+    if (!gst_byte_writer_put_uint32_le (&meta_bw, len))
       goto write_failed;
     if (len)
-      if (!gst_byte_writer_put_data (&bw, (const guint8 *) s, len))
+      if (!gst_byte_writer_put_data (&meta_bw, (const guint8 *) s, len))
         goto write_failed;
   }
 
-  if (!write_byte_writer_to_fd (comm, &bw))
+  if (!gst_buffer_map (buffer, &map, GST_MAP_READ))
+    goto map_failed;
+
+  /* send header, payload and metas in one go instead of one write() each */
+  vectors[0].size = gst_byte_writer_get_size (&bw);
+  vectors[0].data = header_data = gst_byte_writer_reset_and_get_data (&bw);
+  vectors[1].data = map.data;
+  vectors[1].size = map.size;
+  vectors[2].size = gst_byte_writer_get_size (&meta_bw);
+  vectors[2].data = meta_data = gst_byte_writer_reset_and_get_data (&meta_bw);
+
+  if (header_data != NULL && meta_data != NULL)
+    wret = write_vectors_to_fd (comm, vectors, G_N_ELEMENTS (vectors));
+  else
+    wret = FALSE;
+
+  gst_buffer_unmap (buffer, &map);
+  g_free (header_data);
+  header_data = NULL;
+  g_free (meta_data);
+  meta_data = NULL;
+  if (!wret)
     goto write_failed;
 
   if (!gst_ipc_pipeline_comm_sync_fd (comm, comm->send_id, NULL, &ret32,
@@ -605,6 +687,7 @@ gst_ipc_pipeline_comm_write_buffer_to_fd (GstIpcPipelineComm * comm,
 done:
   g_mutex_unlock (&comm->mutex);
   gst_byte_writer_reset (&bw);
+  gst_byte_writer_reset (&meta_bw);
   for (n = 0; n < repr.n_meta; ++n)
     g_free (repr.info[n].str);
   g_free (repr.info);
@@ -1375,6 +1375,20 @@ gst_kms_sink_import_dmabuf (GstKMSSink * self, GstBuffer * inbuf,
     }
   }
 
+  ensure_kms_allocator (self);
+
+  /* Fast path: the framebuffer for this dmabuf was already imported and
+   * cached on the buffer's first memory, no need to re-validate the plane
+   * layout on every frame of a cycling pool */
+  kmsmem =
+      (GstKMSMemory *) gst_kms_allocator_get_cached (gst_buffer_peek_memory
+      (inbuf, 0));
+  if (kmsmem) {
+    GST_LOG_OBJECT (self, "found cached KMS mem %p with fb id = %d",
+        kmsmem, kmsmem->fb_id);
+    goto wrap_mem;
+  }
+
   /* Find and validate all memories */
   for (i = 0; i < n_planes; i++) {
     guint length;
@@ -1395,8 +1409,6 @@ gst_kms_sink_import_dmabuf (GstKMSSink * self, GstBuffer * inbuf,
       return FALSE;
   }
 
-  ensure_kms_allocator (self);
-
   kmsmem = (GstKMSMemory *) gst_kms_allocator_get_cached (mems[0]);
   if (kmsmem) {
     GST_LOG_OBJECT (self, "found KMS mem %p in DMABuf mem %p with fb id = %d",
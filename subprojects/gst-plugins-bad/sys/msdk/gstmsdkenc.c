@@ -77,6 +77,7 @@ static void gst_msdkenc_close_encoder (GstMsdkEnc * thiz);
 
 GST_DEBUG_CATEGORY_EXTERN (gst_msdkenc_debug);
 #define GST_CAT_DEFAULT gst_msdkenc_debug
+GST_DEBUG_CATEGORY_STATIC (CAT_PERFORMANCE);
 
 static GstStaticPadTemplate sink_factory = GST_STATIC_PAD_TEMPLATE ("sink",
     GST_PAD_SINK,
@@ -1765,6 +1766,9 @@ gst_msdkenc_get_surface_from_frame (GstMsdkEnc * thiz,
   }
 #endif
 
+  GST_CAT_LOG_OBJECT (CAT_PERFORMANCE, thiz,
+      "slow copy of input buffer %p into video memory", inbuf);
+
   if (!gst_video_frame_map (&src_frame, &thiz->input_state->info, inbuf,
           GST_MAP_READ)) {
     GST_ERROR_OBJECT (thiz, "failed to map the frame for source");
@@ -2208,6 +2212,8 @@ gst_msdkenc_class_init (GstMsdkEncClass * klass)
   element_class = GST_ELEMENT_CLASS (klass);
   gstencoder_class = GST_VIDEO_ENCODER_CLASS (klass);
 
+  GST_DEBUG_CATEGORY_GET (CAT_PERFORMANCE, "GST_PERFORMANCE");
+
   klass->need_conversion = gst_msdkenc_need_conversion;
   klass->need_reconfig = gst_msdkenc_need_reconfig;
   klass->set_extra_params = gst_msdkenc_set_extra_params;
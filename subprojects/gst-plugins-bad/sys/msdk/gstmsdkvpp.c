@@ -92,6 +92,7 @@
 
 GST_DEBUG_CATEGORY_EXTERN (gst_msdkvpp_debug);
 #define GST_CAT_DEFAULT gst_msdkvpp_debug
+GST_DEBUG_CATEGORY_STATIC (CAT_PERFORMANCE);
 
 #define SUPPORTED_SYSTEM_FORMAT \
     "{ NV12, YV12, I420, YUY2, UYVY, VUYA, BGRA, BGRx, P010_10LE" EXT_SINK_FORMATS "}"
@@ -828,6 +829,9 @@ get_msdk_surface_from_input_buffer (GstMsdkVPP * thiz, GstBuffer * inbuf)
   }
 #endif
 
+  GST_CAT_LOG_OBJECT (CAT_PERFORMANCE, thiz,
+      "slow copy of input buffer %p into video memory", inbuf);
+
   if (!gst_video_frame_map (&src_frame, &thiz->sinkpad_info, inbuf,
           GST_MAP_READ)) {
     GST_ERROR_OBJECT (thiz, "failed to map the frame for source");
@@ -1704,6 +1708,8 @@ gst_msdkvpp_class_init (GstMsdkVPPClass * klass)
   element_class = GST_ELEMENT_CLASS (klass);
   trans_class = GST_BASE_TRANSFORM_CLASS (klass);
 
+  GST_DEBUG_CATEGORY_GET (CAT_PERFORMANCE, "GST_PERFORMANCE");
+
   gobject_class->set_property = gst_msdkvpp_set_property;
   gobject_class->get_property = gst_msdkvpp_get_property;
   gobject_class->dispose = gst_msdkvpp_dispose;
@@ -323,18 +323,79 @@ gst_cuda_context_finalize (GObject * object)
  *
  * Returns: a new #GstCudaContext or %NULL on failure
  */
+/* Elements that cannot find a context to share through the GstContext
+ * mechanism (e.g. because they initialize in parallel, before the
+ * have-context message has propagated) would each create their own CUDA
+ * context for the same device, and frames would then be copied through
+ * system memory when crossing between them. Keep a weak per-device cache
+ * so every gst_cuda_context_new() for a device returns the same context
+ * for as long as something holds it alive. */
+typedef struct
+{
+  gint device_id;
+  GWeakRef context;
+} GstCudaContextCacheEntry;
+
+static GMutex cache_lock;
+static GList *context_cache = NULL;
+
+/* Must be called with cache_lock taken. Prunes dropped entries */
+static GstCudaContext *
+gst_cuda_context_cache_lookup (gint device_id)
+{
+  GList *iter, *next;
+  GstCudaContext *ctx = NULL;
+
+  for (iter = context_cache; iter; iter = next) {
+    GstCudaContextCacheEntry *entry = iter->data;
+
+    next = g_list_next (iter);
+
+    if (device_id != -1 && entry->device_id != device_id)
+      continue;
+
+    ctx = g_weak_ref_get (&entry->context);
+    if (ctx)
+      break;
+
+    g_weak_ref_clear (&entry->context);
+    g_free (entry);
+    context_cache = g_list_delete_link (context_cache, iter);
+  }
+
+  return ctx;
+}
+
 GstCudaContext *
 gst_cuda_context_new (gint device_id)
 {
-  GstCudaContext *self =
-      g_object_new (GST_TYPE_CUDA_CONTEXT, "cuda-device-id", device_id, NULL);
+  GstCudaContext *self;
+
+  g_mutex_lock (&cache_lock);
+  self = gst_cuda_context_cache_lookup (device_id);
+  if (self) {
+    g_mutex_unlock (&cache_lock);
+    GST_DEBUG ("Reusing CUDA context %" GST_PTR_FORMAT " for device %d",
+        self, device_id);
+    return self;
+  }
+
+  self = g_object_new (GST_TYPE_CUDA_CONTEXT, "cuda-device-id", device_id,
+      NULL);
 
   gst_object_ref_sink (self);
 
   if (!self->priv->context) {
     GST_ERROR ("Failed to create CUDA context");
     gst_clear_object (&self);
+  } else {
+    GstCudaContextCacheEntry *entry = g_new0 (GstCudaContextCacheEntry, 1);
+
+    entry->device_id = self->priv->device_id;
+    g_weak_ref_init (&entry->context, self);
+    context_cache = g_list_prepend (context_cache, entry);
   }
+  g_mutex_unlock (&cache_lock);
 
   return self;
 }
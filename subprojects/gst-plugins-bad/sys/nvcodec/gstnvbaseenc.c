@@ -1177,8 +1177,10 @@ gst_nv_base_enc_bitstream_thread (gpointer user_data)
     state = gst_video_codec_frame_get_user_data (frame);
     g_assert (state->out_buf == out_buf);
 
-    /* copy into output buffer */
-    buffer = gst_buffer_new_allocate (NULL, lock_bs.bitstreamSizeInBytes, NULL);
+    /* copy into output buffer, allocated via the negotiated downstream
+     * allocator/pool so the per-frame allocation can be recycled */
+    buffer = gst_video_encoder_allocate_output_buffer (enc,
+        lock_bs.bitstreamSizeInBytes);
     gst_buffer_fill (buffer, 0, lock_bs.bitstreamBufferPtr,
         lock_bs.bitstreamSizeInBytes);
 
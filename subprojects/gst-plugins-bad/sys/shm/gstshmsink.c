@@ -909,23 +909,30 @@ pollthread_func (gpointer data)
       }
 
       if (gst_poll_fd_can_read (self->poll, &gclient->pollfd)) {
-        int rv;
-        gpointer tag = NULL;
+        /* Drain every ACK the client has queued up, otherwise each ACK
+         * costs a full poll iteration, which adds up with many clients */
+        while (TRUE) {
+          int rv;
+          gpointer tag = NULL;
 
-        GST_OBJECT_LOCK (self);
-        rv = sp_writer_recv (self->pipe, gclient->client, &tag);
-        GST_OBJECT_UNLOCK (self);
+          GST_OBJECT_LOCK (self);
+          rv = sp_writer_recv (self->pipe, gclient->client, &tag);
+          GST_OBJECT_UNLOCK (self);
 
-        if (rv < 0) {
-          GST_WARNING_OBJECT (self, "One client has read error,"
-              " closing (retval: %d errno: %d)", rv, errno);
-          goto close_client;
-        }
+          if (rv == -200)
+            break;
+
+          if (rv < 0) {
+            GST_WARNING_OBJECT (self, "One client has read error,"
+                " closing (retval: %d errno: %d)", rv, errno);
+            goto close_client;
+          }
 
-        g_assert (rv == 0 || tag == NULL);
+          g_assert (rv == 0 || tag == NULL);
 
-        if (rv == 0)
-          gst_buffer_unref (tag);
+          if (rv == 0)
+            gst_buffer_unref (tag);
+        }
       }
       continue;
     close_client:
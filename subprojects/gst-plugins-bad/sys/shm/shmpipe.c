@@ -638,6 +638,8 @@ sp_writer_send_buf (ShmPipe * self, char *buf, size_t size, void *tag)
   return c;
 }
 
+/* Returns 1 if a full command was received, -1 if no data was available and
+ * 0 on EOF or a truncated command */
 static int
 recv_command (int fd, struct CommandBuffer *cb)
 {
@@ -646,6 +648,8 @@ recv_command (int fd, struct CommandBuffer *cb)
   retval = recv (fd, cb, sizeof (struct CommandBuffer), MSG_DONTWAIT);
   if (retval == sizeof (struct CommandBuffer)) {
     return 1;
+  } else if (retval < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+    return -1;
   } else {
     return 0;
   }
@@ -660,7 +664,7 @@ sp_client_recv (ShmPipe * self, char **buf)
   struct CommandBuffer cb;
   int retval;
 
-  if (!recv_command (self->main_socket, &cb))
+  if (recv_command (self->main_socket, &cb) != 1)
     return -1;
 
   switch (cb.type) {
@@ -720,8 +724,12 @@ sp_writer_recv (ShmPipe * self, ShmClient * client, void **tag)
 {
   ShmBuffer *buf = NULL, *prev_buf = NULL;
   struct CommandBuffer cb;
+  int rv;
 
-  if (!recv_command (client->fd, &cb))
+  rv = recv_command (client->fd, &cb);
+  if (rv < 0)
+    return -200;                /* no data available, try again later */
+  else if (rv == 0)
     return -1;
 
   switch (cb.type) {
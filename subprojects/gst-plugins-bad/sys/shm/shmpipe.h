@@ -104,6 +104,8 @@ size_t sp_writer_get_max_buf_size (ShmPipe * self);
 ShmClient * sp_writer_accept_client (ShmPipe * self);
 void sp_writer_close_client (ShmPipe *self, ShmClient * client,
     sp_buffer_free_callback callback, void * user_data);
+/* Returns -200 if no (more) data is available on the client socket,
+ * any other negative value is an error and the client should be closed */
 int sp_writer_recv (ShmPipe * self, ShmClient * client, void ** tag);
 
 int sp_writer_pending_writes (ShmPipe * self);
@@ -1336,12 +1336,7 @@ gst_v4l2_codec_h264_dec_get_preferred_output_delay (GstH264Decoder * decoder,
   GstV4l2CodecH264Dec *self = GST_V4L2_CODEC_H264_DEC (decoder);
   guint delay;
 
-  if (live)
-    delay = 0;
-  else
-    /* Just one for now, perhaps we can make this configurable in the future. */
-    delay = 1;
-
+  delay = gst_v4l2_decoder_get_preferred_render_delay (self->decoder, live);
   gst_v4l2_decoder_set_render_delay (self->decoder, delay);
 
   return delay;
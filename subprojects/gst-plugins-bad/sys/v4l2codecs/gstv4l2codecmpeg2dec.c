@@ -104,12 +104,7 @@ gst_v4l2_codec_mpeg2_dec_get_preferred_output_delay (GstMpeg2Decoder * decoder,
   GstV4l2CodecMpeg2Dec *self = GST_V4L2_CODEC_MPEG2_DEC (decoder);
   guint delay;
 
-  if (is_live)
-    delay = 0;
-  else
-    /* Just one for now, perhaps we can make this configurable in the future. */
-    delay = 1;
-
+  delay = gst_v4l2_decoder_get_preferred_render_delay (self->decoder, is_live);
   gst_v4l2_decoder_set_render_delay (self->decoder, delay);
 
   return delay;
@@ -104,11 +104,7 @@ gst_v4l2_codec_vp9_dec_get_preferred_output_delay (GstVp9Decoder * decoder,
   GstV4l2CodecVp9Dec *self = GST_V4L2_CODEC_VP9_DEC (decoder);
   guint delay;
 
-  if (is_live)
-    delay = 0;
-  else
-    delay = 1;
-
+  delay = gst_v4l2_decoder_get_preferred_render_delay (self->decoder, is_live);
   gst_v4l2_decoder_set_render_delay (self->decoder, delay);
   return delay;
 }
@@ -1010,6 +1010,35 @@ gst_v4l2_decoder_get_render_delay (GstV4l2Decoder * self)
   return self->render_delay;
 }
 
+/**
+ * gst_v4l2_decoder_get_preferred_render_delay:
+ * @self: a #GstV4l2Decoder pointer
+ * @is_live: whether the pipeline is live
+ *
+ * Picks how many decode requests may be queued ahead of the one being
+ * waited for. A deeper backlog keeps the hardware busy between frames at
+ * the cost of as many frames of extra output latency, so live pipelines
+ * get none. The depth can be overridden with the
+ * GST_V4L2_CODEC_RENDER_DELAY environment variable (clamped to 0-16) for
+ * throughput-oriented deployments.
+ *
+ * Returns: the render delay to configure for this decoder.
+ */
+guint
+gst_v4l2_decoder_get_preferred_render_delay (GstV4l2Decoder * self,
+    gboolean is_live)
+{
+  const gchar *env = g_getenv ("GST_V4L2_CODEC_RENDER_DELAY");
+
+  if (env)
+    return CLAMP (g_ascii_strtoull (env, NULL, 10), 0, 16);
+
+  if (is_live)
+    return 0;
+
+  return 1;
+}
+
 GstV4l2Request *
 gst_v4l2_request_ref (GstV4l2Request * request)
 {
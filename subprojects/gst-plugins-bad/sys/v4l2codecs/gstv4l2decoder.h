@@ -121,6 +121,9 @@ void              gst_v4l2_decoder_set_render_delay (GstV4l2Decoder * self,
 
 guint             gst_v4l2_decoder_get_render_delay (GstV4l2Decoder * self);
 
+guint             gst_v4l2_decoder_get_preferred_render_delay (GstV4l2Decoder * self,
+                                                               gboolean is_live);
+
 
 GstV4l2Request *  gst_v4l2_request_ref (GstV4l2Request * request);
 
@@ -942,6 +942,8 @@ G_DEFINE_TYPE_WITH_CODE (GstVaAllocator, gst_va_allocator, GST_TYPE_ALLOCATOR,
     _init_debug_category ());
 
 static gboolean _va_unmap (GstVaMemory * mem);
+static gboolean _va_release_cached_image (GstVaMemory * mem);
+static gboolean _va_release_cached_image_unlocked (GstVaMemory * mem);
 
 static void
 gst_va_allocator_finalize (GObject * object)
@@ -977,9 +979,13 @@ _va_free (GstAllocator * allocator, GstMemory * mem)
   GstVaMemory *va_mem = (GstVaMemory *) mem;
 
   if (va_mem->mapped_data) {
-    g_warning (G_STRLOC ":%s: Freeing memory %p still mapped", G_STRFUNC,
-        va_mem);
-    _va_unmap (va_mem);
+    if (g_atomic_int_get (&va_mem->map_count) > 0) {
+      g_warning (G_STRLOC ":%s: Freeing memory %p still mapped", G_STRFUNC,
+          va_mem);
+      _va_unmap (va_mem);
+    }
+    /* drop the cached image mapping kept between map cycles */
+    _va_release_cached_image (va_mem);
   }
 
   if (va_mem->surface != VA_INVALID_ID && mem->parent == NULL) {
@@ -1114,6 +1120,10 @@ _va_map_unlocked (GstVaMemory * mem, GstMapFlags flags)
   }
 
   if (flags & GST_MAP_VA) {
+    /* drop any cached image mapping, mapped_data points into the
+     * surface handle for VA maps */
+    if (mem->mapped_data)
+      _va_release_cached_image_unlocked (mem);
     mem->mapped_data = &mem->surface;
     goto success;
   }
@@ -1148,6 +1158,26 @@ _va_map_unlocked (GstVaMemory * mem, GstMapFlags flags)
   else
     info = &va_allocator->info;
 
+  /* Reuse the image mapping cached by the previous map cycle if it is
+   * of the right kind; only an explicit synchronization with the
+   * surface is needed then, instead of deriving/creating and mapping
+   * the image again, which is very expensive on some drivers. */
+  if (mem->mapped_data && mem->image.image_id != VA_INVALID_ID) {
+    if (mem->is_derived == use_derived) {
+      if (mem->is_derived) {
+        if (!va_sync_surface (display, mem->surface))
+          goto fail;
+      } else if (flags & GST_MAP_READ) {
+        if (!va_get_image (display, mem->surface, &mem->image))
+          goto fail;
+      }
+      goto success;
+    }
+
+    /* wrong kind of cached mapping for the requested access */
+    _va_release_cached_image_unlocked (mem);
+  }
+
   if (!va_ensure_image (display, mem->surface, info, &mem->image, use_derived))
     return NULL;
 
@@ -1170,6 +1200,8 @@ success:
 
 fail:
   {
+    if (mem->mapped_data && mem->mapped_data != &mem->surface)
+      va_unmap_buffer (display, mem->image.buf);
     va_destroy_image (display, mem->image.image_id);
     _clean_mem (mem);
     return NULL;
@@ -1188,6 +1220,40 @@ _va_map (GstVaMemory * mem, gsize maxsize, GstMapFlags flags)
   return data;
 }
 
+/* unmaps and destroys the image mapping kept between map cycles */
+static gboolean
+_va_release_cached_image_unlocked (GstVaMemory * mem)
+{
+  GstAllocator *allocator = GST_MEMORY_CAST (mem)->allocator;
+  GstVaDisplay *display;
+  gboolean ret = TRUE;
+
+  if (!mem->mapped_data)
+    return TRUE;
+
+  if (mem->mapped_data != &mem->surface) {
+    display = GST_VA_ALLOCATOR (allocator)->display;
+    ret &= va_unmap_buffer (display, mem->image.buf);
+    ret &= va_destroy_image (display, mem->image.image_id);
+  }
+
+  _clean_mem (mem);
+
+  return ret;
+}
+
+static gboolean
+_va_release_cached_image (GstVaMemory * mem)
+{
+  gboolean ret;
+
+  g_mutex_lock (&mem->lock);
+  ret = _va_release_cached_image_unlocked (mem);
+  g_mutex_unlock (&mem->lock);
+
+  return ret;
+}
+
 static gboolean
 _va_unmap_unlocked (GstVaMemory * mem)
 {
@@ -1198,8 +1264,10 @@ _va_unmap_unlocked (GstVaMemory * mem)
   if (!g_atomic_int_dec_and_test (&mem->map_count))
     return TRUE;
 
-  if (mem->prev_mapflags & GST_MAP_VA)
-    goto bail;
+  if (mem->prev_mapflags & GST_MAP_VA) {
+    _clean_mem (mem);
+    return TRUE;
+  }
 
   display = GST_VA_ALLOCATOR (allocator)->display;
 
@@ -1212,11 +1280,10 @@ _va_unmap_unlocked (GstVaMemory * mem)
      * an replace it in mem */
   }
 
-  ret &= va_unmap_buffer (display, mem->image.buf);
-  ret &= va_destroy_image (display, mem->image.image_id);
-
-bail:
-  _clean_mem (mem);
+  /* Keep the image and its CPU mapping cached for the next map cycle;
+   * it is released when the memory is freed or a map of a different
+   * kind is requested. The next map re-synchronizes explicitly. */
+  mem->prev_mapflags = 0;
 
   return ret;
 }
@@ -162,6 +162,9 @@ struct _GstWasapi2RingBuffer
   MFWORKITEM_KEY loopback_callback_key;
   HANDLE loopback_event_handle;
 
+  DWORD work_queue_id;
+  gboolean work_queue_locked;
+
   guint64 expected_position;
   gboolean is_first;
   gboolean running;
@@ -252,6 +255,9 @@ gst_wasapi2_ring_buffer_constructed (GObject * object)
     goto out;
   }
 
+  self->work_queue_id = queue_id;
+  self->work_queue_locked = TRUE;
+
   self->callback_object = new GstWasapiAsyncCallback (self, queue_id, FALSE);
   hr = MFCreateAsyncResult (nullptr, self->callback_object, nullptr,
       &self->callback_result);
@@ -306,6 +312,11 @@ gst_wasapi2_ring_buffer_finalize (GObject * object)
   CloseHandle (self->loopback_event_handle);
   g_mutex_clear (&self->volume_lock);
 
+  /* Release our hold on the shared "Pro Audio" work queue again, the lock
+   * taken in constructed() is counted per caller */
+  if (self->work_queue_locked)
+    MFUnlockWorkQueue (self->work_queue_id);
+
   G_OBJECT_CLASS (parent_class)->finalize (object);
 }
 
@@ -1222,6 +1222,15 @@ export_complete:
 }
 #endif /* GST_GL_HAVE_PLATFORM_EGL && GST_GL_HAVE_DMABUF */
 
+static void
+_flush_download_transfers (GstGLContext * context, gpointer data)
+{
+  /* without a flush the readbacks just queued may not start executing until
+   * the consumer maps the PBO, which would turn the asynchronous transfer
+   * into a synchronous stall at map time */
+  context->gl_vtable->Flush ();
+}
+
 static GstFlowReturn
 gst_gl_download_element_prepare_output_buffer (GstBaseTransform * bt,
     GstBuffer * inbuf, GstBuffer ** outbuf)
@@ -1323,13 +1332,20 @@ gst_gl_download_element_prepare_output_buffer (GstBaseTransform * bt,
 #endif
 
   if (dl->mode == GST_GL_DOWNLOAD_MODE_PBO_TRANSFERS) {
+    gboolean transfer_started = FALSE;
+
     n = gst_buffer_n_memory (*outbuf);
     for (i = 0; i < n; i++) {
       GstMemory *mem = gst_buffer_peek_memory (*outbuf, i);
 
-      if (gst_is_gl_memory_pbo (mem))
+      if (gst_is_gl_memory_pbo (mem)) {
         gst_gl_memory_pbo_download_transfer ((GstGLMemoryPBO *) mem);
+        transfer_started = TRUE;
+      }
     }
+
+    if (transfer_started)
+      gst_gl_context_thread_add (context, _flush_download_transfers, NULL);
   }
 
   return GST_FLOW_OK;
@@ -2137,6 +2137,7 @@ gst_ogg_chain_new (GstOggDemux * ogg)
   chain->segment_start = GST_CLOCK_TIME_NONE;
   chain->segment_stop = GST_CLOCK_TIME_NONE;
   chain->total_time = GST_CLOCK_TIME_NONE;
+  chain->seek_cache = g_array_new (FALSE, FALSE, sizeof (GstOggSeekEntry));
 
   return chain;
 }
@@ -2152,6 +2153,7 @@ gst_ogg_chain_free (GstOggChain * chain)
     gst_object_unref (pad);
   }
   g_array_free (chain->streams, TRUE);
+  g_array_free (chain->seek_cache, TRUE);
   g_slice_free (GstOggChain, chain);
 }
 
@@ -3109,6 +3111,76 @@ gst_ogg_demux_activate_chain (GstOggDemux * ogg, GstOggChain * chain,
   return TRUE;
 }
 
+#define SEEK_CACHE_MAX_ENTRIES 1024
+
+/* remember a (time, offset) pair discovered during bisection so that later
+ * seeks can start from much tighter bounds */
+static void
+gst_ogg_chain_seek_cache_add (GstOggChain * chain, GstClockTime time,
+    gint64 offset)
+{
+  GArray *cache = chain->seek_cache;
+  guint lo = 0, hi = cache->len;
+  GstOggSeekEntry entry;
+
+  while (lo < hi) {
+    guint mid = (lo + hi) / 2;
+
+    if (g_array_index (cache, GstOggSeekEntry, mid).time < time)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+
+  if (lo < cache->len && g_array_index (cache, GstOggSeekEntry, lo).time == time)
+    return;
+
+  if (cache->len >= SEEK_CACHE_MAX_ENTRIES)
+    return;
+
+  entry.time = time;
+  entry.offset = offset;
+  g_array_insert_val (cache, lo, entry);
+}
+
+/* narrow the bisection window around target with pages discovered by earlier
+ * seeks; a page ending before the target makes a better lower bound, a page
+ * ending at or after it a better upper bound */
+static void
+gst_ogg_chain_seek_cache_bound (GstOggChain * chain, gint64 target,
+    gint64 * begin, gint64 * end, gint64 * begintime, gint64 * endtime)
+{
+  GArray *cache = chain->seek_cache;
+  guint lo = 0, hi = cache->len;
+  GstOggSeekEntry *entry;
+
+  /* first entry with time >= target */
+  while (lo < hi) {
+    guint mid = (lo + hi) / 2;
+
+    if (g_array_index (cache, GstOggSeekEntry,
+            mid).time < (GstClockTime) target)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+
+  if (lo > 0) {
+    entry = &g_array_index (cache, GstOggSeekEntry, lo - 1);
+    if (entry->offset > *begin) {
+      *begin = entry->offset;
+      *begintime = entry->time;
+    }
+  }
+  if (lo < cache->len) {
+    entry = &g_array_index (cache, GstOggSeekEntry, lo);
+    if (entry->offset < *end) {
+      *end = entry->offset;
+      *endtime = entry->time;
+    }
+  }
+}
+
 static gboolean
 do_binary_search (GstOggDemux * ogg, GstOggChain * chain, gint64 begin,
     gint64 end, gint64 begintime, gint64 endtime, gint64 target,
@@ -3213,6 +3285,8 @@ do_binary_search (GstOggDemux * ogg, GstOggChain * chain, gint64 begin,
             "found page with granule %" G_GINT64_FORMAT " and time %"
             GST_TIME_FORMAT, granulepos, GST_TIME_ARGS (granuletime));
 
+        gst_ogg_chain_seek_cache_add (chain, granuletime, result);
+
         if (granuletime < target) {
           best = result;        /* raw offset of packet with granulepos */
           begin = ogg->offset;  /* raw offset of next page */
@@ -3335,9 +3409,20 @@ gst_ogg_demux_do_seek (GstOggDemux * ogg, GstSegment * segment,
   endtime = begintime + chain->total_time;
   target = position - total + begintime;
 
-  if (!do_binary_search (ogg, chain, begin, end, begintime, endtime, target,
-          &best, FALSE, 0))
-    goto seek_error;
+  {
+    gint64 bs_begin = begin, bs_end = end;
+    gint64 bs_begintime = begintime, bs_endtime = endtime;
+
+    /* narrow the bisection window with pages discovered by earlier seeks,
+     * repeated seeks into the same area then need only a few reads. The
+     * original bounds stay in place for the keyframe scan below */
+    gst_ogg_chain_seek_cache_bound (chain, target, &bs_begin, &bs_end,
+        &bs_begintime, &bs_endtime);
+
+    if (!do_binary_search (ogg, chain, bs_begin, bs_end, bs_begintime,
+            bs_endtime, target, &best, FALSE, 0))
+      goto seek_error;
+  }
 
   /* second step: find pages for all relevant streams. We use the
    * keyframe_granule to keep track of which ones we saw. If we have
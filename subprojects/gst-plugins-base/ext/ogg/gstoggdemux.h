@@ -52,6 +52,13 @@ typedef struct _GstOggDemux GstOggDemux;
 typedef struct _GstOggDemuxClass GstOggDemuxClass;
 typedef struct _GstOggChain GstOggChain;
 
+/* a (time, byte offset) pair discovered while bisecting a chain */
+typedef struct
+{
+  GstClockTime time;
+  gint64 offset;
+} GstOggSeekEntry;
+
 /* all information needed for one ogg chain (relevant for chained bitstreams) */
 struct _GstOggChain
 {
@@ -73,6 +80,10 @@ struct _GstOggChain
                                    the start times of all streams. */
   GstClockTime segment_stop;    /* the timestamp of the last page, this is the MAX of the
                                    streams. */
+
+  GArray *seek_cache;           /* (time, byte offset) pairs discovered during
+                                   bisection, sorted by time, used to narrow
+                                   the bounds of later seeks */
 };
 
 /* all information needed for one ogg stream */
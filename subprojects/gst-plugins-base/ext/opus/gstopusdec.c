@@ -662,9 +662,21 @@ opus_dec_chain_parse_data (GstOpusDec * dec, GstBuffer * buffer)
     dec->plc_duration += aligned_missing_duration;
     GST_OBJECT_UNLOCK (dec);
   } else {
-    /* use maximum size (120 ms) as the number of returned samples is
-       not constant over the stream. */
-    samples = 120 * dec->sample_rate / 1000;
+    GstClockTime packet_dur = 0;
+
+    if (!dec->use_inband_fec && data != NULL)
+      packet_dur = packet_duration_opus (data, size);
+
+    if (packet_dur > 0) {
+      /* size the output from the packet's TOC byte; the retry loop below
+       * grows the buffer in case the packet turns out to be larger */
+      samples =
+          gst_util_uint64_scale_int (packet_dur, dec->sample_rate, GST_SECOND);
+    } else {
+      /* use maximum size (120 ms) as the number of returned samples is
+         not constant over the stream. */
+      samples = 120 * dec->sample_rate / 1000;
+    }
   }
   packet_size = samples * dec->n_channels * 2;
 
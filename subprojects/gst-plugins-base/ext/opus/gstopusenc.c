@@ -415,6 +415,9 @@ gst_opus_enc_stop (GstAudioEncoder * benc)
     opus_multistream_encoder_destroy (enc->state);
     enc->state = NULL;
   }
+  g_free (enc->scratch);
+  enc->scratch = NULL;
+  enc->scratch_size = 0;
   gst_tag_setter_reset_tags (GST_TAG_SETTER (enc));
 
   return TRUE;
@@ -1030,30 +1033,19 @@ gst_opus_enc_encode (GstOpusEnc * enc, GstBuffer * buf)
 
   g_assert (size == bytes);
 
-  outbuf =
-      gst_audio_encoder_allocate_output_buffer (GST_AUDIO_ENCODER (enc),
-      max_payload_size * enc->n_channels);
-  if (!outbuf)
-    goto done;
+  if (G_UNLIKELY (enc->scratch_size < max_payload_size * enc->n_channels)) {
+    enc->scratch_size = max_payload_size * enc->n_channels;
+    enc->scratch = g_realloc (enc->scratch, enc->scratch_size);
+  }
 
   GST_DEBUG_OBJECT (enc, "encoding %d samples (%d bytes)",
       frame_samples, (int) bytes);
 
-  if (trim_start || trim_end) {
-    GST_DEBUG_OBJECT (enc,
-        "Adding trim-start %" G_GUINT64_FORMAT " trim-end %" G_GUINT64_FORMAT,
-        trim_start, trim_end);
-    gst_buffer_add_audio_clipping_meta (outbuf, GST_FORMAT_DEFAULT, trim_start,
-        trim_end);
-  }
-
-  gst_buffer_map (outbuf, &omap, GST_MAP_WRITE);
-
+  /* encode into the scratch area first so that the output buffer can be
+   * allocated at the actual packet size instead of the worst case */
   outsize =
       opus_multistream_encode (enc->state, (const gint16 *) data,
-      frame_samples, omap.data, max_payload_size * enc->n_channels);
-
-  gst_buffer_unmap (outbuf, &omap);
+      frame_samples, enc->scratch, max_payload_size * enc->n_channels);
 
   if (outsize < 0) {
     GST_ELEMENT_ERROR (enc, STREAM, ENCODE, (NULL),
@@ -1069,8 +1061,24 @@ gst_opus_enc_encode (GstOpusEnc * enc, GstBuffer * buf)
   }
 
   GST_DEBUG_OBJECT (enc, "Output packet is %u bytes", outsize);
-  gst_buffer_set_size (outbuf, outsize);
 
+  outbuf =
+      gst_audio_encoder_allocate_output_buffer (GST_AUDIO_ENCODER (enc),
+      outsize);
+  if (!outbuf)
+    goto done;
+
+  if (trim_start || trim_end) {
+    GST_DEBUG_OBJECT (enc,
+        "Adding trim-start %" G_GUINT64_FORMAT " trim-end %" G_GUINT64_FORMAT,
+        trim_start, trim_end);
+    gst_buffer_add_audio_clipping_meta (outbuf, GST_FORMAT_DEFAULT, trim_start,
+        trim_end);
+  }
+
+  gst_buffer_map (outbuf, &omap, GST_MAP_WRITE);
+  memcpy (omap.data, enc->scratch, outsize);
+  gst_buffer_unmap (outbuf, &omap);
 
   ret =
       gst_audio_encoder_finish_frame (GST_AUDIO_ENCODER (enc), outbuf,
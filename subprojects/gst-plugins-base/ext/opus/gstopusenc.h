@@ -87,6 +87,11 @@ struct _GstOpusEnc {
   guint8                encoding_channel_mapping[256];
   guint8                decoding_channel_mapping[256];
   guint8                n_stereo_streams;
+
+  /* scratch area the packets are encoded into before being copied into
+   * right-sized output buffers */
+  guint8               *scratch;
+  guint                 scratch_size;
 };
 
 struct _GstOpusEncClass {
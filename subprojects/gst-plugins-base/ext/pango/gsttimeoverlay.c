@@ -121,6 +121,20 @@ gst_time_overlay_render_time (GstTimeOverlay * overlay, GstClockTime time)
   return g_strdup_printf ("%u:%02u:%02u.%03u", hours, mins, secs, msecs);
 }
 
+/* only trigger a re-render when the text actually changed, so that the
+ * previously rendered composition can be re-used otherwise */
+static gchar *
+gst_time_overlay_update_text (GstTimeOverlay * self,
+    GstBaseTextOverlay * overlay, gchar * text)
+{
+  if (g_strcmp0 (text, self->text)) {
+    overlay->need_render = TRUE;
+    g_free (self->text);
+    self->text = g_strdup (text);
+  }
+  return text;
+}
+
 /* Called with lock held */
 static gchar *
 gst_time_overlay_get_text (GstBaseTextOverlay * overlay,
@@ -130,15 +144,14 @@ gst_time_overlay_get_text (GstBaseTextOverlay * overlay,
   GstTimeOverlayTimeLine time_line;
   gchar *time_str, *txt, *ret;
 
-  overlay->need_render = TRUE;
-
   time_line = g_atomic_int_get (&GST_TIME_OVERLAY_CAST (overlay)->time_line);
   if (time_line == GST_TIME_OVERLAY_TIME_LINE_TIME_CODE) {
     GstVideoTimeCodeMeta *tc_meta =
         gst_buffer_get_video_time_code_meta (video_frame);
     if (!tc_meta) {
       GST_DEBUG ("buffer without valid timecode");
-      return g_strdup ("00:00:00:00");
+      return gst_time_overlay_update_text (self, overlay,
+          g_strdup ("00:00:00:00"));
     }
     time_str = gst_video_time_code_to_string (&tc_meta->tc);
     GST_DEBUG ("buffer with timecode %s", time_str);
@@ -150,7 +163,7 @@ gst_time_overlay_get_text (GstBaseTextOverlay * overlay,
 
     if (!GST_CLOCK_TIME_IS_VALID (ts_buffer)) {
       GST_DEBUG ("buffer without valid timestamp");
-      return g_strdup ("");
+      return gst_time_overlay_update_text (self, overlay, g_strdup (""));
     }
 
     GST_DEBUG ("buffer with timestamp %" GST_TIME_FORMAT,
@@ -200,7 +213,7 @@ gst_time_overlay_get_text (GstBaseTextOverlay * overlay,
   g_free (txt);
   g_free (time_str);
 
-  return ret;
+  return gst_time_overlay_update_text (self, overlay, ret);
 }
 
 static GstStateChangeReturn
@@ -226,6 +239,7 @@ gst_time_overlay_finalize (GObject * gobject)
 
   g_date_time_unref (self->datetime_epoch);
   g_free (self->datetime_format);
+  g_free (self->text);
   G_OBJECT_CLASS (parent_class)->finalize (gobject);
 }
 
@@ -68,6 +68,8 @@ struct _GstTimeOverlay {
   /* For GST_TIME_OVERLAY_TIME_LINE_ELAPSED_RUNNING_TIME mode */
   GstClockTime first_running_time;
   GstPadEventFunction orig_video_event;
+
+  gchar *text;
 };
 
 struct _GstTimeOverlayClass {
@@ -0,0 +1,328 @@
+/* GStreamer NUMA-aware memory allocator
+ * Copyright (C) 2013 Linaro SA
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+/**
+ * SECTION:gstnumaallocator
+ * @title: GstNumaAllocator
+ * @short_description: Memory allocator bound to a NUMA node
+ * @see_also: #GstMemory, #GstBufferPool
+ *
+ * A #GstAllocator that binds its allocations to a given NUMA node so that
+ * producers and consumers pinned to the same socket avoid cross-socket
+ * memory traffic. Use gst_numa_allocator_obtain() to get the (registered)
+ * allocator for a node and hand it to a #GstBufferPool with
+ * gst_buffer_pool_config_set_allocator(), configuring the pool of an
+ * element with the node its streaming thread is pinned to.
+ *
+ * The allocator is built on anonymous mmap() plus mbind(); when the
+ * platform has no NUMA support the allocator still works but the node
+ * binding is silently skipped.
+ *
+ * Since: 1.22
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "gstnumaallocator.h"
+
+#include <errno.h>
+#ifdef HAVE_MMAP
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+#ifdef HAVE_NUMA
+#include <numaif.h>
+#endif
+
+GST_DEBUG_CATEGORY_STATIC (gst_numamemory_debug);
+#define GST_CAT_DEFAULT gst_numamemory_debug
+
+typedef struct
+{
+  GstMemory mem;
+
+  gpointer data;
+  gsize maplen;
+  gint node;
+} GstNumaMemory;
+
+static GstMemory *
+gst_numa_alloc (GstAllocator * allocator, gsize size,
+    GstAllocationParams * params)
+{
+#ifdef HAVE_MMAP
+  GstNumaAllocator *self = GST_NUMA_ALLOCATOR_CAST (allocator);
+  GstNumaMemory *mem;
+  gsize maxsize, maplen, page_size;
+  gpointer data;
+
+  page_size = sysconf (_SC_PAGESIZE);
+
+  /* mmap'ed memory is page aligned, we can't do better than that */
+  if (params->align + 1 > page_size) {
+    GST_ERROR_OBJECT (self, "alignment %" G_GSIZE_FORMAT " larger than page "
+        "size", params->align + 1);
+    return NULL;
+  }
+
+  maxsize = size + params->prefix + params->padding;
+  maplen = (maxsize + page_size - 1) & ~(page_size - 1);
+
+  data = mmap (NULL, maplen, PROT_READ | PROT_WRITE,
+      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (data == MAP_FAILED) {
+    GST_ERROR_OBJECT (self, "mmap of %" G_GSIZE_FORMAT " bytes failed: %s",
+        maplen, g_strerror (errno));
+    return NULL;
+  }
+#ifdef HAVE_NUMA
+  if (self->node >= 0) {
+    unsigned long nodemask = 1UL << self->node;
+
+    /* bind before the pages are touched so they are faulted in on the
+     * requested node */
+    if (mbind (data, maplen, MPOL_BIND, &nodemask,
+            sizeof (nodemask) * 8, 0) != 0) {
+      GST_WARNING_OBJECT (self, "could not bind %" G_GSIZE_FORMAT " bytes to "
+          "node %d: %s", maplen, self->node, g_strerror (errno));
+    }
+  }
+#endif
+
+  mem = g_slice_new0 (GstNumaMemory);
+  gst_memory_init (GST_MEMORY_CAST (mem), params->flags,
+      GST_ALLOCATOR_CAST (allocator), NULL, maxsize, params->align,
+      params->prefix, size);
+
+  mem->data = data;
+  mem->maplen = maplen;
+  mem->node = self->node;
+
+  GST_DEBUG ("%p: node %d size %" G_GSIZE_FORMAT, mem, mem->node, maxsize);
+
+  return (GstMemory *) mem;
+#else /* !HAVE_MMAP */
+  return NULL;
+#endif
+}
+
+static void
+gst_numa_mem_free (GstAllocator * allocator, GstMemory * gmem)
+{
+#ifdef HAVE_MMAP
+  GstNumaMemory *mem = (GstNumaMemory *) gmem;
+
+  if (gmem->parent == NULL)
+    munmap (mem->data, mem->maplen);
+
+  g_slice_free (GstNumaMemory, mem);
+  GST_DEBUG ("%p: freed", mem);
+#endif
+}
+
+static gpointer
+gst_numa_mem_map (GstMemory * gmem, gsize maxsize, GstMapFlags flags)
+{
+  GstNumaMemory *mem = (GstNumaMemory *) gmem;
+
+  return mem->data;
+}
+
+static void
+gst_numa_mem_unmap (GstMemory * gmem)
+{
+}
+
+static GstMemory *
+gst_numa_mem_share (GstMemory * gmem, gssize offset, gssize size)
+{
+  GstNumaMemory *mem = (GstNumaMemory *) gmem;
+  GstNumaMemory *sub;
+  GstMemory *parent;
+
+  GST_DEBUG ("%p: share %" G_GSSIZE_FORMAT " %" G_GSIZE_FORMAT, mem, offset,
+      size);
+
+  /* find the real parent */
+  if ((parent = mem->mem.parent) == NULL)
+    parent = (GstMemory *) mem;
+
+  if (size == -1)
+    size = mem->mem.size - offset;
+
+  sub = g_slice_new0 (GstNumaMemory);
+  /* the shared memory is always readonly */
+  gst_memory_init (GST_MEMORY_CAST (sub), GST_MINI_OBJECT_FLAGS (parent) |
+      GST_MINI_OBJECT_FLAG_LOCK_READONLY, mem->mem.allocator, parent,
+      mem->mem.maxsize, mem->mem.align, mem->mem.offset + offset, size);
+
+  sub->data = ((GstNumaMemory *) parent)->data;
+  sub->maplen = ((GstNumaMemory *) parent)->maplen;
+  sub->node = mem->node;
+
+  return GST_MEMORY_CAST (sub);
+}
+
+static gboolean
+gst_numa_mem_is_span (GstMemory * mem1, GstMemory * mem2, gsize * offset)
+{
+  GstNumaMemory *nmem1 = (GstNumaMemory *) mem1;
+  GstNumaMemory *nmem2 = (GstNumaMemory *) mem2;
+
+  if (offset)
+    *offset = mem1->offset - mem1->parent->offset;
+
+  /* and memory is contiguous */
+  return nmem1->data == nmem2->data &&
+      mem1->offset + mem1->size == mem2->offset;
+}
+
+G_DEFINE_TYPE (GstNumaAllocator, gst_numa_allocator, GST_TYPE_ALLOCATOR);
+
+static void
+gst_numa_allocator_class_init (GstNumaAllocatorClass * klass)
+{
+  GstAllocatorClass *allocator_class;
+
+  allocator_class = (GstAllocatorClass *) klass;
+
+  allocator_class->alloc = gst_numa_alloc;
+  allocator_class->free = gst_numa_mem_free;
+
+  GST_DEBUG_CATEGORY_INIT (gst_numamemory_debug, "numamemory", 0,
+      "GstNumaMemory and GstNumaAllocator");
+}
+
+static void
+gst_numa_allocator_init (GstNumaAllocator * allocator)
+{
+  GstAllocator *alloc = GST_ALLOCATOR_CAST (allocator);
+
+  alloc->mem_type = GST_ALLOCATOR_NUMA;
+
+  alloc->mem_map = gst_numa_mem_map;
+  alloc->mem_unmap = gst_numa_mem_unmap;
+  alloc->mem_share = gst_numa_mem_share;
+  alloc->mem_is_span = gst_numa_mem_is_span;
+
+  allocator->node = -1;
+}
+
+/**
+ * gst_numa_allocator_new:
+ * @node: the NUMA node to bind allocations to, or -1 for no binding
+ *
+ * Return a new NUMA allocator for @node. Usually
+ * gst_numa_allocator_obtain() is a better fit as it shares one allocator
+ * per node and registers it for lookup by name.
+ *
+ * Returns: (transfer full): a new NUMA allocator. Use gst_object_unref()
+ *    to release the allocator after usage
+ *
+ * Since: 1.22
+ */
+GstAllocator *
+gst_numa_allocator_new (gint node)
+{
+  GstNumaAllocator *alloc;
+
+  alloc = g_object_new (GST_TYPE_NUMA_ALLOCATOR, NULL);
+  gst_object_ref_sink (alloc);
+
+  alloc->node = node;
+
+  return GST_ALLOCATOR_CAST (alloc);
+}
+
+/**
+ * gst_numa_allocator_obtain:
+ * @node: the NUMA node to bind allocations to
+ *
+ * Returns the allocator for @node, creating and registering it under the
+ * name "numa&lt;node&gt;" on the first call. The registered name can then
+ * also be used with gst_allocator_find(), e.g. from elements that resolve
+ * their allocator through negotiation.
+ *
+ * Returns: (transfer full): the NUMA allocator for @node. Use
+ *    gst_object_unref() to release the allocator after usage
+ *
+ * Since: 1.22
+ */
+GstAllocator *
+gst_numa_allocator_obtain (gint node)
+{
+  GstAllocator *alloc;
+  gchar *name;
+
+  g_return_val_if_fail (node >= 0, NULL);
+
+  name = g_strdup_printf ("numa%d", node);
+
+  alloc = gst_allocator_find (name);
+  if (alloc == NULL) {
+    alloc = gst_numa_allocator_new (node);
+    /* the registry takes a ref, ours is returned to the caller */
+    gst_allocator_register (name, gst_object_ref (alloc));
+  }
+
+  g_free (name);
+
+  return alloc;
+}
+
+/**
+ * gst_is_numa_memory:
+ * @mem: #GstMemory
+ *
+ * Check if @mem was allocated by a #GstNumaAllocator.
+ *
+ * Returns: %TRUE when @mem is bound to a NUMA node that can be retrieved
+ * with gst_numa_memory_get_node().
+ *
+ * Since: 1.22
+ */
+gboolean
+gst_is_numa_memory (GstMemory * mem)
+{
+  g_return_val_if_fail (mem != NULL, FALSE);
+
+  return GST_IS_NUMA_ALLOCATOR (mem->allocator);
+}
+
+/**
+ * gst_numa_memory_get_node:
+ * @mem: #GstMemory
+ *
+ * Get the NUMA node @mem is bound to. Call gst_is_numa_memory() to check
+ * if @mem is NUMA memory.
+ *
+ * Returns: the node of @mem or -1 when @mem is not bound to a node
+ *
+ * Since: 1.22
+ */
+gint
+gst_numa_memory_get_node (GstMemory * mem)
+{
+  g_return_val_if_fail (mem != NULL, -1);
+  g_return_val_if_fail (GST_IS_NUMA_ALLOCATOR (mem->allocator), -1);
+
+  return ((GstNumaMemory *) mem)->node;
+}
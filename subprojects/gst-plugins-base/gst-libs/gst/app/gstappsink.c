@@ -37,6 +37,9 @@
  * sink is shut down or reaches EOS. There are also timed variants of these
  * methods, gst_app_sink_try_pull_sample() and gst_app_sink_try_pull_preroll(),
  * which accept a timeout parameter to limit the amount of time to wait.
+ * Applications that consume many small samples can use
+ * gst_app_sink_try_pull_samples() to dequeue a whole batch of samples with a
+ * single lock round-trip.
  *
  * Appsink will internally use a queue to collect buffers from the streaming
  * thread. If the application is not pulling samples fast enough, this queue
@@ -1960,6 +1963,137 @@ not_started:
   }
 }
 
+/**
+ * gst_app_sink_try_pull_samples:
+ * @appsink: a #GstAppSink
+ * @samples: (array length=max_samples) (out caller-allocates): an array to
+ *     store the pulled samples in
+ * @max_samples: the size of @samples
+ * @timeout: the maximum amount of time to wait for the first sample
+ *
+ * This function blocks until at least one sample or EOS becomes available or
+ * the appsink element is set to the READY/NULL state or the timeout expires.
+ *
+ * Once a sample is available, up to @max_samples queued samples are dequeued
+ * and stored in @samples in one go, so applications pulling many small
+ * buffers only pay the locking overhead once per batch instead of once per
+ * sample. The function never waits for more samples than are already queued;
+ * it returns as soon as the queue runs empty.
+ *
+ * Serialized events in the queue are processed and discarded, like
+ * gst_app_sink_try_pull_sample() does. Use gst_app_sink_try_pull_object() if
+ * the events are of interest.
+ *
+ * If an EOS event was received before any buffers or the timeout expires,
+ * this function returns 0. Use gst_app_sink_is_eos () to check for the EOS
+ * condition.
+ *
+ * Returns: the number of samples stored in @samples. Call gst_sample_unref()
+ *     on each of them after usage.
+ *
+ * Since: 1.22
+ */
+guint
+gst_app_sink_try_pull_samples (GstAppSink * appsink, GstSample ** samples,
+    guint max_samples, GstClockTime timeout)
+{
+  GstAppSinkPrivate *priv;
+  guint n = 0;
+  gboolean timeout_valid;
+  gint64 end_time;
+
+  g_return_val_if_fail (GST_IS_APP_SINK (appsink), 0);
+  g_return_val_if_fail (samples != NULL, 0);
+  g_return_val_if_fail (max_samples > 0, 0);
+
+  timeout_valid = GST_CLOCK_TIME_IS_VALID (timeout);
+
+  if (timeout_valid)
+    end_time =
+        g_get_monotonic_time () + timeout / (GST_SECOND / G_TIME_SPAN_SECOND);
+
+  priv = appsink->priv;
+
+  g_mutex_lock (&priv->mutex);
+  gst_buffer_replace (&priv->preroll_buffer, NULL);
+
+  while (n == 0) {
+    GST_DEBUG_OBJECT (appsink, "trying to grab a batch of samples");
+    if (!priv->started)
+      goto not_started;
+
+    if (priv->num_buffers == 0 && priv->num_events == 0) {
+      if (priv->is_eos)
+        goto eos;
+
+      /* nothing to return, wait */
+      GST_DEBUG_OBJECT (appsink, "waiting for an object");
+      priv->wait_status |= APP_WAITING;
+      if (timeout_valid) {
+        if (!g_cond_wait_until (&priv->cond, &priv->mutex, end_time))
+          goto expired;
+      } else {
+        g_cond_wait (&priv->cond, &priv->mutex);
+      }
+      priv->wait_status &= ~APP_WAITING;
+      continue;
+    }
+
+    /* drain what is queued without waiting for more */
+    while (n < max_samples && (priv->num_buffers > 0 || priv->num_events > 0)) {
+      GstMiniObject *obj = dequeue_object (appsink);
+
+      if (GST_IS_BUFFER (obj)) {
+        GST_DEBUG_OBJECT (appsink, "we have a buffer %p", obj);
+        samples[n++] = gst_sample_new (GST_BUFFER_CAST (obj), priv->last_caps,
+            &priv->last_segment, NULL);
+        gst_mini_object_unref (obj);
+      } else if (GST_IS_BUFFER_LIST (obj)) {
+        GstSample *sample;
+
+        GST_DEBUG_OBJECT (appsink, "we have a list %p", obj);
+        sample =
+            gst_sample_new (NULL, priv->last_caps, &priv->last_segment, NULL);
+        gst_sample_set_buffer_list (sample, GST_BUFFER_LIST_CAST (obj));
+        samples[n++] = sample;
+        gst_mini_object_unref (obj);
+      } else {
+        /* events that do not become part of a sample are dropped, just like
+         * gst_app_sink_try_pull_sample() does */
+        gst_mini_object_unref (obj);
+      }
+    }
+  }
+
+  if ((priv->wait_status & STREAM_WAITING))
+    g_cond_signal (&priv->cond);
+
+  g_mutex_unlock (&priv->mutex);
+
+  return n;
+
+  /* special conditions */
+expired:
+  {
+    GST_DEBUG_OBJECT (appsink, "timeout expired, return 0");
+    priv->wait_status &= ~APP_WAITING;
+    g_mutex_unlock (&priv->mutex);
+    return 0;
+  }
+eos:
+  {
+    GST_DEBUG_OBJECT (appsink, "we are EOS, return 0");
+    g_mutex_unlock (&priv->mutex);
+    return 0;
+  }
+not_started:
+  {
+    GST_DEBUG_OBJECT (appsink, "we are stopped, return 0");
+    g_mutex_unlock (&priv->mutex);
+    return 0;
+  }
+}
+
 /**
  * gst_app_sink_set_callbacks: (skip)
  * @appsink: a #GstAppSink
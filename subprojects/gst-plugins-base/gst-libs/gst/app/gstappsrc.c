@@ -185,6 +185,9 @@ struct _GstAppSrcPrivate
   guint64 max_latency;
   gboolean emit_signals;
   guint min_percent;
+  /* whether need-data was already emitted for dropping below min-percent
+   * and the application has not pushed anything since */
+  gboolean need_data_pending;
   gboolean handle_segment_change;
 
   GstAppLeakyType leaky_type;
@@ -782,6 +785,7 @@ gst_app_src_flush_queued (GstAppSrc * src, gboolean retain_last_caps)
   priv->last_out_running_time = GST_CLOCK_TIME_NONE;
   priv->need_discont_upstream = FALSE;
   priv->need_discont_downstream = FALSE;
+  priv->need_data_pending = FALSE;
 }
 
 static void
@@ -1497,6 +1501,7 @@ gst_app_src_update_queued_push (GstAppSrc * appsrc, GstMiniObject * item)
 
   priv->queued_bytes += buf_size;
   priv->queued_buffers += n_buffers;
+  priv->need_data_pending = FALSE;
 
   /* Update time level if working on a TIME segment */
   if (priv->last_segment.format == GST_FORMAT_TIME
@@ -1731,8 +1736,11 @@ gst_app_src_create (GstBaseSrc * bsrc, guint64 offset, guint size,
       if ((priv->wait_status & APP_WAITING))
         g_cond_broadcast (&priv->cond);
 
-      /* see if we go lower than the min-percent */
-      if (priv->min_percent) {
+      /* see if we go lower than the min-percent. Only emit once per
+       * watermark crossing; pushing new data re-arms the emission so a
+       * responsive application keeps getting updates while an unresponsive
+       * one is not signalled again on every single pop */
+      if (priv->min_percent && !priv->need_data_pending) {
         if ((priv->max_bytes
                 && priv->queued_bytes * 100 / priv->max_bytes <=
                 priv->min_percent) || (priv->max_buffers
@@ -1740,6 +1748,7 @@ gst_app_src_create (GstBaseSrc * bsrc, guint64 offset, guint size,
                 priv->min_percent) || (priv->max_time
                 && priv->queued_time * 100 / priv->max_time <=
                 priv->min_percent)) {
+          priv->need_data_pending = TRUE;
           /* ignore flushing state, we got a buffer and we will return it now.
            * Errors will be handled in the next round */
           gst_app_src_emit_need_data (appsrc, size);
@@ -181,6 +181,9 @@ struct _AudioChain
 
   gboolean pass_alloc;
   gboolean allow_ip;
+  /* the consumer of our samples only reads them, so a non-writable input
+   * can be passed through without first copying it */
+  gboolean ro_input;
 
   AudioChainAllocFunc alloc_func;
   gpointer alloc_data;
@@ -451,7 +454,11 @@ do_unpack (AudioChain * chain, gpointer user_data)
   in_writable = convert->in_writable;
   num_samples = convert->in_frames;
 
-  if (!chain->allow_ip || !in_writable || !convert->in_default) {
+  if (convert->in_data && convert->in_default &&
+      ((in_writable && chain->allow_ip) || chain->ro_input)) {
+    tmp = convert->in_data;
+    GST_LOG ("get in samples %p", tmp);
+  } else {
     gint i;
 
     if (in_writable && chain->allow_ip) {
@@ -482,9 +489,6 @@ do_unpack (AudioChain * chain, gpointer user_data)
             num_samples * chain->inc);
       }
     }
-  } else {
-    tmp = convert->in_data;
-    GST_LOG ("get in samples %p", tmp);
   }
   audio_chain_set_samples (chain, tmp, num_samples);
 
@@ -1038,7 +1042,7 @@ chain_pack (GstAudioConverter * convert, AudioChain * prev)
 static void
 setup_allocators (GstAudioConverter * convert)
 {
-  AudioChain *chain;
+  AudioChain *chain, *unpack, *consumer;
   AudioChainAllocFunc alloc_func;
   gboolean allow_ip;
 
@@ -1064,6 +1068,21 @@ setup_allocators (GstAudioConverter * convert)
       allow_ip = TRUE;
     }
   }
+
+  /* the unpack chain is the only one that can use the input samples
+   * directly. When the stage consuming them does not write into them (it
+   * makes its own output), a non-writable input can be passed through
+   * without first copying it to a temp buffer. Without a consumer, only
+   * the final pack reads the samples, unless they would have to double as
+   * the output. */
+  consumer = NULL;
+  for (unpack = convert->chain_end; unpack->prev; unpack = unpack->prev)
+    consumer = unpack;
+
+  if (consumer)
+    unpack->ro_input = !consumer->allow_ip;
+  else
+    unpack->ro_input = !convert->out_default;
 }
 
 static gboolean
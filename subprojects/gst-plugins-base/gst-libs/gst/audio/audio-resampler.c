@@ -1508,10 +1508,14 @@ gst_audio_resampler_update (GstAudioResampler * resampler,
     gint in_rate, gint out_rate, GstStructure * options)
 {
   gint gcd, samp_phase, old_n_taps;
+  gint prev_in_rate, prev_out_rate;
   gdouble max_error;
 
   g_return_val_if_fail (resampler != NULL, FALSE);
 
+  prev_in_rate = resampler->in_rate;
+  prev_out_rate = resampler->out_rate;
+
   if (in_rate <= 0)
     in_rate = resampler->in_rate;
   if (out_rate <= 0)
@@ -1564,6 +1568,17 @@ gst_audio_resampler_update (GstAudioResampler * resampler,
   resampler->samp_frac = in_rate % out_rate;
 
   if (options) {
+    /* elements tend to re-send their options on every renegotiation; if
+     * neither the (reduced) rates nor the options actually changed, the
+     * filter is still valid and rebuilding it would only stall the
+     * streaming thread */
+    if (resampler->options && in_rate == prev_in_rate
+        && out_rate == prev_out_rate
+        && gst_structure_is_equal (options, resampler->options)) {
+      GST_INFO ("rates and options unchanged, keeping filter");
+      return TRUE;
+    }
+
     GST_INFO ("have new options, reconfigure filter");
 
     if (resampler->options)
@@ -66,8 +66,41 @@ struct _GstFFTS32
   void *cfg;
   gboolean inverse;
   gint len;
+  /* cached window coefficients; computing them costs a cos() per sample,
+   * which would otherwise be paid again on every call */
+  gdouble *window_tab;
+  GstFFTWindow window_type;
 };
 
+static void
+gst_fft_window_tab_fill (gdouble * tab, gint len, GstFFTWindow window)
+{
+  gint i;
+
+  switch (window) {
+    case GST_FFT_WINDOW_HAMMING:
+      for (i = 0; i < len; i++)
+        tab[i] = (0.53836 - 0.46164 * cos (2.0 * G_PI * i / len));
+      break;
+    case GST_FFT_WINDOW_HANN:
+      for (i = 0; i < len; i++)
+        tab[i] = (0.5 - 0.5 * cos (2.0 * G_PI * i / len));
+      break;
+    case GST_FFT_WINDOW_BARTLETT:
+      for (i = 0; i < len; i++)
+        tab[i] = (1.0 - fabs ((2.0 * i - len) / len));
+      break;
+    case GST_FFT_WINDOW_BLACKMAN:
+      for (i = 0; i < len; i++)
+        tab[i] = (0.42 - 0.5 * cos ((2.0 * i) / len) +
+            0.08 * cos ((4.0 * i) / len));
+      break;
+    default:
+      g_assert_not_reached ();
+      break;
+  }
+}
+
 /**
  * gst_fft_s32_new: (skip)
  * @len: Length of the FFT in the time domain
@@ -169,6 +202,7 @@ gst_fft_s32_inverse_fft (GstFFTS32 * self, const GstFFTS32Complex * freqdata,
 void
 gst_fft_s32_free (GstFFTS32 * self)
 {
+  g_free (self->window_tab);
   g_free (self);
 }
 
@@ -191,29 +225,17 @@ gst_fft_s32_window (GstFFTS32 * self, gint32 * timedata, GstFFTWindow window)
 
   len = self->len;
 
-  switch (window) {
-    case GST_FFT_WINDOW_RECTANGULAR:
-      /* do nothing */
-      break;
-    case GST_FFT_WINDOW_HAMMING:
-      for (i = 0; i < len; i++)
-        timedata[i] *= (0.53836 - 0.46164 * cos (2.0 * G_PI * i / len));
-      break;
-    case GST_FFT_WINDOW_HANN:
-      for (i = 0; i < len; i++)
-        timedata[i] *= (0.5 - 0.5 * cos (2.0 * G_PI * i / len));
-      break;
-    case GST_FFT_WINDOW_BARTLETT:
-      for (i = 0; i < len; i++)
-        timedata[i] *= (1.0 - fabs ((2.0 * i - len) / len));
-      break;
-    case GST_FFT_WINDOW_BLACKMAN:
-      for (i = 0; i < len; i++)
-        timedata[i] *= (0.42 - 0.5 * cos ((2.0 * i) / len) +
-            0.08 * cos ((4.0 * i) / len));
-      break;
-    default:
-      g_assert_not_reached ();
-      break;
+  if (window == GST_FFT_WINDOW_RECTANGULAR)
+    /* do nothing */
+    return;
+
+  if (self->window_tab == NULL || self->window_type != window) {
+    if (self->window_tab == NULL)
+      self->window_tab = g_new (gdouble, len);
+    gst_fft_window_tab_fill (self->window_tab, len, window);
+    self->window_type = window;
   }
+
+  for (i = 0; i < len; i++)
+    timedata[i] *= self->window_tab[i];
 }
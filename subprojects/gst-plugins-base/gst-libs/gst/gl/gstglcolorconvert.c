@@ -566,6 +566,10 @@ struct _GstGLColorConvertPrivate
 
   GstBufferPool *pool;
   gboolean pool_started;
+
+  /* gchar * (fragment source) -> GstGLShader *, so that renegotiating
+   * between the same formats does not recompile the same program */
+  GHashTable *shader_cache;
 };
 
 GST_DEBUG_CATEGORY_STATIC (gst_gl_color_convert_debug);
@@ -634,6 +638,8 @@ gst_gl_color_convert_finalize (GObject * object)
 
   gst_gl_color_convert_reset (convert);
 
+  g_clear_pointer (&convert->priv->shader_cache, g_hash_table_unref);
+
   if (convert->context) {
     gst_object_unref (convert->context);
     convert->context = NULL;
@@ -2335,16 +2341,15 @@ _create_shader (GstGLColorConvert * convert)
   GString *str = g_string_new (NULL);
   GstGLShader *ret = NULL;
   GstGLSLStage *stage;
-  GstGLSLVersion version;
-  GstGLSLProfile profile;
-  gchar *version_str, *tmp, *tmp1;
+  GstGLSLVersion version, frag_version;
+  GstGLSLProfile profile, frag_profile;
+  gchar *version_str, *vert_str, *tmp, *tmp1;
+  gboolean bind_frag_data = FALSE;
   const gchar *strings[3];
   GError *error = NULL;
   int i;
 
-  ret = gst_gl_shader_new (convert->context);
-
-  tmp =
+  vert_str =
       _gst_glsl_mangle_shader (text_vertex_shader, GL_VERTEX_SHADER,
       info->templ->target, convert->priv->from_texture_target, convert->context,
       &version, &profile);
@@ -2353,28 +2358,6 @@ _create_shader (GstGLColorConvert * convert)
   version_str = g_strdup_printf ("#version %s\n", tmp1);
   g_free (tmp1);
 
-  strings[0] = version_str;
-  strings[1] = tmp;
-  if (!(stage = gst_glsl_stage_new_with_strings (convert->context,
-              GL_VERTEX_SHADER, version, profile, 2, strings))) {
-    GST_ERROR_OBJECT (convert, "Failed to create vertex stage");
-    g_free (version_str);
-    g_free (tmp);
-    gst_object_unref (ret);
-    return NULL;
-  }
-  g_free (tmp);
-
-  if (!gst_gl_shader_compile_attach_stage (ret, stage, &error)) {
-    GST_ERROR_OBJECT (convert, "Failed to compile vertex shader %s",
-        error->message);
-    g_clear_error (&error);
-    g_free (version_str);
-    gst_object_unref (stage);
-    gst_object_unref (ret);
-    return NULL;
-  }
-
   if (info->templ->extensions)
     g_string_append (str, info->templ->extensions);
 
@@ -2406,19 +2389,16 @@ _create_shader (GstGLColorConvert * convert)
     }
   } else if (profile == GST_GLSL_PROFILE_CORE
       && version >= GST_GLSL_VERSION_150) {
-    /* no layout specifiers, use glBindFragDataLocation instead */
+    /* no layout specifiers, use glBindFragDataLocation instead once the
+     * program object exists */
+    bind_frag_data = TRUE;
     if (info->out_n_textures > 1) {
       gint i;
 
-      for (i = 0; i < info->out_n_textures; i++) {
-        gchar *var_name = g_strdup_printf ("fragColor_%d", i);
-        g_string_append_printf (str, "out vec4 %s;\n", var_name);
-        gst_gl_shader_bind_frag_data_location (ret, i, var_name);
-        g_free (var_name);
-      }
+      for (i = 0; i < info->out_n_textures; i++)
+        g_string_append_printf (str, "out vec4 fragColor_%d;\n", i);
     } else {
       g_string_append (str, "out vec4 fragColor;\n");
-      gst_gl_shader_bind_frag_data_location (ret, 0, "fragColor");
     }
   }
 
@@ -2459,12 +2439,63 @@ _create_shader (GstGLColorConvert * convert)
   tmp = g_string_free (str, FALSE);
   info->frag_prog = _gst_glsl_mangle_shader (tmp, GL_FRAGMENT_SHADER,
       info->templ->target, convert->priv->from_texture_target, convert->context,
-      &version, &profile);
+      &frag_version, &frag_profile);
   g_free (tmp);
 
+  /* renegotiation commonly toggles between the same few formats; reuse an
+   * already linked program for identical sources instead of recompiling */
+  if (convert->priv->shader_cache && (ret =
+          g_hash_table_lookup (convert->priv->shader_cache,
+              info->frag_prog))) {
+    GST_DEBUG_OBJECT (convert, "reusing cached shader %" GST_PTR_FORMAT, ret);
+    g_free (version_str);
+    g_free (vert_str);
+    return gst_object_ref (ret);
+  }
+
+  ret = gst_gl_shader_new (convert->context);
+
+  strings[0] = version_str;
+  strings[1] = vert_str;
+  if (!(stage = gst_glsl_stage_new_with_strings (convert->context,
+              GL_VERTEX_SHADER, version, profile, 2, strings))) {
+    GST_ERROR_OBJECT (convert, "Failed to create vertex stage");
+    g_free (info->frag_prog);
+    info->frag_prog = NULL;
+    g_free (version_str);
+    g_free (vert_str);
+    gst_object_unref (ret);
+    return NULL;
+  }
+  g_free (vert_str);
+
+  if (!gst_gl_shader_compile_attach_stage (ret, stage, &error)) {
+    GST_ERROR_OBJECT (convert, "Failed to compile vertex shader %s",
+        error->message);
+    g_clear_error (&error);
+    g_free (info->frag_prog);
+    info->frag_prog = NULL;
+    g_free (version_str);
+    gst_object_unref (stage);
+    gst_object_unref (ret);
+    return NULL;
+  }
+
+  if (bind_frag_data) {
+    if (info->out_n_textures > 1) {
+      for (i = 0; i < info->out_n_textures; i++) {
+        gchar *var_name = g_strdup_printf ("fragColor_%d", i);
+        gst_gl_shader_bind_frag_data_location (ret, i, var_name);
+        g_free (var_name);
+      }
+    } else {
+      gst_gl_shader_bind_frag_data_location (ret, 0, "fragColor");
+    }
+  }
+
   strings[1] = info->frag_prog;
   if (!(stage = gst_glsl_stage_new_with_strings (convert->context,
-              GL_FRAGMENT_SHADER, version, profile, 2, strings))) {
+              GL_FRAGMENT_SHADER, frag_version, frag_profile, 2, strings))) {
     GST_ERROR_OBJECT (convert, "Failed to create fragment stage");
     g_free (info->frag_prog);
     info->frag_prog = NULL;
@@ -2493,6 +2524,12 @@ _create_shader (GstGLColorConvert * convert)
     return NULL;
   }
 
+  if (!convert->priv->shader_cache)
+    convert->priv->shader_cache = g_hash_table_new_full (g_str_hash,
+        g_str_equal, g_free, gst_object_unref);
+  g_hash_table_insert (convert->priv->shader_cache,
+      g_strdup (info->frag_prog), gst_object_ref (ret));
+
   return ret;
 }
 
@@ -1234,6 +1234,9 @@ struct RawUpload
   GstGLUpload *upload;
   struct RawUploadFrame *in_frame;
   GstGLVideoAllocationParams *params;
+  GstGLBaseMemoryAllocator *allocator;
+  /* the context @allocator was looked up for, without a ref */
+  GstGLContext *allocator_context;
 };
 
 static struct RawUploadFrame *
@@ -1373,21 +1376,26 @@ static GstGLUploadReturn
 _raw_data_upload_perform (gpointer impl, GstBuffer * buffer,
     GstBuffer ** outbuf)
 {
-  GstGLBaseMemoryAllocator *allocator;
   struct RawUpload *raw = impl;
   int i;
   GstVideoInfo *in_info = &raw->upload->priv->in_info;
   guint n_mem = GST_VIDEO_INFO_N_PLANES (in_info);
 
-  allocator =
-      GST_GL_BASE_MEMORY_ALLOCATOR (gst_gl_memory_allocator_get_default
-      (raw->upload->context));
+  /* the default allocator never changes for a context, look it up once
+   * instead of on every frame */
+  if (!raw->allocator || raw->allocator_context != raw->upload->context) {
+    gst_clear_object (&raw->allocator);
+    raw->allocator =
+        GST_GL_BASE_MEMORY_ALLOCATOR (gst_gl_memory_allocator_get_default
+        (raw->upload->context));
+    raw->allocator_context = raw->upload->context;
+  }
 
   /* FIXME Use a buffer pool to cache the generated textures */
   *outbuf = gst_buffer_new ();
   raw->params->parent.context = raw->upload->context;
-  if (gst_gl_memory_setup_buffer ((GstGLMemoryAllocator *) allocator, *outbuf,
-          raw->params, NULL, raw->in_frame->frame.data, n_mem)) {
+  if (gst_gl_memory_setup_buffer ((GstGLMemoryAllocator *) raw->allocator,
+          *outbuf, raw->params, NULL, raw->in_frame->frame.data, n_mem)) {
 
     for (i = 0; i < n_mem; i++)
       _raw_upload_frame_ref (raw->in_frame);
@@ -1395,10 +1403,8 @@ _raw_data_upload_perform (gpointer impl, GstBuffer * buffer,
   } else {
     GST_ERROR_OBJECT (raw->upload, "Failed to allocate wrapped texture");
     gst_buffer_unref (*outbuf);
-    gst_object_unref (allocator);
     return GST_GL_UPLOAD_ERROR;
   }
-  gst_object_unref (allocator);
   _raw_upload_frame_unref (raw->in_frame);
   raw->in_frame = NULL;
 
@@ -1412,6 +1418,7 @@ _raw_data_upload_free (gpointer impl)
 
   if (raw->params)
     gst_gl_allocation_params_free ((GstGLAllocationParams *) raw->params);
+  gst_clear_object (&raw->allocator);
 
   g_free (raw);
 }
@@ -2251,20 +2258,27 @@ static GMutex upload_global_lock;
 GstCaps *
 gst_gl_upload_get_input_template_caps (void)
 {
-  GstCaps *ret = NULL;
-  gint i;
+  /* upload_methods is fixed at compile time, so the merged template caps
+   * can be computed once and handed out by reference afterwards */
+  static GstCaps *template_caps = NULL;
+  GstCaps *ret;
 
   g_mutex_lock (&upload_global_lock);
 
-  /* FIXME: cache this and invalidate on changes to upload_methods */
-  for (i = 0; i < G_N_ELEMENTS (upload_methods); i++) {
-    GstCaps *template =
-        gst_static_caps_get (upload_methods[i]->input_template_caps);
-    ret = ret == NULL ? template : gst_caps_merge (ret, template);
-  }
+  if (!template_caps) {
+    gint i;
 
-  ret = gst_caps_simplify (ret);
-  ret = gst_gl_overlay_compositor_add_caps (ret);
+    ret = NULL;
+    for (i = 0; i < G_N_ELEMENTS (upload_methods); i++) {
+      GstCaps *template =
+          gst_static_caps_get (upload_methods[i]->input_template_caps);
+      ret = ret == NULL ? template : gst_caps_merge (ret, template);
+    }
+
+    ret = gst_caps_simplify (ret);
+    template_caps = gst_gl_overlay_compositor_add_caps (ret);
+  }
+  ret = gst_caps_ref (template_caps);
   g_mutex_unlock (&upload_global_lock);
 
   return ret;
@@ -143,9 +143,11 @@ struct _GstDiscovererPrivate
   gulong no_more_pads_id;
   gulong source_chg_id;
   gulong element_added_id;
+  gulong autoplug_continue_id;
   gulong bus_cb_id;
 
   gboolean use_cache;
+  gboolean parse_only;
 };
 
 #define DISCO_LOCK(dc) g_mutex_lock (&dc->priv->lock);
@@ -180,12 +182,14 @@ enum
 
 #define DEFAULT_PROP_TIMEOUT 15 * GST_SECOND
 #define DEFAULT_PROP_USE_CACHE FALSE
+#define DEFAULT_PROP_PARSE_ONLY FALSE
 
 enum
 {
   PROP_0,
   PROP_TIMEOUT,
-  PROP_USE_CACHE
+  PROP_USE_CACHE,
+  PROP_PARSE_ONLY
 };
 
 static guint gst_discoverer_signals[LAST_SIGNAL] = { 0 };
@@ -204,6 +208,8 @@ static void uridecodebin_no_more_pads_cb (GstElement * uridecodebin,
     GstDiscoverer * dc);
 static void uridecodebin_source_changed_cb (GstElement * uridecodebin,
     GParamSpec * pspec, GstDiscoverer * dc);
+static gboolean uridecodebin_autoplug_continue_cb (GstElement * uridecodebin,
+    GstPad * pad, GstCaps * caps, GstDiscoverer * dc);
 
 static void gst_discoverer_dispose (GObject * dc);
 static void gst_discoverer_finalize (GObject * dc);
@@ -264,6 +270,24 @@ gst_discoverer_class_init (GstDiscovererClass * klass)
           DEFAULT_PROP_USE_CACHE,
           G_PARAM_READWRITE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstDiscoverer::parse-only:
+   *
+   * Whether to stop the discovery at parsed but undecoded elementary
+   * streams instead of plugging decoders. This makes the discovery
+   * considerably faster since no decoders are instantiated and no frames
+   * are decoded during preroll, at the cost of the information that only
+   * decoding can provide (e.g. properties that parsers do not put on the
+   * caps).
+   *
+   * Since: 1.22
+   */
+  g_object_class_install_property (gobject_class, PROP_PARSE_ONLY,
+      g_param_spec_boolean ("parse-only", "parse only",
+          "Stop the discovery at parsed streams without plugging decoders",
+          DEFAULT_PROP_PARSE_ONLY,
+          G_PARAM_READWRITE | G_PARAM_CONSTRUCT | G_PARAM_STATIC_STRINGS));
+
   /* signals */
   /**
    * GstDiscoverer::finished:
@@ -350,6 +374,7 @@ gst_discoverer_init (GstDiscoverer * dc)
 
   dc->priv->timeout = DEFAULT_PROP_TIMEOUT;
   dc->priv->use_cache = DEFAULT_PROP_USE_CACHE;
+  dc->priv->parse_only = DEFAULT_PROP_PARSE_ONLY;
   dc->priv->async = FALSE;
 
   g_mutex_init (&dc->priv->lock);
@@ -387,6 +412,9 @@ gst_discoverer_init (GstDiscoverer * dc)
   dc->priv->source_chg_id =
       g_signal_connect_object (dc->priv->uridecodebin, "notify::source",
       G_CALLBACK (uridecodebin_source_changed_cb), dc, 0);
+  dc->priv->autoplug_continue_id =
+      g_signal_connect_object (dc->priv->uridecodebin, "autoplug-continue",
+      G_CALLBACK (uridecodebin_autoplug_continue_cb), dc, 0);
 
   GST_LOG_OBJECT (dc, "Getting pipeline bus");
   dc->priv->bus = gst_pipeline_get_bus ((GstPipeline *) dc->priv->pipeline);
@@ -448,6 +476,7 @@ gst_discoverer_dispose (GObject * obj)
     DISCONNECT_SIGNAL (dc->priv->uridecodebin, dc->priv->no_more_pads_id);
     DISCONNECT_SIGNAL (dc->priv->uridecodebin, dc->priv->source_chg_id);
     DISCONNECT_SIGNAL (dc->priv->uridecodebin, dc->priv->element_added_id);
+    DISCONNECT_SIGNAL (dc->priv->uridecodebin, dc->priv->autoplug_continue_id);
     DISCONNECT_SIGNAL (dc->priv->bus, dc->priv->bus_cb_id);
 
     /* pipeline was set to NULL in _reset */
@@ -495,6 +524,11 @@ gst_discoverer_set_property (GObject * object, guint prop_id,
       dc->priv->use_cache = g_value_get_boolean (value);
       DISCO_UNLOCK (dc);
       break;
+    case PROP_PARSE_ONLY:
+      DISCO_LOCK (dc);
+      dc->priv->parse_only = g_value_get_boolean (value);
+      DISCO_UNLOCK (dc);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -518,6 +552,11 @@ gst_discoverer_get_property (GObject * object, guint prop_id,
       g_value_set_boolean (value, dc->priv->use_cache);
       DISCO_UNLOCK (dc);
       break;
+    case PROP_PARSE_ONLY:
+      DISCO_LOCK (dc);
+      g_value_set_boolean (value, dc->priv->parse_only);
+      DISCO_UNLOCK (dc);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -645,6 +684,37 @@ uridecodebin_source_changed_cb (GstElement * uridecodebin,
   gst_object_unref (src);
 }
 
+static gboolean
+uridecodebin_autoplug_continue_cb (GstElement * uridecodebin, GstPad * pad,
+    GstCaps * caps, GstDiscoverer * dc)
+{
+  GstStructure *s;
+  gboolean parsed = FALSE, framed = FALSE;
+  gboolean parse_only;
+
+  DISCO_LOCK (dc);
+  parse_only = dc->priv->parse_only;
+  DISCO_UNLOCK (dc);
+
+  if (!parse_only)
+    return TRUE;
+
+  /* In parse-only mode, stop autoplugging as soon as we have a parsed
+   * elementary stream so no decoder is plugged and no frame is decoded
+   * during preroll */
+  s = gst_caps_get_structure (caps, 0);
+  gst_structure_get_boolean (s, "parsed", &parsed);
+  gst_structure_get_boolean (s, "framed", &framed);
+
+  if (parsed || framed) {
+    GST_DEBUG_OBJECT (dc, "Stopping autoplugging at parsed caps %"
+        GST_PTR_FORMAT, caps);
+    return FALSE;
+  }
+
+  return TRUE;
+}
+
 static void
 uridecodebin_pad_added_cb (GstElement * uridecodebin, GstPad * pad,
     GstDiscoverer * dc)
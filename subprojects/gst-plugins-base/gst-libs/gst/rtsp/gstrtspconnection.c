@@ -188,6 +188,13 @@ struct _GstRTSPConnection
   gchar *initial_buffer;
   gsize initial_buffer_offset;
 
+  /* bulk read buffer. small reads (message headers, interleaved frame
+   * markers) are served from here so that parsing a message does not cost
+   * one socket read per byte */
+  guint8 read_buffer[4096];
+  guint read_buffer_pos;
+  guint read_buffer_fill;
+
   gboolean remember_session_id; /* remember the session id or not */
 
   /* Session state */
@@ -1419,16 +1426,48 @@ fill_raw_bytes (GstRTSPConnection * conn, guint8 * buffer, guint size,
       conn->initial_buffer_offset += out;
   }
 
+  /* then serve data left over from a previous bulk read */
+  if (conn->read_buffer_pos < conn->read_buffer_fill) {
+    guint left = conn->read_buffer_fill - conn->read_buffer_pos;
+    guint n = MIN (left, size - (guint) out);
+
+    memcpy (&buffer[out], &conn->read_buffer[conn->read_buffer_pos], n);
+    conn->read_buffer_pos += n;
+    out += n;
+  }
+
   if (G_LIKELY (size > (guint) out)) {
     gssize r;
     gsize count = size - out;
-    if (block)
-      r = g_input_stream_read (conn->input_stream, (gchar *) & buffer[out],
-          count, conn->may_cancel ? conn->cancellable : NULL, err);
-    else
-      r = g_pollable_input_stream_read_nonblocking (G_POLLABLE_INPUT_STREAM
-          (conn->input_stream), (gchar *) & buffer[out], count,
-          conn->may_cancel ? conn->cancellable : NULL, err);
+
+    if (count < sizeof (conn->read_buffer)) {
+      /* small read, pull in as much as the socket has in one go and serve
+       * the remainder from the read buffer on the next calls */
+      if (block)
+        r = g_input_stream_read (conn->input_stream,
+            (gchar *) conn->read_buffer, sizeof (conn->read_buffer),
+            conn->may_cancel ? conn->cancellable : NULL, err);
+      else
+        r = g_pollable_input_stream_read_nonblocking (G_POLLABLE_INPUT_STREAM
+            (conn->input_stream), (gchar *) conn->read_buffer,
+            sizeof (conn->read_buffer),
+            conn->may_cancel ? conn->cancellable : NULL, err);
+
+      if (r > 0) {
+        conn->read_buffer_fill = r;
+        r = MIN ((gsize) r, count);
+        memcpy (&buffer[out], conn->read_buffer, r);
+        conn->read_buffer_pos = r;
+      }
+    } else {
+      if (block)
+        r = g_input_stream_read (conn->input_stream, (gchar *) & buffer[out],
+            count, conn->may_cancel ? conn->cancellable : NULL, err);
+      else
+        r = g_pollable_input_stream_read_nonblocking (G_POLLABLE_INPUT_STREAM
+            (conn->input_stream), (gchar *) & buffer[out], count,
+            conn->may_cancel ? conn->cancellable : NULL, err);
+    }
 
     if (G_UNLIKELY (r < 0)) {
       if (out == 0) {
@@ -2892,6 +2931,9 @@ gst_rtsp_connection_close (GstRTSPConnection * conn)
   conn->initial_buffer = NULL;
   conn->initial_buffer_offset = 0;
 
+  conn->read_buffer_pos = 0;
+  conn->read_buffer_fill = 0;
+
   conn->write_socket = NULL;
   conn->read_socket = NULL;
   conn->write_socket_used = FALSE;
@@ -2982,6 +3024,19 @@ gst_rtsp_connection_poll_usec (GstRTSPConnection * conn, GstRTSPEvent events,
   g_return_val_if_fail (conn->read_socket != NULL, GST_RTSP_EINVAL);
   g_return_val_if_fail (conn->write_socket != NULL, GST_RTSP_EINVAL);
 
+  /* data buffered inside the connection will not make the socket poll
+   * readable, report it right away */
+  if ((events & GST_RTSP_EV_READ) && (conn->initial_buffer != NULL ||
+          conn->read_buffer_pos < conn->read_buffer_fill)) {
+    *revents = GST_RTSP_EV_READ;
+    if (events & GST_RTSP_EV_WRITE) {
+      condition = g_socket_condition_check (conn->write_socket, G_IO_OUT);
+      if ((condition & G_IO_OUT))
+        *revents |= GST_RTSP_EV_WRITE;
+    }
+    return GST_RTSP_OK;
+  }
+
   ctx = g_main_context_new ();
 
   /* configure timeout if any */
@@ -3653,6 +3708,14 @@ gst_rtsp_connection_do_tunnel (GstRTSPConnection * conn,
     conn->initial_buffer = conn2->initial_buffer;
     conn2->initial_buffer = NULL;
     conn->initial_buffer_offset = conn2->initial_buffer_offset;
+
+    /* data already read from the new read socket moves along with it */
+    memcpy (conn->read_buffer, conn2->read_buffer,
+        sizeof (conn->read_buffer));
+    conn->read_buffer_pos = conn2->read_buffer_pos;
+    conn->read_buffer_fill = conn2->read_buffer_fill;
+    conn2->read_buffer_pos = 0;
+    conn2->read_buffer_fill = 0;
   }
 
   /* we need base64 decoding for the readfd */
@@ -3750,6 +3813,11 @@ gst_rtsp_source_prepare (GSource * source, gint * timeout)
   if (watch->conn->initial_buffer != NULL)
     return TRUE;
 
+  /* data left over from a bulk read will not make the socket poll readable
+   * again, dispatch right away */
+  if (watch->conn->read_buffer_pos < watch->conn->read_buffer_fill)
+    return TRUE;
+
   *timeout = (watch->conn->timeout * 1000);
 
   return FALSE;
@@ -3845,6 +3913,8 @@ gst_rtsp_source_dispatch_read (GPollableInputStream * stream,
       conn->stream1 = NULL;
       conn->socket1 = NULL;
       conn->input_stream = NULL;
+      conn->read_buffer_pos = 0;
+      conn->read_buffer_fill = 0;
     }
     g_mutex_unlock (&watch->mutex);
 
@@ -3971,7 +4041,8 @@ gst_rtsp_source_dispatch (GSource * source, GSourceFunc callback G_GNUC_UNUSED,
   GstRTSPWatch *watch = (GstRTSPWatch *) source;
   GstRTSPConnection *conn = watch->conn;
 
-  if (conn->initial_buffer != NULL) {
+  if (conn->input_stream != NULL && (conn->initial_buffer != NULL ||
+          conn->read_buffer_pos < conn->read_buffer_fill)) {
     gst_rtsp_source_dispatch_read (G_POLLABLE_INPUT_STREAM (conn->input_stream),
         watch);
   }
@@ -2930,42 +2930,47 @@ gst_sdp_media_remove_attribute (GstSDPMedia * media, guint idx)
   return GST_SDP_OK;
 }
 
-static void
-read_string (gchar * dest, guint size, gchar ** src)
+/* the line buffer the parser hands us is a private mutable copy, so tokens
+ * can be NUL-terminated right inside it instead of being copied out into a
+ * scratch buffer first */
+static gchar *
+read_string (gchar ** src)
 {
-  guint idx;
+  gchar *start;
 
-  idx = 0;
   /* skip spaces */
   while (g_ascii_isspace (**src))
     (*src)++;
 
-  while (!g_ascii_isspace (**src) && **src != '\0') {
-    if (idx < size - 1)
-      dest[idx++] = **src;
+  start = *src;
+  while (!g_ascii_isspace (**src) && **src != '\0')
+    (*src)++;
+
+  if (**src != '\0') {
+    **src = '\0';
     (*src)++;
   }
-  if (size > 0)
-    dest[idx] = '\0';
+  return start;
 }
 
-static void
-read_string_del (gchar * dest, guint size, gchar del, gchar ** src)
+static gchar *
+read_string_del (gchar del, gchar ** src)
 {
-  guint idx;
+  gchar *start;
 
-  idx = 0;
   /* skip spaces */
   while (g_ascii_isspace (**src))
     (*src)++;
 
-  while (**src != del && **src != '\0') {
-    if (idx < size - 1)
-      dest[idx++] = **src;
+  start = *src;
+  while (**src != del && **src != '\0')
+    (*src)++;
+
+  if (**src != '\0') {
+    **src = '\0';
     (*src)++;
   }
-  if (size > 0)
-    dest[idx] = '\0';
+  return start;
 }
 
 enum
@@ -2984,13 +2989,13 @@ typedef struct
 static gboolean
 gst_sdp_parse_line (SDPContext * c, gchar type, gchar * buffer)
 {
-  gchar str[8192];
+  gchar *str;
   gchar *p = buffer;
 
 #define READ_STRING(field) \
-  do { read_string (str, sizeof (str), &p); REPLACE_STRING (field, str); } while (0)
+  do { str = read_string (&p); REPLACE_STRING (field, str); } while (0)
 #define READ_UINT(field) \
-  do { read_string (str, sizeof (str), &p); field = strtoul (str, NULL, 10); } while (0)
+  do { str = read_string (&p); field = strtoul (str, NULL, 10); } while (0)
 
   switch (type) {
     case 'v':
@@ -3055,12 +3060,10 @@ gst_sdp_parse_line (SDPContext * c, gchar type, gchar * buffer)
     }
     case 'b':
     {
-      gchar str2[32];
+      gchar *str2;
 
-      read_string_del (str, sizeof (str), ':', &p);
-      if (*p != '\0')
-        p++;
-      read_string (str2, sizeof (str2), &p);
+      str = read_string_del (':', &p);
+      str2 = read_string (&p);
       if (c->state == SDP_SESSION)
         gst_sdp_message_add_bandwidth (c->msg, str, atoi (str2));
       else
@@ -3070,18 +3073,14 @@ gst_sdp_parse_line (SDPContext * c, gchar type, gchar * buffer)
     case 't':
       break;
     case 'k':
-      read_string_del (str, sizeof (str), ':', &p);
-      if (*p != '\0')
-        p++;
+      str = read_string_del (':', &p);
       if (c->state == SDP_SESSION)
         gst_sdp_message_set_key (c->msg, str, p);
       else
         gst_sdp_media_set_key (c->media, str, p);
       break;
     case 'a':
-      read_string_del (str, sizeof (str), ':', &p);
-      if (*p != '\0')
-        p++;
+      str = read_string_del (':', &p);
       if (c->state == SDP_SESSION)
         gst_sdp_message_add_attribute (c->msg, str, p);
       else
@@ -3098,7 +3097,7 @@ gst_sdp_parse_line (SDPContext * c, gchar type, gchar * buffer)
 
       /* m=<media> <port>/<number of ports> <proto> <fmt> ... */
       READ_STRING (nmedia.media);
-      read_string (str, sizeof (str), &p);
+      str = read_string (&p);
       slash = g_strrstr (str, "/");
       if (slash) {
         *slash = '\0';
@@ -3110,7 +3109,7 @@ gst_sdp_parse_line (SDPContext * c, gchar type, gchar * buffer)
       }
       READ_STRING (nmedia.proto);
       do {
-        read_string (str, sizeof (str), &p);
+        str = read_string (&p);
         gst_sdp_media_add_format (&nmedia, str);
       } while (*p != '\0');
 
@@ -4525,6 +4525,135 @@ convert_UYVY_I420 (GstVideoConverter * convert, const GstVideoFrame * src,
   }
 }
 
+static void
+convert_NV12_I420_task (FConvertPlaneTask * task)
+{
+  /* luma is a plain copy, chroma is deinterleaved into the two planes */
+  video_orc_memcpy_2d (task->d, task->dstride, task->s, task->sstride,
+      task->width, task->height);
+  video_orc_deinterleave_chroma (task->du, task->dustride,
+      task->dv, task->dvstride, task->su, task->sustride,
+      (task->width + 1) / 2, (task->height + 1) / 2);
+}
+
+static void
+convert_NV12_I420 (GstVideoConverter * convert, const GstVideoFrame * src,
+    GstVideoFrame * dest)
+{
+  gint width = convert->in_width;
+  gint height = convert->in_height;
+  guint8 *sy, *suv, *dy, *du, *dv;
+  FConvertPlaneTask *tasks;
+  FConvertPlaneTask **tasks_p;
+  gint n_threads;
+  gint lines_per_thread;
+  gint i;
+
+  sy = FRAME_GET_Y_LINE (src, 0);
+  suv = FRAME_GET_PLANE_LINE (src, 1, 0);
+  dy = FRAME_GET_Y_LINE (dest, 0);
+  du = FRAME_GET_U_LINE (dest, 0);
+  dv = FRAME_GET_V_LINE (dest, 0);
+
+  n_threads = convert->conversion_runner->n_threads;
+  tasks = convert->tasks[0] =
+      g_renew (FConvertPlaneTask, convert->tasks[0], n_threads);
+  tasks_p = convert->tasks_p[0] =
+      g_renew (FConvertPlaneTask *, convert->tasks_p[0], n_threads);
+
+  /* split in even bands so each one covers whole chroma lines */
+  lines_per_thread = GST_ROUND_UP_2 ((height + n_threads - 1) / n_threads);
+
+  for (i = 0; i < n_threads; i++) {
+    gint h0 = MIN (i * lines_per_thread, height);
+
+    tasks[i].dstride = FRAME_GET_Y_STRIDE (dest);
+    tasks[i].dustride = FRAME_GET_U_STRIDE (dest);
+    tasks[i].dvstride = FRAME_GET_V_STRIDE (dest);
+    tasks[i].sstride = FRAME_GET_Y_STRIDE (src);
+    tasks[i].sustride = FRAME_GET_PLANE_STRIDE (src, 1);
+
+    tasks[i].d = dy + h0 * tasks[i].dstride;
+    tasks[i].du = du + (h0 / 2) * tasks[i].dustride;
+    tasks[i].dv = dv + (h0 / 2) * tasks[i].dvstride;
+    tasks[i].s = sy + h0 * tasks[i].sstride;
+    tasks[i].su = suv + (h0 / 2) * tasks[i].sustride;
+
+    tasks[i].width = width;
+    tasks[i].height = MIN (height, h0 + lines_per_thread) - h0;
+
+    tasks_p[i] = &tasks[i];
+  }
+
+  gst_parallelized_task_runner_run (convert->conversion_runner,
+      (GstParallelizedTaskFunc) convert_NV12_I420_task, (gpointer) tasks_p);
+}
+
+static void
+convert_I420_NV12_task (FConvertPlaneTask * task)
+{
+  /* luma is a plain copy, chroma planes are interleaved */
+  video_orc_memcpy_2d (task->d, task->dstride, task->s, task->sstride,
+      task->width, task->height);
+  video_orc_interleave_chroma (task->du, task->dustride,
+      task->su, task->sustride, task->sv, task->svstride,
+      (task->width + 1) / 2, (task->height + 1) / 2);
+}
+
+static void
+convert_I420_NV12 (GstVideoConverter * convert, const GstVideoFrame * src,
+    GstVideoFrame * dest)
+{
+  gint width = convert->in_width;
+  gint height = convert->in_height;
+  const guint8 *sy, *su, *sv;
+  guint8 *dy, *duv;
+  FConvertPlaneTask *tasks;
+  FConvertPlaneTask **tasks_p;
+  gint n_threads;
+  gint lines_per_thread;
+  gint i;
+
+  sy = FRAME_GET_Y_LINE (src, 0);
+  su = FRAME_GET_U_LINE (src, 0);
+  sv = FRAME_GET_V_LINE (src, 0);
+  dy = FRAME_GET_Y_LINE (dest, 0);
+  duv = FRAME_GET_PLANE_LINE (dest, 1, 0);
+
+  n_threads = convert->conversion_runner->n_threads;
+  tasks = convert->tasks[0] =
+      g_renew (FConvertPlaneTask, convert->tasks[0], n_threads);
+  tasks_p = convert->tasks_p[0] =
+      g_renew (FConvertPlaneTask *, convert->tasks_p[0], n_threads);
+
+  /* split in even bands so each one covers whole chroma lines */
+  lines_per_thread = GST_ROUND_UP_2 ((height + n_threads - 1) / n_threads);
+
+  for (i = 0; i < n_threads; i++) {
+    gint h0 = MIN (i * lines_per_thread, height);
+
+    tasks[i].dstride = FRAME_GET_Y_STRIDE (dest);
+    tasks[i].dustride = FRAME_GET_PLANE_STRIDE (dest, 1);
+    tasks[i].sstride = FRAME_GET_Y_STRIDE (src);
+    tasks[i].sustride = FRAME_GET_U_STRIDE (src);
+    tasks[i].svstride = FRAME_GET_V_STRIDE (src);
+
+    tasks[i].d = dy + h0 * tasks[i].dstride;
+    tasks[i].du = duv + (h0 / 2) * tasks[i].dustride;
+    tasks[i].s = sy + h0 * tasks[i].sstride;
+    tasks[i].su = su + (h0 / 2) * tasks[i].sustride;
+    tasks[i].sv = sv + (h0 / 2) * tasks[i].svstride;
+
+    tasks[i].width = width;
+    tasks[i].height = MIN (height, h0 + lines_per_thread) - h0;
+
+    tasks_p[i] = &tasks[i];
+  }
+
+  gst_parallelized_task_runner_run (convert->conversion_runner,
+      (GstParallelizedTaskFunc) convert_I420_NV12_task, (gpointer) tasks_p);
+}
+
 static void
 convert_UYVY_AYUV_task (FConvertPlaneTask * task)
 {
@@ -7978,6 +8107,16 @@ static const VideoTransform transforms[] = {
   {GST_VIDEO_FORMAT_NV21, GST_VIDEO_FORMAT_NV21, TRUE, FALSE, FALSE, TRUE,
       TRUE, FALSE, FALSE, FALSE, 0, 0, convert_scale_planes},
 
+  /* semiplanar <-> planar */
+  {GST_VIDEO_FORMAT_NV12, GST_VIDEO_FORMAT_I420, TRUE, FALSE, TRUE, FALSE,
+      FALSE, FALSE, FALSE, FALSE, 0, 0, convert_NV12_I420},
+  {GST_VIDEO_FORMAT_NV12, GST_VIDEO_FORMAT_YV12, TRUE, FALSE, TRUE, FALSE,
+      FALSE, FALSE, FALSE, FALSE, 0, 0, convert_NV12_I420},
+  {GST_VIDEO_FORMAT_I420, GST_VIDEO_FORMAT_NV12, TRUE, FALSE, TRUE, FALSE,
+      FALSE, FALSE, FALSE, FALSE, 0, 0, convert_I420_NV12},
+  {GST_VIDEO_FORMAT_YV12, GST_VIDEO_FORMAT_NV12, TRUE, FALSE, TRUE, FALSE,
+      FALSE, FALSE, FALSE, FALSE, 0, 0, convert_I420_NV12},
+
   {GST_VIDEO_FORMAT_NV16, GST_VIDEO_FORMAT_NV12, TRUE, FALSE, FALSE, TRUE,
       TRUE, FALSE, FALSE, FALSE, 0, 0, convert_scale_planes},
   {GST_VIDEO_FORMAT_NV16, GST_VIDEO_FORMAT_NV16, TRUE, FALSE, FALSE, TRUE,
@@ -1424,49 +1424,19 @@ no_func:
 }
 
 
-/**
- * gst_video_scaler_2d:
- * @hscale: a horizontal #GstVideoScaler
- * @vscale: a vertical #GstVideoScaler
- * @format: a #GstVideoFormat for @srcs and @dest
- * @src: source pixels
- * @src_stride: source pixels stride
- * @dest: destination pixels
- * @dest_stride: destination pixels stride
- * @x: the horizontal destination offset
- * @y: the vertical destination offset
- * @width: the number of output pixels to scale
- * @height: the number of output lines to scale
- *
- * Scale a rectangle of pixels in @src with @src_stride to @dest with
- * @dest_stride using the horizontal scaler @hscaler and the vertical
- * scaler @vscale.
- *
- * One or both of @hscale and @vscale can be NULL to only perform scaling in
- * one dimension or do a copy without scaling.
- *
- * @x and @y are the coordinates in the destination image to process.
- */
-void
-gst_video_scaler_2d (GstVideoScaler * hscale, GstVideoScaler * vscale,
-    GstVideoFormat format, gpointer src, gint src_stride,
-    gpointer dest, gint dest_stride, guint x, guint y,
-    guint width, guint height)
+/* Scale the output lines [@y, @height) of a rectangle. @height is the
+ * absolute end line, not a line count, which is why the loops below all
+ * run from @y up to @height. The scale functions lazily allocate state in
+ * the scalers (the integer coefficient tables and the temporary lines),
+ * so concurrent calls must operate on their own scaler copies. */
+static void
+video_scaler_2d_range (GstVideoScaler * hscale, GstVideoScaler * vscale,
+    GstVideoScalerHFunc hfunc, GstVideoScalerVFunc vfunc,
+    gint n_elems, gint bits, gboolean interlaced,
+    gpointer src, gint src_stride, gpointer dest, gint dest_stride,
+    guint x, guint y, guint width, guint height)
 {
-  gint n_elems, bits;
-  GstVideoScalerHFunc hfunc = NULL;
-  GstVideoScalerVFunc vfunc = NULL;
   gint i;
-  gboolean interlaced;
-
-  g_return_if_fail (src != NULL);
-  g_return_if_fail (dest != NULL);
-
-  if (!get_functions (hscale, vscale, format, &hfunc, &vfunc, &n_elems, &width,
-          &bits))
-    goto no_func;
-
-  interlaced = vscale && ! !(vscale->flags & GST_VIDEO_SCALER_FLAG_INTERLACED);
 
 #define LINE(s,ss,i)  ((guint8 *)(s) + ((i) * (ss)))
 #define TMP_LINE(s,i) ((guint8 *)((s)->tmpline1) + (i) * (sizeof (gint32) * width * n_elems))
@@ -1635,6 +1605,230 @@ gst_video_scaler_2d (GstVideoScaler * hscale, GstVideoScaler * vscale,
       }
     }
   }
+}
+
+#undef LINE
+#undef TMP_LINE
+
+/* Number of output lines a slice must at least have before it is worth
+ * handing to the shared pool. This also keeps calls made from worker
+ * threads of a multi-threaded GstVideoConverter, which already operate on
+ * small bands, on the serial path. */
+#define SCALER_SLICE_MIN_LINES 64
+
+typedef struct
+{
+  GstVideoScalerHFunc hfunc;
+  GstVideoScalerVFunc vfunc;
+  gint n_elems;
+  gint bits;
+  gboolean interlaced;
+  gpointer src;
+  gint src_stride;
+  gpointer dest;
+  gint dest_stride;
+  guint x;
+  guint width;
+
+  GMutex lock;
+  GCond cond;
+  guint pending;
+} SliceContext;
+
+typedef struct
+{
+  SliceContext *ctx;
+  /* shallow scaler copies with private temporary lines */
+  GstVideoScaler *hcopy;
+  GstVideoScaler *vcopy;
+  guint y;
+  guint height;
+} SliceJob;
+
+/* Make a shallow copy of @scale for use in a worker thread. The resampler
+ * and the coefficient tables are read-only once created and are shared
+ * with the original; only the temporary lines, which the scale functions
+ * write to, are private to the copy. */
+static GstVideoScaler *
+video_scaler_dup_tmp (const GstVideoScaler * scale)
+{
+  GstVideoScaler *copy;
+
+  if (scale == NULL)
+    return NULL;
+
+  copy = g_slice_dup (GstVideoScaler, scale);
+  copy->tmpwidth = 0;
+  copy->tmpline1 = NULL;
+  copy->tmpline2 = NULL;
+
+  return copy;
+}
+
+static void
+video_scaler_free_tmp (GstVideoScaler * copy)
+{
+  if (copy == NULL)
+    return;
+
+  g_free (copy->tmpline1);
+  g_free (copy->tmpline2);
+  g_slice_free (GstVideoScaler, copy);
+}
+
+static void
+video_scaler_2d_slice (gpointer data, gpointer user_data)
+{
+  SliceJob *job = data;
+  SliceContext *ctx = job->ctx;
+
+  video_scaler_2d_range (job->hcopy, job->vcopy, ctx->hfunc, ctx->vfunc,
+      ctx->n_elems, ctx->bits, ctx->interlaced, ctx->src, ctx->src_stride,
+      ctx->dest, ctx->dest_stride, ctx->x, job->y, ctx->width, job->height);
+
+  g_mutex_lock (&ctx->lock);
+  ctx->pending--;
+  g_cond_signal (&ctx->cond);
+  g_mutex_unlock (&ctx->lock);
+}
+
+/* The pool is shared between all scalers in the process. It is not
+ * exclusive, so idle threads are given back to the system, and the jobs
+ * never block on each other so pushing from concurrent callers can not
+ * deadlock. */
+static GThreadPool *
+video_scaler_get_slice_pool (void)
+{
+  static GThreadPool *pool = NULL;
+
+  if (g_once_init_enter (&pool)) {
+    GThreadPool *p;
+
+    p = g_thread_pool_new (video_scaler_2d_slice, NULL,
+        g_get_num_processors (), FALSE, NULL);
+    g_once_init_leave (&pool, p);
+  }
+  return pool;
+}
+
+/**
+ * gst_video_scaler_2d:
+ * @hscale: a horizontal #GstVideoScaler
+ * @vscale: a vertical #GstVideoScaler
+ * @format: a #GstVideoFormat for @srcs and @dest
+ * @src: source pixels
+ * @src_stride: source pixels stride
+ * @dest: destination pixels
+ * @dest_stride: destination pixels stride
+ * @x: the horizontal destination offset
+ * @y: the vertical destination offset
+ * @width: the number of output pixels to scale
+ * @height: the number of output lines to scale
+ *
+ * Scale a rectangle of pixels in @src with @src_stride to @dest with
+ * @dest_stride using the horizontal scaler @hscaler and the vertical
+ * scaler @vscale.
+ *
+ * One or both of @hscale and @vscale can be NULL to only perform scaling in
+ * one dimension or do a copy without scaling.
+ *
+ * @x and @y are the coordinates in the destination image to process.
+ *
+ * Large rectangles are split into horizontal slices that are scaled by a
+ * shared pool of worker threads.
+ */
+void
+gst_video_scaler_2d (GstVideoScaler * hscale, GstVideoScaler * vscale,
+    GstVideoFormat format, gpointer src, gint src_stride,
+    gpointer dest, gint dest_stride, guint x, guint y,
+    guint width, guint height)
+{
+  gint n_elems, bits;
+  GstVideoScalerHFunc hfunc = NULL;
+  GstVideoScalerVFunc vfunc = NULL;
+  gboolean interlaced;
+  guint lines, n_slices;
+
+  g_return_if_fail (src != NULL);
+  g_return_if_fail (dest != NULL);
+
+  if (!get_functions (hscale, vscale, format, &hfunc, &vfunc, &n_elems, &width,
+          &bits))
+    goto no_func;
+
+  interlaced = vscale && ! !(vscale->flags & GST_VIDEO_SCALER_FLAG_INTERLACED);
+
+  lines = height - y;
+  if (lines >= 2 * SCALER_SLICE_MIN_LINES)
+    n_slices = MIN (lines / SCALER_SLICE_MIN_LINES, g_get_num_processors ());
+  else
+    n_slices = 1;
+
+  if (n_slices > 1) {
+    SliceContext ctx;
+    SliceJob *jobs;
+    guint n, first_end;
+
+    /* scale the first output line serially so that the coefficient tables,
+     * which the scale functions create lazily in the scalers, exist before
+     * the scalers are copied for the workers */
+    video_scaler_2d_range (hscale, vscale, hfunc, vfunc, n_elems, bits,
+        interlaced, src, src_stride, dest, dest_stride, x, y, width, y + 1);
+
+    ctx.hfunc = hfunc;
+    ctx.vfunc = vfunc;
+    ctx.n_elems = n_elems;
+    ctx.bits = bits;
+    ctx.interlaced = interlaced;
+    ctx.src = src;
+    ctx.src_stride = src_stride;
+    ctx.dest = dest;
+    ctx.dest_stride = dest_stride;
+    ctx.x = x;
+    ctx.width = width;
+    ctx.pending = n_slices - 1;
+    g_mutex_init (&ctx.lock);
+    g_cond_init (&ctx.cond);
+
+    /* divide the remaining lines evenly over the slices, the workers take
+     * all but the first one */
+    y += 1;
+    lines -= 1;
+
+    jobs = g_newa (SliceJob, n_slices - 1);
+    for (n = 1; n < n_slices; n++) {
+      SliceJob *job = &jobs[n - 1];
+
+      job->ctx = &ctx;
+      job->hcopy = video_scaler_dup_tmp (hscale);
+      job->vcopy = video_scaler_dup_tmp (vscale);
+      job->y = y + (lines * n) / n_slices;
+      job->height = y + (lines * (n + 1)) / n_slices;
+      g_thread_pool_push (video_scaler_get_slice_pool (), job, NULL);
+    }
+
+    /* the calling thread does the first slice with the original scalers */
+    first_end = y + lines / n_slices;
+    if (first_end > y)
+      video_scaler_2d_range (hscale, vscale, hfunc, vfunc, n_elems, bits,
+          interlaced, src, src_stride, dest, dest_stride, x, y, width,
+          first_end);
+
+    g_mutex_lock (&ctx.lock);
+    while (ctx.pending > 0)
+      g_cond_wait (&ctx.cond, &ctx.lock);
+    g_mutex_unlock (&ctx.lock);
+
+    for (n = 1; n < n_slices; n++) {
+      video_scaler_free_tmp (jobs[n - 1].hcopy);
+      video_scaler_free_tmp (jobs[n - 1].vcopy);
+    }
+    g_mutex_clear (&ctx.lock);
+    g_cond_clear (&ctx.cond);
+  } else {
+    video_scaler_2d_range (hscale, vscale, hfunc, vfunc, n_elems, bits,
+        interlaced, src, src_stride, dest, dest_stride, x, y, width, height);
+  }
   return;
 
 no_func:
@@ -1642,6 +1836,3 @@ no_func:
     GST_WARNING ("no scaler function for format");
   }
 }
-
-#undef LINE
-#undef TMP_LINE
@@ -60,6 +60,8 @@
 #include "config.h"
 #endif
 
+#include <string.h>
+
 #include "gstaudiomixerelements.h"
 #include "gstaudiomixerorc.h"
 
@@ -313,8 +315,19 @@ gst_audiomixer_aggregate_one_buffer (GstAudioAggregator * aagg,
   GST_LOG_OBJECT (pad, "mixing %u bytes at offset %u from offset %u",
       num_frames * bpf, out_offset * bpf, in_offset * bpf);
 
-  /* further buffers, need to add them */
-  if (pad->volume == 1.0) {
+  /* The base class keeps the GAP flag on the output buffer for as long as
+   * nothing was mixed into it, so at this point the data is known to still
+   * be silence. For the signed and float formats silence is all zeroes and
+   * adding the first input at unity volume is equivalent to copying it,
+   * which saves reading the silence back just to add zero to every sample.
+   * The unsigned formats are excluded as their silence is the bias value. */
+  if (pad->volume == 1.0 &&
+      GST_BUFFER_FLAG_IS_SET (outbuf, GST_BUFFER_FLAG_GAP) &&
+      (GST_AUDIO_FORMAT_INFO_IS_SIGNED (srcpad->info.finfo) ||
+          GST_AUDIO_FORMAT_INFO_IS_FLOAT (srcpad->info.finfo))) {
+    memcpy (outmap.data + out_offset * bpf, inmap.data + in_offset * bpf,
+        num_frames * bpf);
+  } else if (pad->volume == 1.0) {
     switch (srcpad->info.finfo->format) {
       case GST_AUDIO_FORMAT_U8:
         audiomixer_orc_add_u8 ((gpointer) (outmap.data + out_offset * bpf),
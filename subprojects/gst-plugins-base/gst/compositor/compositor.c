@@ -625,6 +625,17 @@ gst_compositor_pad_create_conversion_info (GstVideoAggregatorConvertPad * pad,
   }
 }
 
+static void
+gst_compositor_pad_finalize (GObject * object)
+{
+  GstCompositorPad *pad = GST_COMPOSITOR_PAD (object);
+
+  gst_clear_buffer (&pad->last_buffer);
+  gst_clear_structure (&pad->last_converter_config);
+
+  G_OBJECT_CLASS (gst_compositor_pad_parent_class)->finalize (object);
+}
+
 static void
 gst_compositor_pad_class_init (GstCompositorPadClass * klass)
 {
@@ -636,6 +647,7 @@ gst_compositor_pad_class_init (GstCompositorPadClass * klass)
 
   gobject_class->set_property = gst_compositor_pad_set_property;
   gobject_class->get_property = gst_compositor_pad_get_property;
+  gobject_class->finalize = gst_compositor_pad_finalize;
 
   g_object_class_install_property (gobject_class, PROP_PAD_XPOS,
       g_param_spec_int ("xpos", "X Position", "X Position of the picture",
@@ -749,7 +761,10 @@ gst_compositor_set_property (GObject * object,
 
   switch (prop_id) {
     case PROP_BACKGROUND:
+      GST_OBJECT_LOCK (self);
       self->background = g_value_get_enum (value);
+      self->damage_all = TRUE;
+      GST_OBJECT_UNLOCK (self);
       break;
     case PROP_ZERO_SIZE_IS_UNSCALED:
       self->zero_size_is_unscaled = g_value_get_boolean (value);
@@ -1190,6 +1205,12 @@ _negotiated_caps (GstAggregator * agg, GstCaps * caps)
     return FALSE;
   }
 
+  /* the retained output frame does not match the new caps anymore */
+  GST_OBJECT_LOCK (compositor);
+  gst_clear_buffer (&compositor->last_outbuf);
+  compositor->damage_all = TRUE;
+  GST_OBJECT_UNLOCK (compositor);
+
   if (compositor->max_threads == 0)
     n_threads = g_get_num_processors ();
   else
@@ -1256,6 +1277,22 @@ frames_can_copy (const GstVideoFrame * frame1, const GstVideoFrame * frame2)
   return TRUE;
 }
 
+/* Calculate the rectangle @cpad covers in the output, in output coordinates.
+ * Must hold the object lock */
+static GstVideoRectangle
+_pad_output_rectangle (GstVideoAggregator * vagg, GstCompositorPad * cpad)
+{
+  gint width, height, x_offset, y_offset;
+
+  _mixer_pad_get_output_size (GST_COMPOSITOR (vagg), cpad,
+      GST_VIDEO_INFO_PAR_N (&vagg->info), GST_VIDEO_INFO_PAR_D (&vagg->info),
+      &width, &height, &x_offset, &y_offset);
+
+  return clamp_rectangle (cpad->xpos + x_offset, cpad->ypos + y_offset,
+      width, height, GST_VIDEO_INFO_WIDTH (&vagg->info),
+      GST_VIDEO_INFO_HEIGHT (&vagg->info));
+}
+
 struct CompositePadInfo
 {
   GstVideoFrame *prepared_frame;
@@ -1358,7 +1395,10 @@ gst_compositor_aggregate_frames (GstVideoAggregator * vagg, GstBuffer * outbuf)
   gboolean draw_background;
   guint drawn_a_pad = FALSE;
   struct CompositePadInfo *pads_info;
-  guint i, n_pads = 0;
+  guint i, zpos, n_pads = 0;
+  gboolean partial;
+  gint damage_y_start, damage_y_end;
+  gint out_height;
 
   if (!gst_video_frame_map (&out_frame, &vagg->info, outbuf, GST_MAP_WRITE)) {
     GST_WARNING_OBJECT (vagg, "Could not map output buffer");
@@ -1374,13 +1414,76 @@ gst_compositor_aggregate_frames (GstVideoAggregator * vagg, GstBuffer * outbuf)
   draw_background = _should_draw_background (vagg);
 
   GST_OBJECT_LOCK (vagg);
+
+  out_height = GST_VIDEO_INFO_HEIGHT (&vagg->info);
+
+  /* Decide whether only part of the scene changed since the previous
+   * output frame. When it did, the previous frame is copied into the
+   * output and only the dirty lines are re-blended, so the compositing
+   * cost scales with what changed instead of with the output size. */
+  partial = !compositor->damage_all && compositor->last_outbuf != NULL
+      && draw_background == compositor->last_draw_background;
+  damage_y_start = out_height;
+  damage_y_end = 0;
+
+  zpos = 0;
   for (l = GST_ELEMENT (vagg)->sinkpads; l; l = l->next) {
     GstVideoAggregatorPad *pad = l->data;
+    GstCompositorPad *cpad = GST_COMPOSITOR_PAD (pad);
     GstVideoFrame *prepared_frame =
         gst_video_aggregator_pad_get_prepared_frame (pad);
-
-    if (prepared_frame)
+    GstBuffer *buffer = gst_video_aggregator_pad_get_current_buffer (pad);
+    gboolean has_frame = prepared_frame != NULL;
+    GstVideoRectangle rect = { 0, 0, 0, 0 };
+    GstStructure *converter_config = NULL;
+    gboolean config_changed;
+    gboolean dirty;
+
+    if (has_frame) {
       n_pads++;
+      rect = _pad_output_rectangle (vagg, cpad);
+    }
+
+    /* the converter-config also influences what the converted frame looks
+     * like, without the input buffer or the geometry changing */
+    g_object_get (pad, "converter-config", &converter_config, NULL);
+    config_changed =
+        (converter_config == NULL) != (cpad->last_converter_config == NULL)
+        || (converter_config != NULL && cpad->last_converter_config != NULL
+        && !gst_structure_is_equal (converter_config,
+            cpad->last_converter_config));
+
+    /* a pad is dirty when it got a new buffer, moved, resized, changed
+     * appearance or stacking order, or appeared/disappeared altogether */
+    dirty = has_frame != cpad->last_had_frame || (has_frame
+        && (buffer != cpad->last_buffer || config_changed
+            || rect.x != cpad->last_rect.x || rect.y != cpad->last_rect.y
+            || rect.w != cpad->last_rect.w || rect.h != cpad->last_rect.h
+            || cpad->alpha != cpad->last_alpha || cpad->op != cpad->last_op
+            || zpos != cpad->last_zpos));
+
+    if (dirty) {
+      /* both where the pad is now and where it was must be redrawn */
+      if (has_frame) {
+        damage_y_start = MIN (damage_y_start, rect.y);
+        damage_y_end = MAX (damage_y_end, rect.y + rect.h);
+      }
+      if (cpad->last_had_frame) {
+        damage_y_start = MIN (damage_y_start, cpad->last_rect.y);
+        damage_y_end = MAX (damage_y_end,
+            cpad->last_rect.y + cpad->last_rect.h);
+      }
+    }
+
+    gst_buffer_replace (&cpad->last_buffer, buffer);
+    gst_clear_structure (&cpad->last_converter_config);
+    cpad->last_converter_config = converter_config;
+    cpad->last_rect = rect;
+    cpad->last_alpha = cpad->alpha;
+    cpad->last_op = cpad->op;
+    cpad->last_zpos = zpos;
+    cpad->last_had_frame = has_frame;
+    zpos++;
   }
 
   /* If no prepared frame, we should draw background unconditionally in order
@@ -1420,7 +1523,16 @@ gst_compositor_aggregate_frames (GstVideoAggregator * vagg, GstBuffer * outbuf)
        * will be composited on top of it. */
       if (!drawn_a_pad && !draw_background &&
           frames_can_copy (prepared_frame, outframe)) {
-        gst_video_frame_copy (outframe, prepared_frame);
+        if (partial) {
+          /* only the damaged lines get redrawn, so the as-is copy of
+           * this pad becomes a SOURCE blend over those lines */
+          pads_info[n_pads].pad = compo_pad;
+          pads_info[n_pads].prepared_frame = prepared_frame;
+          pads_info[n_pads].blend_mode = COMPOSITOR_BLEND_MODE_SOURCE;
+          n_pads++;
+        } else {
+          gst_video_frame_copy (outframe, prepared_frame);
+        }
       } else {
         pads_info[n_pads].pad = compo_pad;
         pads_info[n_pads].prepared_frame = prepared_frame;
@@ -1431,40 +1543,113 @@ gst_compositor_aggregate_frames (GstVideoAggregator * vagg, GstBuffer * outbuf)
     }
   }
 
-  {
-    guint n_threads, lines_per_thread;
-    guint out_height;
+  if (partial) {
+    GstVideoFrame last_frame;
+
+    /* start from the previous output frame, the damaged lines get
+     * re-blended on top of it */
+    if (gst_video_frame_map (&last_frame, &vagg->info, compositor->last_outbuf,
+            GST_MAP_READ)) {
+      gst_video_frame_copy (outframe, &last_frame);
+      gst_video_frame_unmap (&last_frame);
+    } else {
+      GST_WARNING_OBJECT (vagg, "Could not map previous output buffer");
+      partial = FALSE;
+    }
+  }
+
+  if (partial) {
+    /* keep the blend range aligned for subsampled formats */
+    damage_y_start = MAX (GST_ROUND_DOWN_2 (damage_y_start), 0);
+    damage_y_end = MIN (GST_ROUND_UP_2 (damage_y_end), out_height);
+  } else {
+    damage_y_start = 0;
+    damage_y_end = out_height;
+  }
+
+  if (damage_y_end > damage_y_start) {
+    guint n_threads;
     struct CompositeTask *tasks;
     struct CompositeTask **tasks_p;
+    gint *line_accum;
+    gint n_lines, out_width, total, run, prev, l;
 
     n_threads = compositor->blend_runner->n_threads;
 
     tasks = g_newa (struct CompositeTask, n_threads);
     tasks_p = g_newa (struct CompositeTask *, n_threads);
 
-    out_height = GST_VIDEO_FRAME_HEIGHT (outframe);
-    lines_per_thread = (out_height + n_threads - 1) / n_threads;
+    /* Weight each output line with the amount of source pixels that get
+     * blended onto it, so that the bands handed to the workers contain
+     * roughly the same amount of work instead of the same number of
+     * lines. The weights are accumulated with a sweep over the pad
+     * rectangles: first the per-line deltas, then the prefix sums. */
+    n_lines = damage_y_end - damage_y_start;
+    out_width = GST_VIDEO_INFO_WIDTH (&vagg->info);
+    line_accum = g_newa (gint, n_lines + 1);
+    memset (line_accum, 0, sizeof (gint) * (n_lines + 1));
+
+    for (i = 0; i < n_pads; i++) {
+      const GstVideoRectangle *r = &pads_info[i].pad->last_rect;
+      gint y0 = CLAMP (r->y, damage_y_start, damage_y_end);
+      gint y1 = CLAMP (r->y + r->h, damage_y_start, damage_y_end);
+      /* weight relative to a full output line, which counts as 256 */
+      gint weight = (256 * r->w) / MAX (out_width, 1);
+
+      line_accum[y0 - damage_y_start] += weight;
+      line_accum[y1 - damage_y_start] -= weight;
+    }
+
+    total = 0;
+    run = 0;
+    for (l = 0; l < n_lines; l++) {
+      run += line_accum[l];
+      line_accum[l] = total;
+      /* every line at least costs the background fill or base copy */
+      total += 256 + run;
+    }
+    line_accum[n_lines] = total;
 
+    prev = damage_y_start;
     for (i = 0; i < n_threads; i++) {
+      gint end;
+
+      if (i == n_threads - 1) {
+        end = damage_y_end;
+      } else {
+        gint goal = ((gint64) total * (i + 1)) / n_threads;
+
+        end = prev;
+        while (end < damage_y_end && line_accum[end - damage_y_start] < goal)
+          end++;
+        /* keep the band boundaries aligned for subsampled formats */
+        end = MAX (GST_ROUND_DOWN_2 (end), prev);
+      }
+
       tasks[i].compositor = compositor;
       tasks[i].n_pads = n_pads;
       tasks[i].pads_info = pads_info;
       tasks[i].out_frame = outframe;
       tasks[i].draw_background = draw_background;
-      /* This is a dumb split of the work by number of output lines.
-       * If there is a section of the output that reads from a lot of source
-       * pads, then that thread will consume more time. Maybe tracking and
-       * splitting on the source fill rate would produce better results. */
-      tasks[i].dst_line_start = i * lines_per_thread;
-      tasks[i].dst_line_end = MIN ((i + 1) * lines_per_thread, out_height);
+      tasks[i].dst_line_start = prev;
+      tasks[i].dst_line_end = end;
+      prev = end;
 
       tasks_p[i] = &tasks[i];
     }
 
     gst_parallelized_task_runner_run (compositor->blend_runner,
         (GstParallelizedTaskFunc) blend_pads, (gpointer *) tasks_p);
+  } else {
+    GST_LOG_OBJECT (vagg, "nothing changed, reused the previous frame");
   }
 
+  /* keep the produced frame for the next cycle. Our reference also makes
+   * sure that nobody can write to it without triggering a copy first. */
+  gst_buffer_replace (&compositor->last_outbuf, outbuf);
+  compositor->last_draw_background = draw_background;
+  compositor->damage_all = FALSE;
+
   GST_OBJECT_UNLOCK (vagg);
 
   gst_video_frame_unmap (outframe);
@@ -1506,6 +1691,11 @@ gst_compositor_release_pad (GstElement * element, GstPad * pad)
 
   GST_DEBUG_OBJECT (compositor, "release pad %s:%s", GST_DEBUG_PAD_NAME (pad));
 
+  /* the released pad leaves a stale area in the retained output frame */
+  GST_OBJECT_LOCK (compositor);
+  compositor->damage_all = TRUE;
+  GST_OBJECT_UNLOCK (compositor);
+
   gst_child_proxy_child_removed (GST_CHILD_PROXY (compositor), G_OBJECT (pad),
       GST_OBJECT_NAME (pad));
 
@@ -1554,6 +1744,27 @@ _sink_query (GstAggregator * agg, GstAggregatorPad * bpad, GstQuery * query)
   }
 }
 
+static gboolean
+gst_compositor_stop (GstAggregator * agg)
+{
+  GstCompositor *compositor = GST_COMPOSITOR (agg);
+  GList *l;
+
+  GST_OBJECT_LOCK (compositor);
+  gst_clear_buffer (&compositor->last_outbuf);
+  compositor->damage_all = TRUE;
+
+  for (l = GST_ELEMENT (agg)->sinkpads; l; l = l->next) {
+    GstCompositorPad *cpad = GST_COMPOSITOR_PAD (l->data);
+
+    gst_clear_buffer (&cpad->last_buffer);
+    cpad->last_had_frame = FALSE;
+  }
+  GST_OBJECT_UNLOCK (compositor);
+
+  return GST_AGGREGATOR_CLASS (parent_class)->stop (agg);
+}
+
 static void
 gst_compositor_finalize (GObject * object)
 {
@@ -1563,6 +1774,8 @@ gst_compositor_finalize (GObject * object)
     gst_parallelized_task_runner_free (compositor->blend_runner);
   compositor->blend_runner = NULL;
 
+  gst_clear_buffer (&compositor->last_outbuf);
+
   G_OBJECT_CLASS (parent_class)->finalize (object);
 }
 
@@ -1587,6 +1800,7 @@ gst_compositor_class_init (GstCompositorClass * klass)
   agg_class->sink_query = _sink_query;
   agg_class->fixate_src_caps = _fixate_caps;
   agg_class->negotiated_src_caps = _negotiated_caps;
+  agg_class->stop = gst_compositor_stop;
   videoaggregator_class->aggregate_frames = gst_compositor_aggregate_frames;
 
   g_object_class_install_property (gobject_class, PROP_BACKGROUND,
@@ -1666,6 +1880,7 @@ gst_compositor_init (GstCompositor * self)
   self->background = DEFAULT_BACKGROUND;
   self->zero_size_is_unscaled = DEFAULT_ZERO_SIZE_IS_UNSCALED;
   self->max_threads = DEFAULT_MAX_THREADS;
+  self->damage_all = TRUE;
 }
 
 /* GstChildProxy implementation */
@@ -145,6 +145,15 @@ struct _GstCompositor
   FillColorFunction fill_color;
 
   GstParallelizedTaskRunner *blend_runner;
+
+  /* dirty region tracking. The previously produced output frame is kept
+   * so that, when only part of the scene changed, the unchanged lines can
+   * be copied from it instead of being re-blended. Protected with the
+   * object lock. */
+  GstBuffer *last_outbuf;
+  gboolean last_draw_background;
+  /* set to force a full re-blend of the next output frame */
+  gboolean damage_all;
 };
 
 /**
@@ -168,6 +177,16 @@ struct _GstCompositorPad
    * keep-aspect-ratio */
   gint x_offset;
   gint y_offset;
+
+  /* state of the previous aggregation cycle, used for damage tracking.
+   * Protected with the object lock of the element. */
+  GstBuffer *last_buffer;
+  GstStructure *last_converter_config;
+  GstVideoRectangle last_rect;
+  gdouble last_alpha;
+  GstCompositorOperator last_op;
+  guint last_zpos;
+  gboolean last_had_frame;
 };
 
 GST_ELEMENT_REGISTER_DECLARE (compositor);
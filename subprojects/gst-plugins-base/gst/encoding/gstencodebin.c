@@ -81,6 +81,18 @@
  * #GstBus, allowing systems that support the missing-plugin system to offer the
  * user a way to install the missing element.
  *
+ * ## Encoding several renditions of one source
+ *
+ * A single encodebin can encode one decoded stream to several output
+ * variants (for example an adaptive-bitrate ladder): put one
+ * #GstEncodingVideoProfile per rendition in the
+ * #GstEncodingContainerProfile, each with its own restriction caps for the
+ * target resolution and bitrate, and feed the decoded video to each
+ * requested sink pad through a tee. The conversion elements in each branch
+ * only touch the data when the branch's restriction actually requires a
+ * conversion; the scaling for every rendition is performed from the source
+ * resolution, which avoids accumulating resampling error across renditions.
+ *
  */
 
 #include "gstencodingelements.h"
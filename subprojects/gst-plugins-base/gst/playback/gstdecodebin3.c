@@ -246,6 +246,10 @@ struct _GstDecodebin3
   /* TRUE if requested_selection was updated, will become FALSE once
    * it has fully transitioned to active */
   gboolean selection_updated;
+  /* Speculatively instantiated decoders (list of PrewarmedDecoder), created
+   * from a helper thread when a stream collection is announced and consumed
+   * by reconfigure_output_stream() */
+  GList *prewarmed_decoders;
   /* End of variables protected by selection_lock */
 
   /* List of pending collections.
@@ -360,6 +364,16 @@ struct _DecodebinOutputStream
   gulong drop_probe_id;
 };
 
+/* Decoder instantiated ahead of stream activation, while parsebin is still
+ * working towards the first buffers */
+typedef struct
+{
+  /* The caps the decoder was created for */
+  GstCaps *caps;
+  /* The decoder, in READY and not in any bin, with a floating reference */
+  GstElement *decoder;
+} PrewarmedDecoder;
+
 /* Pending pads from parsebin */
 typedef struct _PendingPad
 {
@@ -507,6 +521,8 @@ static gboolean set_input_group_id (DecodebinInput * input, guint32 * group_id);
 
 static void reconfigure_output_stream (DecodebinOutputStream * output,
     MultiQueueSlot * slot);
+static void prewarm_decoders_cb (GstElement * element, gpointer user_data);
+static void free_prewarmed_decoder (PrewarmedDecoder * pw);
 static void free_output_stream (GstDecodebin3 * dbin,
     DecodebinOutputStream * output);
 static DecodebinOutputStream *create_output_stream (GstDecodebin3 * dbin,
@@ -664,6 +680,9 @@ gst_decodebin3_dispose (GObject * object)
   g_list_free (dbin->to_activate);
   g_list_free (dbin->pending_select_streams);
   g_clear_object (&dbin->collection);
+  g_list_free_full (dbin->prewarmed_decoders,
+      (GDestroyNotify) free_prewarmed_decoder);
+  dbin->prewarmed_decoders = NULL;
 
   free_input (dbin, dbin->main_input);
 
@@ -1582,6 +1601,10 @@ gst_decodebin3_handle_message (GstBin * bin, GstMessage * message)
   if (posting_collection) {
     /* Figure out a selection for that collection */
     update_requested_selection (dbin);
+    /* And speculatively instantiate decoders for it while parsebin is still
+     * working towards the first buffers */
+    gst_element_call_async (GST_ELEMENT_CAST (dbin), prewarm_decoders_cb,
+        NULL, NULL);
   }
 }
 
@@ -2198,6 +2221,141 @@ create_decoder_factory_list (GstDecodebin3 * dbin, GstCaps * caps)
   return res;
 }
 
+static void
+free_prewarmed_decoder (PrewarmedDecoder * pw)
+{
+  gst_element_set_state (pw->decoder, GST_STATE_NULL);
+  gst_object_unref (pw->decoder);
+  gst_caps_unref (pw->caps);
+  g_free (pw);
+}
+
+/* Must be called with SELECTION_LOCK taken */
+static PrewarmedDecoder *
+find_prewarmed_decoder (GstDecodebin3 * dbin, GstCaps * caps)
+{
+  GList *tmp;
+
+  for (tmp = dbin->prewarmed_decoders; tmp; tmp = tmp->next) {
+    PrewarmedDecoder *pw = (PrewarmedDecoder *) tmp->data;
+
+    if (gst_caps_is_equal (pw->caps, caps))
+      return pw;
+  }
+
+  return NULL;
+}
+
+/* Hand out a speculatively created decoder for @caps, or NULL.
+ * Must be called with SELECTION_LOCK taken */
+static GstElement *
+take_prewarmed_decoder (GstDecodebin3 * dbin, GstCaps * caps)
+{
+  PrewarmedDecoder *pw = find_prewarmed_decoder (dbin, caps);
+  GstElement *decoder;
+
+  if (pw == NULL)
+    return NULL;
+
+  decoder = pw->decoder;
+  dbin->prewarmed_decoders = g_list_remove (dbin->prewarmed_decoders, pw);
+  gst_caps_unref (pw->caps);
+  g_free (pw);
+
+  return decoder;
+}
+
+/* Speculatively instantiate a decoder for every stream of the current
+ * collection that will need one, and bring it to READY, so that plugin
+ * loading and hardware context setup happen while parsebin is still pushing
+ * the first buffers towards multiqueue. reconfigure_output_stream() picks
+ * them up when the streams get activated. Runs on a helper thread. */
+static void
+prewarm_decoders_cb (GstElement * element, gpointer user_data)
+{
+  GstDecodebin3 *dbin = (GstDecodebin3 *) element;
+  GstStreamCollection *collection;
+  guint i, nb;
+
+  SELECTION_LOCK (dbin);
+  collection = dbin->collection ? gst_object_ref (dbin->collection) : NULL;
+  SELECTION_UNLOCK (dbin);
+
+  if (collection == NULL)
+    return;
+
+  nb = gst_stream_collection_get_size (collection);
+  for (i = 0; i < nb; i++) {
+    GstStream *stream = gst_stream_collection_get_stream (collection, i);
+    GstCaps *caps = gst_stream_get_caps (stream);
+    GstElement *decoder = NULL;
+    gboolean have_one;
+    GList *factories;
+
+    if (caps == NULL)
+      continue;
+
+    /* Streams we can output as-is don't need any prewarming */
+    if (gst_caps_can_intersect (caps, dbin->caps)) {
+      gst_caps_unref (caps);
+      continue;
+    }
+
+    SELECTION_LOCK (dbin);
+    have_one = find_prewarmed_decoder (dbin, caps) != NULL;
+    SELECTION_UNLOCK (dbin);
+    if (have_one) {
+      gst_caps_unref (caps);
+      continue;
+    }
+
+    factories = create_decoder_factory_list (dbin, caps);
+    if (factories) {
+      decoder =
+          gst_element_factory_create ((GstElementFactory *) factories->data,
+          NULL);
+      gst_plugin_feature_list_free (factories);
+    }
+
+    if (decoder
+        && gst_element_set_state (decoder,
+            GST_STATE_READY) == GST_STATE_CHANGE_FAILURE) {
+      GST_DEBUG_OBJECT (dbin,
+          "Prewarmed decoder '%s' failed to reach READY state, dropping it",
+          GST_ELEMENT_NAME (decoder));
+      gst_element_set_state (decoder, GST_STATE_NULL);
+      gst_object_unref (decoder);
+      decoder = NULL;
+    }
+
+    if (decoder) {
+      PrewarmedDecoder *pw = g_new0 (PrewarmedDecoder, 1);
+
+      GST_DEBUG_OBJECT (dbin, "Prewarmed decoder '%s' for caps %"
+          GST_PTR_FORMAT, GST_ELEMENT_NAME (decoder), caps);
+
+      pw->caps = gst_caps_ref (caps);
+      pw->decoder = decoder;
+
+      SELECTION_LOCK (dbin);
+      if (find_prewarmed_decoder (dbin, caps) == NULL) {
+        dbin->prewarmed_decoders =
+            g_list_append (dbin->prewarmed_decoders, pw);
+        pw = NULL;
+      }
+      SELECTION_UNLOCK (dbin);
+
+      /* somebody else prewarmed the same caps in the meantime */
+      if (pw)
+        free_prewarmed_decoder (pw);
+    }
+
+    gst_caps_unref (caps);
+  }
+
+  gst_object_unref (collection);
+}
+
 static GstPadProbeReturn
 keyframe_waiter_probe (GstPad * pad, GstPadProbeInfo * info,
     DecodebinOutputStream * output)
@@ -2306,15 +2464,26 @@ reconfigure_output_stream (DecodebinOutputStream * output,
   /* If a decoder is required, create one */
   if (needs_decoder) {
     GList *factories, *next_factory;
+    GstElement *prewarmed;
+
+    /* A decoder may have been speculatively instantiated and brought to
+     * READY when the stream collection was announced */
+    prewarmed = take_prewarmed_decoder (dbin, new_caps);
 
     factories = next_factory = create_decoder_factory_list (dbin, new_caps);
     while (!output->decoder) {
       gboolean decoder_failed = FALSE;
 
       /* If we don't have a decoder yet, instantiate one */
-      if (next_factory) {
+      if (prewarmed) {
+        output->decoder = prewarmed;
+        prewarmed = NULL;
+        GST_DEBUG ("Using prewarmed decoder '%s'",
+            GST_ELEMENT_NAME (output->decoder));
+      } else if (next_factory) {
         output->decoder = gst_element_factory_create ((GstElementFactory *)
             next_factory->data, NULL);
+        next_factory = next_factory->next;
         GST_DEBUG ("Created decoder '%s'", GST_ELEMENT_NAME (output->decoder));
       } else
         GST_DEBUG ("Could not find an element for caps %" GST_PTR_FORMAT,
@@ -2378,7 +2547,6 @@ reconfigure_output_stream (DecodebinOutputStream * output,
         gst_bin_remove ((GstBin *) dbin, output->decoder);
         output->decoder = NULL;
       }
-      next_factory = next_factory->next;
     }
     gst_plugin_feature_list_free (factories);
   } else {
@@ -3041,7 +3209,14 @@ gst_decodebin3_change_state (GstElement * element, GstStateChange transition)
   switch (transition) {
     case GST_STATE_CHANGE_PAUSED_TO_READY:
     {
-      GList *tmp;
+      GList *tmp, *prewarmed;
+
+      /* Free unused prewarmed decoders */
+      SELECTION_LOCK (dbin);
+      prewarmed = dbin->prewarmed_decoders;
+      dbin->prewarmed_decoders = NULL;
+      SELECTION_UNLOCK (dbin);
+      g_list_free_full (prewarmed, (GDestroyNotify) free_prewarmed_decoder);
 
       /* Free output streams */
       for (tmp = dbin->output_streams; tmp; tmp = tmp->next) {
@@ -576,9 +576,23 @@ gst_video_rate_setcaps (GstBaseTransform * trans, GstCaps * in_caps,
         videorate->to_rate_numerator);
   }
   videorate->out_frame_count = 0;
+  videorate->out_frame_dur = 0;
+  videorate->out_frame_dur_rem = 0;
   videorate->to_rate_numerator = rate_numerator;
   videorate->to_rate_denominator = rate_denominator;
 
+  /* precompute the output frame duration as quotient and remainder so that
+   * next_ts can be stepped with plain 64 bit additions */
+  if (rate_numerator) {
+    videorate->to_frame_dur_q =
+        (guint64) rate_denominator * GST_SECOND / rate_numerator;
+    videorate->to_frame_dur_r =
+        (guint64) rate_denominator * GST_SECOND % rate_numerator;
+  } else {
+    videorate->to_frame_dur_q = 0;
+    videorate->to_frame_dur_r = 0;
+  }
+
   if (rate_numerator)
     videorate->wanted_diff = gst_util_uint64_scale_int (GST_SECOND,
         rate_denominator, rate_numerator);
@@ -612,6 +626,8 @@ gst_video_rate_reset (GstVideoRate * videorate)
   videorate->out = 0;
   videorate->base_ts = 0;
   videorate->out_frame_count = 0;
+  videorate->out_frame_dur = 0;
+  videorate->out_frame_dur_rem = 0;
   videorate->drop = 0;
   videorate->dup = 0;
   videorate->next_ts = GST_CLOCK_TIME_NONE;
@@ -642,6 +658,8 @@ gst_video_rate_init (GstVideoRate * videorate)
   videorate->from_rate_denominator = 0;
   videorate->to_rate_numerator = 0;
   videorate->to_rate_denominator = 0;
+  videorate->to_frame_dur_q = 0;
+  videorate->to_frame_dur_r = 0;
 
   gst_base_transform_set_gap_aware (GST_BASE_TRANSFORM (videorate), TRUE);
 }
@@ -673,6 +691,18 @@ gst_video_rate_push_buffer (GstVideoRate * videorate, GstBuffer * outbuf,
 
   videorate->out++;
   videorate->out_frame_count++;
+  /* step the precomputed frame duration, carrying the fractional part in
+   * units of 1/to_rate_numerator; this keeps out_frame_dur exactly equal to
+   * floor (out_frame_count * to_rate_denominator * GST_SECOND /
+   * to_rate_numerator) without rescaling per frame */
+  if (videorate->to_rate_numerator) {
+    videorate->out_frame_dur += videorate->to_frame_dur_q;
+    videorate->out_frame_dur_rem += videorate->to_frame_dur_r;
+    if (videorate->out_frame_dur_rem >= (guint64) videorate->to_rate_numerator) {
+      videorate->out_frame_dur_rem -= videorate->to_rate_numerator;
+      videorate->out_frame_dur++;
+    }
+  }
   if (videorate->segment.rate < 0.0) {
     if (videorate->to_rate_numerator) {
       /* interpolate next expected timestamp in the segment */
@@ -702,10 +732,7 @@ gst_video_rate_push_buffer (GstVideoRate * videorate, GstBuffer * outbuf,
       /* interpolate next expected timestamp in the segment */
       videorate->next_ts =
           videorate->segment.base + videorate->segment.start +
-          videorate->base_ts +
-          gst_util_uint64_scale (videorate->out_frame_count,
-          videorate->to_rate_denominator * GST_SECOND,
-          videorate->to_rate_numerator);
+          videorate->base_ts + videorate->out_frame_dur;
       GST_BUFFER_DURATION (outbuf) = videorate->next_ts - push_ts;
     } else {
       /* There must always be a valid duration on prevbuf if rate > 0,
@@ -838,6 +865,8 @@ gst_video_rate_sink_event (GstBaseTransform * trans, GstEvent * event)
 
       videorate->base_ts = 0;
       videorate->out_frame_count = 0;
+      videorate->out_frame_dur = 0;
+      videorate->out_frame_dur_rem = 0;
       videorate->next_ts = GST_CLOCK_TIME_NONE;
 
       /* We just want to update the accumulated stream_time  */
@@ -1447,6 +1476,8 @@ gst_video_rate_apply_pending_rate (GstVideoRate * videorate)
       videorate->to_rate_numerator);
   videorate->rate = videorate->pending_rate;
   videorate->out_frame_count = 0;
+  videorate->out_frame_dur = 0;
+  videorate->out_frame_dur_rem = 0;
 
 done:
   GST_OBJECT_UNLOCK (videorate);
@@ -1541,6 +1572,8 @@ gst_video_rate_transform_ip (GstBaseTransform * trans, GstBuffer * buffer)
           videorate->base_ts = in_ts - videorate->segment.start;
         }
         videorate->out_frame_count = 0;
+        videorate->out_frame_dur = 0;
+        videorate->out_frame_dur_rem = 0;
       } else {
         if (videorate->segment.rate < 0.0) {
           if (videorate->to_rate_numerator) {
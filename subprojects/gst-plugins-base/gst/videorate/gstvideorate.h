@@ -49,6 +49,14 @@ struct _GstVideoRate
                                  * change, whichever was later */
   guint64 base_ts;              /* used in next_ts calculation after a
                                  * frame rate caps change */
+  guint64 out_frame_dur;        /* floor (out_frame_count * output frame
+                                 * duration), maintained incrementally so the
+                                 * steady-state path does not need a 128 bit
+                                 * scale per output frame */
+  guint64 out_frame_dur_rem;    /* remainder of the above, in units of
+                                 * 1/to_rate_numerator second */
+  guint64 to_frame_dur_q;       /* output frame duration, quotient part */
+  guint64 to_frame_dur_r;       /* output frame duration, remainder part */
   gboolean discont;
   guint64 last_ts;              /* Timestamp of last input buffer */
 
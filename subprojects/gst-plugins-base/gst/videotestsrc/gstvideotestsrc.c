@@ -132,6 +132,8 @@ static void gst_video_test_src_get_times (GstBaseSrc * basesrc,
     GstBuffer * buffer, GstClockTime * start, GstClockTime * end);
 static gboolean gst_video_test_src_decide_allocation (GstBaseSrc * bsrc,
     GstQuery * query);
+static GstFlowReturn gst_video_test_src_alloc (GstBaseSrc * bsrc,
+    guint64 offset, guint size, GstBuffer ** buffer);
 static GstFlowReturn gst_video_test_src_fill (GstPushSrc * psrc,
     GstBuffer * buffer);
 static gboolean gst_video_test_src_start (GstBaseSrc * basesrc);
@@ -378,6 +380,7 @@ gst_video_test_src_class_init (GstVideoTestSrcClass * klass)
   gstbasesrc_class->start = gst_video_test_src_start;
   gstbasesrc_class->stop = gst_video_test_src_stop;
   gstbasesrc_class->decide_allocation = gst_video_test_src_decide_allocation;
+  gstbasesrc_class->alloc = gst_video_test_src_alloc;
 
   gstpushsrc_class->fill = gst_video_test_src_fill;
 
@@ -1247,6 +1250,24 @@ invalid_frame:
   }
 }
 
+static GstFlowReturn
+gst_video_test_src_alloc (GstBaseSrc * bsrc, guint64 offset, guint size,
+    GstBuffer ** buffer)
+{
+  GstVideoTestSrc *src = GST_VIDEO_TEST_SRC (bsrc);
+
+  /* For static patterns, hand out shallow copies of the cached pattern
+   * buffer. Each output buffer is a distinct GstBuffer referencing the same
+   * memory, so downstream elements that can't queue the same buffer twice
+   * still see unique buffers while we avoid copying the frame every cycle */
+  if (src->have_static_pattern && src->cached != NULL) {
+    *buffer = gst_buffer_copy (src->cached);
+    return GST_FLOW_OK;
+  }
+
+  return GST_BASE_SRC_CLASS (parent_class)->alloc (bsrc, offset, size, buffer);
+}
+
 static GstFlowReturn
 gst_video_test_src_fill (GstPushSrc * psrc, GstBuffer * buffer)
 {
@@ -1260,30 +1281,31 @@ gst_video_test_src_fill (GstPushSrc * psrc, GstBuffer * buffer)
   gst_object_sync_values (GST_OBJECT (src), pts);
 
   if (src->have_static_pattern) {
-    GstVideoFrame sframe, dframe;
-
     if (src->cached == NULL) {
+      GstVideoFrame sframe, dframe;
+
       src->cached = gst_buffer_new_allocate (NULL, src->info.size, NULL);
 
       ret = fill_image (GST_PUSH_SRC (src), src->cached);
       if (G_UNLIKELY (ret != GST_FLOW_OK))
         goto fill_failed;
-    } else {
-      GST_LOG_OBJECT (src, "Reusing cached pattern buffer");
-    }
 
-    /* Do a memory copy instead of just passing a reference to this buffer to
-     * be consistent with other sources. This should make things clear for
-     * cases where downstream cannot queue the same buffer twice (such as v4l2)
-     */
-    gst_video_frame_map (&sframe, &src->info, src->cached, GST_MAP_READ);
-    gst_video_frame_map (&dframe, &src->info, buffer, GST_MAP_WRITE);
+      gst_video_frame_map (&sframe, &src->info, src->cached, GST_MAP_READ);
+      gst_video_frame_map (&dframe, &src->info, buffer, GST_MAP_WRITE);
 
-    if (!gst_video_frame_copy (&dframe, &sframe))
-      goto copy_failed;
+      if (!gst_video_frame_copy (&dframe, &sframe)) {
+        gst_video_frame_unmap (&sframe);
+        gst_video_frame_unmap (&dframe);
+        goto copy_failed;
+      }
 
-    gst_video_frame_unmap (&sframe);
-    gst_video_frame_unmap (&dframe);
+      gst_video_frame_unmap (&sframe);
+      gst_video_frame_unmap (&dframe);
+    } else {
+      /* Our alloc vfunc returned a shallow copy referencing the cached
+       * pattern memory, nothing to render or copy */
+      GST_LOG_OBJECT (src, "Reusing cached pattern buffer");
+    }
   } else {
     ret = fill_image (GST_PUSH_SRC (src), buffer);
     if (G_UNLIKELY (ret != GST_FLOW_OK))
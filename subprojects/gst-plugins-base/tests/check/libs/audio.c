@@ -1578,6 +1578,56 @@ GST_START_TEST (test_audio_make_raw_caps)
 
 GST_END_TEST;
 
+GST_START_TEST (test_audio_converter_layout_change)
+{
+  GstAudioInfo in_info, out_info;
+  GstAudioConverter *convert;
+  const gint16 in_samples[8] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+  gint16 in_copy[8];
+  gint16 out_l[4], out_r[4];
+  gpointer in[1], out[2];
+  gint i;
+
+  gst_audio_info_init (&in_info);
+  gst_audio_info_set_format (&in_info, GST_AUDIO_FORMAT_S16, 44100, 2, NULL);
+  gst_audio_info_init (&out_info);
+  gst_audio_info_set_format (&out_info, GST_AUDIO_FORMAT_S16, 44100, 2, NULL);
+  out_info.layout = GST_AUDIO_LAYOUT_NON_INTERLEAVED;
+
+  convert = gst_audio_converter_new (GST_AUDIO_CONVERTER_FLAG_NONE, &in_info,
+      &out_info, NULL);
+  fail_unless (convert != NULL);
+
+  /* deinterleave a non-writable input */
+  in[0] = (gpointer) in_samples;
+  out[0] = out_l;
+  out[1] = out_r;
+  fail_unless (gst_audio_converter_samples (convert,
+          GST_AUDIO_CONVERTER_FLAG_NONE, in, 4, out, 4));
+
+  for (i = 0; i < 4; i++) {
+    fail_unless_equals_int (out_l[i], 2 * i);
+    fail_unless_equals_int (out_r[i], 2 * i + 1);
+  }
+
+  /* and again with a writable input */
+  memcpy (in_copy, in_samples, sizeof (in_copy));
+  in[0] = in_copy;
+  memset (out_l, 0, sizeof (out_l));
+  memset (out_r, 0, sizeof (out_r));
+  fail_unless (gst_audio_converter_samples (convert,
+          GST_AUDIO_CONVERTER_FLAG_IN_WRITABLE, in, 4, out, 4));
+
+  for (i = 0; i < 4; i++) {
+    fail_unless_equals_int (out_l[i], 2 * i);
+    fail_unless_equals_int (out_r[i], 2 * i + 1);
+  }
+
+  gst_audio_converter_free (convert);
+}
+
+GST_END_TEST;
+
 static Suite *
 audio_suite (void)
 {
@@ -1616,6 +1666,7 @@ audio_suite (void)
   tcase_add_test (tc_chain, test_audio_buffer_and_audio_meta);
   tcase_add_test (tc_chain, test_audio_info_from_caps);
   tcase_add_test (tc_chain, test_audio_make_raw_caps);
+  tcase_add_test (tc_chain, test_audio_converter_layout_change);
 
   return s;
 }
@@ -2488,6 +2488,53 @@ GST_START_TEST (test_video_scaler)
 
 GST_END_TEST;
 
+GST_START_TEST (test_video_scaler_2d)
+{
+  GstVideoScaler *hscale, *vscale;
+  guint in_w = 320, in_h = 240, out_w = 640, out_h = 720;
+  guint in_stride = in_w * 4, out_stride = out_w * 4;
+  guint8 *src, *dest1, *dest2;
+  guint i, j;
+
+  src = g_malloc (in_stride * in_h);
+  dest1 = g_malloc (out_stride * out_h);
+  dest2 = g_malloc (out_stride * out_h);
+
+  for (i = 0; i < in_h; i++)
+    for (j = 0; j < in_stride; j++)
+      src[i * in_stride + j] = (i + j) & 0xff;
+
+  /* scaling the whole frame at once takes the sliced multi-threaded path */
+  hscale = gst_video_scaler_new (GST_VIDEO_RESAMPLER_METHOD_LINEAR,
+      GST_VIDEO_SCALER_FLAG_NONE, 2, in_w, out_w, NULL);
+  vscale = gst_video_scaler_new (GST_VIDEO_RESAMPLER_METHOD_LINEAR,
+      GST_VIDEO_SCALER_FLAG_NONE, 2, in_h, out_h, NULL);
+  gst_video_scaler_2d (hscale, vscale, GST_VIDEO_FORMAT_ARGB,
+      src, in_stride, dest1, out_stride, 0, 0, out_w, out_h);
+  gst_video_scaler_free (hscale);
+  gst_video_scaler_free (vscale);
+
+  /* doing the same in small bands stays on the serial path and must
+   * produce the same image */
+  hscale = gst_video_scaler_new (GST_VIDEO_RESAMPLER_METHOD_LINEAR,
+      GST_VIDEO_SCALER_FLAG_NONE, 2, in_w, out_w, NULL);
+  vscale = gst_video_scaler_new (GST_VIDEO_RESAMPLER_METHOD_LINEAR,
+      GST_VIDEO_SCALER_FLAG_NONE, 2, in_h, out_h, NULL);
+  for (i = 0; i < out_h; i += 48)
+    gst_video_scaler_2d (hscale, vscale, GST_VIDEO_FORMAT_ARGB,
+        src, in_stride, dest2, out_stride, 0, i, out_w, MIN (i + 48, out_h));
+  gst_video_scaler_free (hscale);
+  gst_video_scaler_free (vscale);
+
+  fail_unless (memcmp (dest1, dest2, out_stride * out_h) == 0);
+
+  g_free (src);
+  g_free (dest1);
+  g_free (dest2);
+}
+
+GST_END_TEST;
+
 typedef enum
 {
   RGB,
@@ -2706,6 +2753,78 @@ GST_END_TEST;
 #undef WIDTH
 #undef HEIGHT
 
+GST_START_TEST (test_video_convert_nv12_i420)
+{
+  GstVideoInfo in_info, out_info;
+  GstVideoFrame in_frame, out_frame, back_frame;
+  GstBuffer *in_buffer, *out_buffer, *back_buffer;
+  GstVideoConverter *convert;
+  guint8 *s, *d;
+  gint i, j, stride;
+
+  fail_unless (gst_video_info_set_format (&in_info, GST_VIDEO_FORMAT_NV12,
+          320, 240));
+  in_buffer = gst_buffer_new_and_alloc (in_info.size);
+  gst_buffer_memset (in_buffer, 0, 0, -1);
+  gst_video_frame_map (&in_frame, &in_info, in_buffer, GST_MAP_READWRITE);
+
+  /* fill the chroma plane with a U/V ramp */
+  s = GST_VIDEO_FRAME_PLANE_DATA (&in_frame, 1);
+  stride = GST_VIDEO_FRAME_PLANE_STRIDE (&in_frame, 1);
+  for (i = 0; i < 120; i++) {
+    for (j = 0; j < 160; j++) {
+      s[i * stride + 2 * j] = j & 0xff;
+      s[i * stride + 2 * j + 1] = (i + j) & 0xff;
+    }
+  }
+
+  fail_unless (gst_video_info_set_format (&out_info, GST_VIDEO_FORMAT_I420,
+          320, 240));
+  out_buffer = gst_buffer_new_and_alloc (out_info.size);
+  gst_video_frame_map (&out_frame, &out_info, out_buffer, GST_MAP_READWRITE);
+
+  convert = gst_video_converter_new (&in_info, &out_info, NULL);
+  gst_video_converter_frame (convert, &in_frame, &out_frame);
+  gst_video_converter_free (convert);
+
+  /* the interleaved chroma must have been split into the two planes */
+  d = GST_VIDEO_FRAME_PLANE_DATA (&out_frame, 1);
+  stride = GST_VIDEO_FRAME_PLANE_STRIDE (&out_frame, 1);
+  for (i = 0; i < 120; i++)
+    for (j = 0; j < 160; j++)
+      fail_unless_equals_int (d[i * stride + j], j & 0xff);
+
+  d = GST_VIDEO_FRAME_PLANE_DATA (&out_frame, 2);
+  stride = GST_VIDEO_FRAME_PLANE_STRIDE (&out_frame, 2);
+  for (i = 0; i < 120; i++)
+    for (j = 0; j < 160; j++)
+      fail_unless_equals_int (d[i * stride + j], (i + j) & 0xff);
+
+  /* and converting back must give the original interleaved plane */
+  back_buffer = gst_buffer_new_and_alloc (in_info.size);
+  gst_video_frame_map (&back_frame, &in_info, back_buffer, GST_MAP_READWRITE);
+
+  convert = gst_video_converter_new (&out_info, &in_info, NULL);
+  gst_video_converter_frame (convert, &out_frame, &back_frame);
+  gst_video_converter_free (convert);
+
+  s = GST_VIDEO_FRAME_PLANE_DATA (&in_frame, 1);
+  d = GST_VIDEO_FRAME_PLANE_DATA (&back_frame, 1);
+  stride = GST_VIDEO_FRAME_PLANE_STRIDE (&back_frame, 1);
+  for (i = 0; i < 120; i++)
+    fail_unless (memcmp (d + i * stride,
+            s + i * GST_VIDEO_FRAME_PLANE_STRIDE (&in_frame, 1), 320) == 0);
+
+  gst_video_frame_unmap (&back_frame);
+  gst_buffer_unref (back_buffer);
+  gst_video_frame_unmap (&out_frame);
+  gst_buffer_unref (out_buffer);
+  gst_video_frame_unmap (&in_frame);
+  gst_buffer_unref (in_buffer);
+}
+
+GST_END_TEST;
+
 GST_START_TEST (test_video_convert)
 {
   GstVideoInfo ininfo, outinfo;
@@ -4074,6 +4193,7 @@ video_suite (void)
   tcase_add_test (tc_chain, test_video_chroma);
   tcase_add_test (tc_chain, test_video_chroma_site);
   tcase_add_test (tc_chain, test_video_scaler);
+  tcase_add_test (tc_chain, test_video_scaler_2d);
   tcase_add_test (tc_chain, test_video_color_convert_rgb_rgb);
   tcase_add_test (tc_chain, test_video_color_convert_rgb_yuv);
   tcase_add_test (tc_chain, test_video_color_convert_yuv_yuv);
@@ -4081,6 +4201,7 @@ video_suite (void)
   tcase_add_test (tc_chain, test_video_color_convert_other);
   tcase_add_test (tc_chain, test_video_size_convert);
   tcase_add_test (tc_chain, test_video_convert);
+  tcase_add_test (tc_chain, test_video_convert_nv12_i420);
   tcase_add_test (tc_chain, test_video_convert_multithreading);
   tcase_add_test (tc_chain, test_video_transfer);
   tcase_add_test (tc_chain, test_overlay_blend);
@@ -679,22 +679,60 @@ gst_jpeg_dec_decode_grayscale (GstJpegDec * dec, GstVideoFrame * frame,
   gint width, height;
   gint pstride, rstride;
 
-  GST_DEBUG_OBJECT (dec, "indirect decoding of grayscale");
-
   width = GST_VIDEO_FRAME_WIDTH (frame);
   height = GST_VIDEO_FRAME_HEIGHT (frame) / num_fields;
 
+  base[0] = GST_VIDEO_FRAME_COMP_DATA (frame, 0);
+  pstride = GST_VIDEO_FRAME_COMP_PSTRIDE (frame, 0);
+  rstride = GST_VIDEO_FRAME_COMP_STRIDE (frame, 0) * num_fields;
+
+  /* if the line padding works out, let jpeglib decode straight into the
+   * output frame; jpeglib writes whole multiples of DCTSIZE pixels per row,
+   * so the width must be aligned for that to be safe */
+  if (pstride == 1 && (width % DCTSIZE) == 0) {
+    guchar *last;
+
+    GST_DEBUG_OBJECT (dec, "direct decoding of grayscale");
+
+    /* make sure we don't make jpeglib write beyond our buffer,
+     * which might happen if (height % DCTSIZE) != 0 */
+    last = base[0] + (GST_VIDEO_FRAME_COMP_STRIDE (frame, 0) *
+        (GST_VIDEO_FRAME_COMP_HEIGHT (frame, 0) - 1));
+
+    if (field == 2)
+      base[0] += GST_VIDEO_FRAME_COMP_STRIDE (frame, 0);
+
+    if ((height % DCTSIZE) && (dec->scratch_size < rstride)) {
+      g_free (dec->scratch);
+      dec->scratch = g_malloc (rstride);
+      dec->scratch_size = rstride;
+    }
+
+    for (i = 0; i < height; i += DCTSIZE) {
+      for (j = 0; j < DCTSIZE; j++) {
+        rows[j] = base[0] + (i + j) * rstride;
+        if (G_UNLIKELY (rows[j] > last))
+          rows[j] = dec->scratch;
+      }
+
+      lines = jpeg_read_raw_data (&dec->cinfo, scanarray, DCTSIZE);
+      if (G_UNLIKELY (!lines)) {
+        GST_INFO_OBJECT (dec, "jpeg_read_raw_data() returned 0");
+      }
+    }
+    return;
+  }
+
+  GST_CAT_LOG_OBJECT (GST_CAT_PERFORMANCE, dec,
+      "indirect decoding of grayscale");
+
   if (G_UNLIKELY (!gst_jpeg_dec_ensure_buffers (dec, GST_ROUND_UP_32 (width))))
     return;
 
-  base[0] = GST_VIDEO_FRAME_COMP_DATA (frame, 0);
   if (field == 2) {
     base[0] += GST_VIDEO_FRAME_COMP_STRIDE (frame, 0);
   }
 
-  pstride = GST_VIDEO_FRAME_COMP_PSTRIDE (frame, 0);
-  rstride = GST_VIDEO_FRAME_COMP_STRIDE (frame, 0) * num_fields;
-
   memcpy (rows, dec->idr_y, 16 * sizeof (gpointer));
 
   i = 0;
@@ -702,12 +740,16 @@ gst_jpeg_dec_decode_grayscale (GstJpegDec * dec, GstVideoFrame * frame,
     lines = jpeg_read_raw_data (&dec->cinfo, scanarray, DCTSIZE);
     if (G_LIKELY (lines > 0)) {
       for (j = 0; (j < DCTSIZE) && (i < height); j++, i++) {
-        gint p;
-
-        p = 0;
-        for (k = 0; k < width; k++) {
-          base[0][p] = rows[j][k];
-          p += pstride;
+        if (pstride == 1) {
+          memcpy (base[0], rows[j], width);
+        } else {
+          gint p;
+
+          p = 0;
+          for (k = 0; k < width; k++) {
+            base[0][p] = rows[j][k];
+            p += pstride;
+          }
         }
         base[0] += rstride;
       }
@@ -1091,6 +1091,13 @@ _session_ready_cb (gpointer user_data)
   return FALSE;
 }
 
+/* Process-wide fallback session, so that short-lived sources created for
+ * e.g. adaptive streaming fragment or variant switches reuse connections
+ * and TLS sessions even when the application does not distribute a session
+ * via the context mechanism. Only a weak reference is kept; the session
+ * goes away with the last source using it. */
+static GWeakRef gst_soup_http_src_default_session;
+
 /* called with session_mutex taken */
 static gboolean
 gst_soup_http_src_session_open (GstSoupHTTPSrc * src)
@@ -1147,6 +1154,14 @@ gst_soup_http_src_session_open (GstSoupHTTPSrc * src)
       g_signal_connect (src->session->session, "authenticate",
           G_CALLBACK (gst_soup_http_src_authenticate_cb_2), src);
     }
+  } else if (can_share && (src->session =
+          g_weak_ref_get (&gst_soup_http_src_default_session))) {
+    GST_DEBUG_OBJECT (src, "Reusing process-wide session %p", src->session);
+    /* for soup2, connect another authenticate handler; see thread_func */
+    if (gst_soup_loader_get_api_version () < 3) {
+      g_signal_connect (src->session->session, "authenticate",
+          G_CALLBACK (gst_soup_http_src_authenticate_cb_2), src);
+    }
   } else {
     GMainContext *ctx;
     GSource *source;
@@ -1180,6 +1195,9 @@ gst_soup_http_src_session_open (GstSoupHTTPSrc * src)
     while (!g_main_loop_is_running (src->session->loop))
       g_cond_wait (&src->session_cond, &src->session_mutex);
     GST_DEBUG_OBJECT (src, "Soup thread started");
+
+    if (can_share)
+      g_weak_ref_set (&gst_soup_http_src_default_session, src->session);
   }
 
   GST_OBJECT_UNLOCK (src);
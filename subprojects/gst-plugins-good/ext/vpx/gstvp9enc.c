@@ -37,6 +37,17 @@
  * for explanation, examples for useful encoding parameters and more details
  * on the encoding parameters.
  *
+ * ## Multithreading
+ *
+ * Encoder threads are spawned by libvpx per element instance. The
+ * #GstVPXEnc:threads property sets the maximum per instance (0 means a
+ * single thread), and threads beyond one are only put to use when the
+ * picture is split with #GstVP9Enc:tile-columns/#GstVP9Enc:tile-rows or
+ * #GstVP9Enc:row-mt is enabled. When running many encoder instances in one
+ * process (e.g. simulcast), the total thread count is the per-instance
+ * setting times the number of instances, so keep #GstVPXEnc:threads small
+ * per instance to stay proportional to the available cores.
+ *
  * ## Example pipeline
  * |[
  * gst-launch-1.0 -v videotestsrc num-buffers=1000 ! vp9enc ! webmmux ! filesink location=videotestsrc.webm
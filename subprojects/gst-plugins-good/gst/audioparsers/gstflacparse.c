@@ -150,10 +150,8 @@ static const guint16 crc16_table[256] = {
 };
 
 static guint16
-gst_flac_calculate_crc16 (const guint8 * data, guint length)
+gst_flac_update_crc16 (guint16 crc, const guint8 * data, guint length)
 {
-  guint16 crc = 0;
-
   while (length--) {
     crc = ((crc << 8) ^ crc16_table[(crc >> 8) ^ *data]) & 0xffff;
     data++;
@@ -657,6 +655,8 @@ gst_flac_parse_frame_is_valid (GstFlacParse * flacparse,
   FrameHeaderCheckReturn header_ret;
   guint16 block_size;
   gboolean suspect_start = FALSE, suspect_end = FALSE;
+  guint16 crc = 0;
+  guint crc_pos = 0;
 
   if (size < flacparse->min_framesize)
     goto need_more;
@@ -693,9 +693,16 @@ gst_flac_parse_frame_is_valid (GstFlacParse * flacparse,
         remaining, FALSE, NULL, &suspect_end);
     if (header_ret == FRAME_HEADER_VALID) {
       if (flacparse->check_frame_checksums || suspect_start || suspect_end) {
-        guint16 actual_crc = gst_flac_calculate_crc16 (data, i - 2);
+        guint16 actual_crc;
         guint16 expected_crc = GST_READ_UINT16_BE (data + i - 2);
 
+        /* Candidate offsets only grow, so extend the running CRC with
+         * the new bytes instead of recomputing the whole prefix for
+         * every candidate frame end */
+        crc = gst_flac_update_crc16 (crc, data + crc_pos, i - 2 - crc_pos);
+        crc_pos = i - 2;
+        actual_crc = crc;
+
         GST_LOG_OBJECT (flacparse,
             "Found possible frame (%d, %d). Checking for CRC match",
             suspect_start, suspect_end);
@@ -717,7 +724,8 @@ gst_flac_parse_frame_is_valid (GstFlacParse * flacparse,
   /* For the last frame output everything to the end */
   if (G_UNLIKELY (GST_BASE_PARSE_DRAINING (flacparse))) {
     if (flacparse->check_frame_checksums) {
-      guint16 actual_crc = gst_flac_calculate_crc16 (data, size - 2);
+      guint16 actual_crc =
+          gst_flac_update_crc16 (crc, data + crc_pos, size - 2 - crc_pos);
       guint16 expected_crc = GST_READ_UINT16_BE (data + size - 2);
 
       if (actual_crc == expected_crc) {
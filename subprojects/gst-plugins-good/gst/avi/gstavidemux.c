@@ -1336,7 +1336,9 @@ gst_avi_demux_add_index (GstAviDemux * avi, GstAviStream * stream,
        * overshoot with at least 8K */
       idx_max = (num / avi->num_streams) + (8192 / sizeof (GstAviIndexEntry));
     } else {
-      idx_max += 8192 / sizeof (GstAviIndexEntry);
+      /* grow geometrically; growing in constant steps makes building an
+       * index with millions of entries quadratic in the number of entries */
+      idx_max += MAX (idx_max / 2, 8192 / sizeof (GstAviIndexEntry));
       GST_DEBUG_OBJECT (avi, "expanded index from %u to %u",
           stream->idx_max, idx_max);
     }
@@ -1467,6 +1469,18 @@ gst_avi_demux_do_index_stats (GstAviDemux * avi)
     if (G_UNLIKELY (!stream->index || stream->idx_n == 0))
       continue;
 
+    /* the index is complete now, return the memory overallocated for
+     * growing to the system */
+    if (stream->idx_max > stream->idx_n) {
+      GstAviIndexEntry *new_idx;
+
+      new_idx = g_try_renew (GstAviIndexEntry, stream->index, stream->idx_n);
+      if (G_LIKELY (new_idx)) {
+        stream->index = new_idx;
+        stream->idx_max = stream->idx_n;
+      }
+    }
+
     /* we interested in the end_ts of the last entry, which is the total
      * duration of this stream */
     gst_avi_demux_get_buffer_info (avi, stream, stream->idx_n - 1,
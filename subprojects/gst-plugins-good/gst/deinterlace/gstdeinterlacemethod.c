@@ -374,6 +374,157 @@ get_line (LinesGetter * lg, gint field_offset, guint plane, gint line,
   return data;
 }
 
+/* One horizontal band of scanlines processed by a pool worker. Bands are
+ * independent: all neighbouring input lines are fetched per output line
+ * via get_line(), so no state is carried between scanlines. */
+typedef struct
+{
+  GstDeinterlaceSimpleMethod *self;
+  GstVideoFrame *dest;
+  LinesGetter *lg;
+  guint cur_field_flags;
+  gint plane;
+  gint frame_width;
+  GstDeinterlaceSimpleMethodFunction copy_scanline;
+  GstDeinterlaceSimpleMethodFunction interpolate_scanline;
+  gint start_line;
+  gint end_line;
+} GstDeinterlaceSimpleMethodBand;
+
+/* Bands smaller than this are not worth the synchronisation overhead */
+#define GST_DEINTERLACE_MIN_BAND_HEIGHT 64
+
+static void
+gst_deinterlace_simple_method_process_band (const GstDeinterlaceSimpleMethodBand
+    * band)
+{
+  GstDeinterlaceSimpleMethod *self = band->self;
+  GstVideoFrame *dest = band->dest;
+  LinesGetter *lg = band->lg;
+  gint plane = band->plane;
+  gint frame_width = band->frame_width;
+  GstDeinterlaceScanlineData scanlines;
+  gint i;
+
+#define LINE(x,i) (((guint8*)GST_VIDEO_FRAME_PLANE_DATA((x),plane)) + i * \
+    GST_VIDEO_FRAME_PLANE_STRIDE((x),plane))
+
+  for (i = band->start_line; i < band->end_line; i++) {
+    memset (&scanlines, 0, sizeof (scanlines));
+    scanlines.bottom_field =
+        (band->cur_field_flags == PICTURE_INTERLACED_BOTTOM);
+
+    if (!((i & 1) ^ scanlines.bottom_field)) {
+      /* copying */
+      scanlines.tp = get_line (lg, -1, plane, i, -1);
+      scanlines.bp = get_line (lg, -1, plane, i, 1);
+
+      scanlines.tt0 = get_line (lg, 0, plane, i, -2);
+      scanlines.m0 = get_line (lg, 0, plane, i, 0);
+      scanlines.bb0 = get_line (lg, 0, plane, i, 2);
+
+      scanlines.t1 = get_line (lg, 1, plane, i, -1);
+      scanlines.b1 = get_line (lg, 1, plane, i, 1);
+
+      scanlines.tt2 = get_line (lg, 2, plane, i, -2);
+      scanlines.m2 = get_line (lg, 2, plane, i, 0);
+      scanlines.bb2 = get_line (lg, 2, plane, i, 2);
+
+      band->copy_scanline (self, LINE (dest, i), &scanlines, frame_width);
+    } else {
+      /* interpolating */
+      scanlines.tp2 = get_line (lg, -2, plane, i, -1);
+      scanlines.bp2 = get_line (lg, -2, plane, i, 1);
+
+      scanlines.ttp = get_line (lg, -1, plane, i, -2);
+      scanlines.mp = get_line (lg, -1, plane, i, 0);
+      scanlines.bbp = get_line (lg, -1, plane, i, 2);
+
+      scanlines.t0 = get_line (lg, 0, plane, i, -1);
+      scanlines.b0 = get_line (lg, 0, plane, i, 1);
+
+      scanlines.tt1 = get_line (lg, 1, plane, i, -2);
+      scanlines.m1 = get_line (lg, 1, plane, i, 0);
+      scanlines.bb1 = get_line (lg, 1, plane, i, 2);
+
+      scanlines.t2 = get_line (lg, 2, plane, i, -1);
+      scanlines.b2 = get_line (lg, 2, plane, i, 1);
+
+      band->interpolate_scanline (self, LINE (dest, i), &scanlines,
+          frame_width);
+    }
+#undef LINE
+  }
+}
+
+static void
+gst_deinterlace_simple_method_band_worker (gpointer data, gpointer user_data)
+{
+  const GstDeinterlaceSimpleMethodBand *band = data;
+  GstDeinterlaceSimpleMethod *self = band->self;
+
+  gst_deinterlace_simple_method_process_band (band);
+
+  g_mutex_lock (&self->task_lock);
+  self->tasks_remaining--;
+  g_cond_signal (&self->task_cond);
+  g_mutex_unlock (&self->task_lock);
+}
+
+static void
+gst_deinterlace_simple_method_process_plane (GstDeinterlaceSimpleMethod * self,
+    GstVideoFrame * dest, LinesGetter * lg, guint cur_field_flags, gint plane,
+    gint frame_width, GstDeinterlaceSimpleMethodFunction copy_scanline,
+    GstDeinterlaceSimpleMethodFunction interpolate_scanline)
+{
+  GstDeinterlaceSimpleMethodBand *bands;
+  gint frame_height = GST_VIDEO_FRAME_COMP_HEIGHT (dest, plane);
+  gint band_height, n_bands, i;
+
+  n_bands = frame_height / GST_DEINTERLACE_MIN_BAND_HEIGHT;
+  n_bands = CLAMP (n_bands, 1, (gint) self->n_threads);
+
+  bands = g_newa (GstDeinterlaceSimpleMethodBand, n_bands);
+  band_height = frame_height / n_bands;
+
+  for (i = 0; i < n_bands; i++) {
+    bands[i].self = self;
+    bands[i].dest = dest;
+    bands[i].lg = lg;
+    bands[i].cur_field_flags = cur_field_flags;
+    bands[i].plane = plane;
+    bands[i].frame_width = frame_width;
+    bands[i].copy_scanline = copy_scanline;
+    bands[i].interpolate_scanline = interpolate_scanline;
+    bands[i].start_line = i * band_height;
+    bands[i].end_line = (i == n_bands - 1) ? frame_height : (i + 1)
+        * band_height;
+  }
+
+  if (n_bands == 1 || self->task_pool == NULL) {
+    bands[0].end_line = frame_height;
+    gst_deinterlace_simple_method_process_band (&bands[0]);
+    return;
+  }
+
+  g_mutex_lock (&self->task_lock);
+  self->tasks_remaining = n_bands - 1;
+  g_mutex_unlock (&self->task_lock);
+
+  for (i = 0; i < n_bands - 1; i++) {
+    if (!g_thread_pool_push (self->task_pool, &bands[i], NULL))
+      gst_deinterlace_simple_method_band_worker (&bands[i], NULL);
+  }
+
+  /* the last band is processed on the streaming thread */
+  gst_deinterlace_simple_method_process_band (&bands[n_bands - 1]);
+
+  g_mutex_lock (&self->task_lock);
+  while (self->tasks_remaining > 0)
+    g_cond_wait (&self->task_cond, &self->task_lock);
+  g_mutex_unlock (&self->task_lock);
+}
+
 static void
 gst_deinterlace_simple_method_deinterlace_frame_packed (GstDeinterlaceMethod *
     method, const GstDeinterlaceField * history, guint history_count,
@@ -383,17 +534,14 @@ gst_deinterlace_simple_method_deinterlace_frame_packed (GstDeinterlaceMethod *
 #ifndef G_DISABLE_ASSERT
   GstDeinterlaceMethodClass *dm_class = GST_DEINTERLACE_METHOD_GET_CLASS (self);
 #endif
-  GstDeinterlaceScanlineData scanlines;
   guint cur_field_flags;
-  gint i;
-  gint frame_height, frame_width;
+  gint frame_width;
   LinesGetter lg = { history, history_count, cur_field_idx };
   GstVideoFrame *framep, *frame0, *frame1, *frame2;
 
   g_assert (self->interpolate_scanline_packed != NULL);
   g_assert (self->copy_scanline_packed != NULL);
 
-  frame_height = GST_VIDEO_FRAME_HEIGHT (outframe);
   frame_width = GST_VIDEO_FRAME_PLANE_STRIDE (outframe, 0);
 
   frame0 = history[cur_field_idx].frame;
@@ -418,55 +566,9 @@ gst_deinterlace_simple_method_deinterlace_frame_packed (GstDeinterlaceMethod *
   if (frame2)
     frame_width = MIN (frame_width, GST_VIDEO_FRAME_PLANE_STRIDE (frame2, 0));
 
-#define LINE(x,i) (((guint8*)GST_VIDEO_FRAME_PLANE_DATA((x),0)) + i * \
-    GST_VIDEO_FRAME_PLANE_STRIDE((x),0))
-
-  for (i = 0; i < frame_height; i++) {
-    memset (&scanlines, 0, sizeof (scanlines));
-    scanlines.bottom_field = (cur_field_flags == PICTURE_INTERLACED_BOTTOM);
-
-    if (!((i & 1) ^ scanlines.bottom_field)) {
-      /* copying */
-      scanlines.tp = get_line (&lg, -1, 0, i, -1);
-      scanlines.bp = get_line (&lg, -1, 0, i, 1);
-
-      scanlines.tt0 = get_line (&lg, 0, 0, i, -2);
-      scanlines.m0 = get_line (&lg, 0, 0, i, 0);
-      scanlines.bb0 = get_line (&lg, 0, 0, i, 2);
-
-      scanlines.t1 = get_line (&lg, 1, 0, i, -1);
-      scanlines.b1 = get_line (&lg, 1, 0, i, 1);
-
-      scanlines.tt2 = get_line (&lg, 2, 0, i, -2);
-      scanlines.m2 = get_line (&lg, 2, 0, i, 0);
-      scanlines.bb2 = get_line (&lg, 2, 0, i, 2);
-
-      self->copy_scanline_packed (self, LINE (outframe, i), &scanlines,
-          frame_width);
-    } else {
-      /* interpolating */
-      scanlines.tp2 = get_line (&lg, -2, 0, i, -1);
-      scanlines.bp2 = get_line (&lg, -2, 0, i, 1);
-
-      scanlines.ttp = get_line (&lg, -1, 0, i, -2);
-      scanlines.mp = get_line (&lg, -1, 0, i, 0);
-      scanlines.bbp = get_line (&lg, -1, 0, i, 2);
-
-      scanlines.t0 = get_line (&lg, 0, 0, i, -1);
-      scanlines.b0 = get_line (&lg, 0, 0, i, 1);
-
-      scanlines.tt1 = get_line (&lg, 1, 0, i, -2);
-      scanlines.m1 = get_line (&lg, 1, 0, i, 0);
-      scanlines.bb1 = get_line (&lg, 1, 0, i, 2);
-
-      scanlines.t2 = get_line (&lg, 2, 0, i, -1);
-      scanlines.b2 = get_line (&lg, 2, 0, i, 1);
-
-      self->interpolate_scanline_packed (self, LINE (outframe, i), &scanlines,
-          frame_width);
-    }
-#undef LINE
-  }
+  gst_deinterlace_simple_method_process_plane (self, outframe, &lg,
+      cur_field_flags, 0, frame_width, self->copy_scanline_packed,
+      self->interpolate_scanline_packed);
 }
 
 static void
@@ -525,64 +627,16 @@ static void
     GstDeinterlaceSimpleMethodFunction copy_scanline,
     GstDeinterlaceSimpleMethodFunction interpolate_scanline)
 {
-  GstDeinterlaceScanlineData scanlines;
-  gint i;
-  gint frame_height, frame_width;
+  gint frame_width;
 
-  frame_height = GST_VIDEO_FRAME_COMP_HEIGHT (dest, plane);
   frame_width = GST_VIDEO_FRAME_COMP_WIDTH (dest, plane) *
       GST_VIDEO_FRAME_COMP_PSTRIDE (dest, plane);
 
   g_assert (interpolate_scanline != NULL);
   g_assert (copy_scanline != NULL);
 
-#define LINE(x,i) (((guint8*)GST_VIDEO_FRAME_PLANE_DATA((x),plane)) + i * \
-    GST_VIDEO_FRAME_PLANE_STRIDE((x),plane))
-
-  for (i = 0; i < frame_height; i++) {
-    memset (&scanlines, 0, sizeof (scanlines));
-    scanlines.bottom_field = (cur_field_flags == PICTURE_INTERLACED_BOTTOM);
-
-    if (!((i & 1) ^ scanlines.bottom_field)) {
-      /* copying */
-      scanlines.tp = get_line (lg, -1, plane, i, -1);
-      scanlines.bp = get_line (lg, -1, plane, i, 1);
-
-      scanlines.tt0 = get_line (lg, 0, plane, i, -2);
-      scanlines.m0 = get_line (lg, 0, plane, i, 0);
-      scanlines.bb0 = get_line (lg, 0, plane, i, 2);
-
-      scanlines.t1 = get_line (lg, 1, plane, i, -1);
-      scanlines.b1 = get_line (lg, 1, plane, i, 1);
-
-      scanlines.tt2 = get_line (lg, 2, plane, i, -2);
-      scanlines.m2 = get_line (lg, 2, plane, i, 0);
-      scanlines.bb2 = get_line (lg, 2, plane, i, 2);
-
-      copy_scanline (self, LINE (dest, i), &scanlines, frame_width);
-    } else {
-      /* interpolating */
-      scanlines.tp2 = get_line (lg, -2, plane, i, -1);
-      scanlines.bp2 = get_line (lg, -2, plane, i, 1);
-
-      scanlines.ttp = get_line (lg, -1, plane, i, -2);
-      scanlines.mp = get_line (lg, -1, plane, i, 0);
-      scanlines.bbp = get_line (lg, -1, plane, i, 2);
-
-      scanlines.t0 = get_line (lg, 0, plane, i, -1);
-      scanlines.b0 = get_line (lg, 0, plane, i, 1);
-
-      scanlines.tt1 = get_line (lg, 1, plane, i, -2);
-      scanlines.m1 = get_line (lg, 1, plane, i, 0);
-      scanlines.bb1 = get_line (lg, 1, plane, i, 2);
-
-      scanlines.t2 = get_line (lg, 2, plane, i, -1);
-      scanlines.b2 = get_line (lg, 2, plane, i, 1);
-
-      interpolate_scanline (self, LINE (dest, i), &scanlines, frame_width);
-    }
-#undef LINE
-  }
+  gst_deinterlace_simple_method_process_plane (self, dest, lg,
+      cur_field_flags, plane, frame_width, copy_scanline, interpolate_scanline);
 }
 
 static void
@@ -748,12 +802,29 @@ gst_deinterlace_simple_method_setup (GstDeinterlaceMethod * method,
   }
 }
 
+static void
+gst_deinterlace_simple_method_finalize (GObject * object)
+{
+  GstDeinterlaceSimpleMethod *self = GST_DEINTERLACE_SIMPLE_METHOD (object);
+
+  if (self->task_pool)
+    g_thread_pool_free (self->task_pool, FALSE, TRUE);
+  g_mutex_clear (&self->task_lock);
+  g_cond_clear (&self->task_cond);
+
+  G_OBJECT_CLASS (gst_deinterlace_simple_method_parent_class)->finalize
+      (object);
+}
+
 static void
 gst_deinterlace_simple_method_class_init (GstDeinterlaceSimpleMethodClass
     * klass)
 {
+  GObjectClass *gobject_class = (GObjectClass *) klass;
   GstDeinterlaceMethodClass *dm_class = (GstDeinterlaceMethodClass *) klass;
 
+  gobject_class->finalize = gst_deinterlace_simple_method_finalize;
+
   dm_class->deinterlace_frame_ayuv =
       gst_deinterlace_simple_method_deinterlace_frame_packed;
   dm_class->deinterlace_frame_yuy2 =
@@ -851,7 +922,23 @@ gst_deinterlace_simple_method_class_init (GstDeinterlaceSimpleMethodClass
       gst_deinterlace_simple_method_copy_scanline_planar_v;
 }
 
+/* More threads than this stop paying off for the band sizes we produce */
+#define GST_DEINTERLACE_MAX_BAND_THREADS 8
+
 static void
 gst_deinterlace_simple_method_init (GstDeinterlaceSimpleMethod * self)
 {
+  g_mutex_init (&self->task_lock);
+  g_cond_init (&self->task_cond);
+
+  self->n_threads =
+      MIN (g_get_num_processors (), GST_DEINTERLACE_MAX_BAND_THREADS);
+  if (self->n_threads > 1) {
+    /* one band is always processed on the streaming thread itself */
+    self->task_pool =
+        g_thread_pool_new (gst_deinterlace_simple_method_band_worker, self,
+        self->n_threads - 1, FALSE, NULL);
+    if (self->task_pool == NULL)
+      self->n_threads = 1;
+  }
 }
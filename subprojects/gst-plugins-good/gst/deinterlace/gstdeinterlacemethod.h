@@ -173,6 +173,15 @@ struct _GstDeinterlaceSimpleMethod {
 
   GstDeinterlaceSimpleMethodFunction interpolate_scanline_planar[3];
   GstDeinterlaceSimpleMethodFunction copy_scanline_planar[3];
+
+  /* Scanlines are split into horizontal bands that are processed in
+   * parallel on a small worker pool, with one band always staying on
+   * the streaming thread. NULL if only a single CPU is available. */
+  GThreadPool *task_pool;
+  guint n_threads;
+  GMutex task_lock;
+  GCond task_cond;
+  guint tasks_remaining;
 };
 
 struct _GstDeinterlaceSimpleMethodClass {
@@ -396,6 +396,7 @@ gst_iir_equalizer_finalize (GObject * object)
 
   g_free (equ->bands);
   g_free (equ->history);
+  g_free (equ->coeff);
 
   g_mutex_clear (&equ->bands_lock);
 
@@ -613,6 +614,15 @@ update_coefficients (GstIirEqualizer * equ)
       setup_high_shelf_filter (equ, equ->bands[i]);
   }
 
+  equ->coeff = g_renew (gdouble, equ->coeff, 5 * n);
+  for (i = 0; i < n; i++) {
+    equ->coeff[5 * i + 0] = equ->bands[i]->a0;
+    equ->coeff[5 * i + 1] = equ->bands[i]->a1;
+    equ->coeff[5 * i + 2] = equ->bands[i]->a2;
+    equ->coeff[5 * i + 3] = equ->bands[i]->b1;
+    equ->coeff[5 * i + 4] = equ->bands[i]->b2;
+  }
+
   equ->need_new_coefficients = FALSE;
 }
 
@@ -724,13 +734,13 @@ typedef struct {                                                        \
 } SecondOrderHistory ## TYPE;                                           \
                                                                         \
 static inline BIG_TYPE                                                  \
-one_step_ ## TYPE (GstIirEqualizerBand *filter,                         \
+one_step_ ## TYPE (const gdouble *coeff,                                \
     SecondOrderHistory ## TYPE *history, BIG_TYPE input)                \
 {                                                                       \
   /* calculate output */                                                \
-  BIG_TYPE output = filter->a0 * input +                                \
-      filter->a1 * history->x1 + filter->a2 * history->x2 +             \
-      filter->b1 * history->y1 + filter->b2 * history->y2;              \
+  BIG_TYPE output = coeff[0] * input +                                  \
+      coeff[1] * history->x1 + coeff[2] * history->x2 +                 \
+      coeff[3] * history->y1 + coeff[4] * history->y2;                  \
   /* update history */                                                  \
   history->y2 = history->y1;                                            \
   history->y1 = output;                                                 \
@@ -750,14 +760,15 @@ guint size, guint channels)                                             \
   guint frames = size / channels / sizeof (TYPE);                       \
   guint i, c, f, nf = equ->freq_band_count;                             \
   BIG_TYPE cur;                                                         \
-  GstIirEqualizerBand **filters = equ->bands;                           \
                                                                         \
   for (i = 0; i < frames; i++) {                                        \
     SecondOrderHistory ## TYPE *history = equ->history;                 \
     for (c = 0; c < channels; c++) {                                    \
+      const gdouble *coeff = equ->coeff;                                \
       cur = *((TYPE *) data);                                           \
       for (f = 0; f < nf; f++) {                                        \
-        cur = one_step_ ## TYPE (filters[f], history, cur);             \
+        cur = one_step_ ## TYPE (coeff, history, cur);                  \
+        coeff += 5;                                                     \
         history++;                                                      \
       }                                                                 \
       cur = CLAMP (cur, MIN_VAL, MAX_VAL);                              \
@@ -774,13 +785,13 @@ typedef struct {                                                        \
 } SecondOrderHistory ## TYPE;                                           \
                                                                         \
 static inline TYPE                                                      \
-one_step_ ## TYPE (GstIirEqualizerBand *filter,                         \
+one_step_ ## TYPE (const gdouble *coeff,                                \
     SecondOrderHistory ## TYPE *history, TYPE input)                    \
 {                                                                       \
   /* calculate output */                                                \
-  TYPE output = filter->a0 * input + filter->a1 * history->x1 +         \
-      filter->a2 * history->x2 + filter->b1 * history->y1 +             \
-      filter->b2 * history->y2;                                         \
+  TYPE output = coeff[0] * input + coeff[1] * history->x1 +             \
+      coeff[2] * history->x2 + coeff[3] * history->y1 +                 \
+      coeff[4] * history->y2;                                           \
   /* update history */                                                  \
   history->y2 = history->y1;                                            \
   history->y1 = output;                                                 \
@@ -800,14 +811,15 @@ guint size, guint channels)                                             \
   guint frames = size / channels / sizeof (TYPE);                       \
   guint i, c, f, nf = equ->freq_band_count;                             \
   TYPE cur;                                                             \
-  GstIirEqualizerBand **filters = equ->bands;                           \
                                                                         \
   for (i = 0; i < frames; i++) {                                        \
     SecondOrderHistory ## TYPE *history = equ->history;                 \
     for (c = 0; c < channels; c++) {                                    \
+      const gdouble *coeff = equ->coeff;                                \
       cur = *((TYPE *) data);                                           \
       for (f = 0; f < nf; f++) {                                        \
-        cur = one_step_ ## TYPE (filters[f], history, cur);             \
+        cur = one_step_ ## TYPE (coeff, history, cur);                  \
+        coeff += 5;                                                     \
         history++;                                                      \
       }                                                                 \
       *((TYPE *) data) = (TYPE) cur;                                    \
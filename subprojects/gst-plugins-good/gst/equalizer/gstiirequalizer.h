@@ -67,6 +67,10 @@ struct _GstIirEqualizer
 
   gboolean need_new_coefficients;
 
+  /* flat copy of the band coefficients (5 per band) so the per-sample loop
+   * does not have to chase the band objects */
+  gdouble *coeff;
+
   ProcessFunc process;
 };
 
@@ -1212,10 +1212,9 @@ gst_flv_mux_buffer_to_tag_internal (GstFlvMux * mux, GstBuffer * buffer,
     GstFlvMuxPad * pad, gboolean is_codec_data)
 {
   GstBuffer *tag;
-  GstMapInfo map;
-  guint size;
+  guint size, hsize;
   guint64 pts, dts, cts;
-  guint8 *data, *bdata = NULL;
+  guint8 *data;
   gsize bsize = 0;
 
   if (GST_CLOCK_TIME_IS_VALID (pad->dts)) {
@@ -1276,11 +1275,8 @@ gst_flv_mux_buffer_to_tag_internal (GstFlvMux * mux, GstBuffer * buffer,
         G_GUINT64_FORMAT ", new:%u)", dts, (guint32) dts);
   }
 
-  if (buffer != NULL) {
-    gst_buffer_map (buffer, &map, GST_MAP_READ);
-    bdata = map.data;
-    bsize = map.size;
-  }
+  if (buffer != NULL)
+    bsize = gst_buffer_get_size (buffer);
 
   size = 11;
   if (mux->video_pad == pad) {
@@ -1298,8 +1294,14 @@ gst_flv_mux_buffer_to_tag_internal (GstFlvMux * mux, GstBuffer * buffer,
   }
   size += 4;
 
-  _gst_buffer_new_and_alloc (size, &tag, &data);
-  memset (data, 0, size);
+  /* The tag header is assembled in a small buffer of its own and the
+   * payload is chained behind it by sharing the input buffer's memory,
+   * so the media data is never copied. The 4 byte PreviousTagSize
+   * footer is part of the header allocation when there is no payload,
+   * and a separate small buffer otherwise. */
+  hsize = size - (guint) bsize - 4;
+  _gst_buffer_new_and_alloc (bsize > 0 ? hsize : size, &tag, &data);
+  memset (data, 0, bsize > 0 ? hsize : size);
 
   data[0] = (mux->video_pad == pad) ? 9 : 8;
 
@@ -1333,9 +1335,6 @@ gst_flv_mux_buffer_to_tag_internal (GstFlvMux * mux, GstBuffer * buffer,
         data[12] = 1;
         GST_WRITE_UINT24_BE (data + 13, cts);
       }
-      memcpy (data + 11 + 1 + 4, bdata, bsize);
-    } else {
-      memcpy (data + 11 + 1, bdata, bsize);
     }
   } else {
     data[11] |= (pad->codec << 4) & 0xf0;
@@ -1347,19 +1346,22 @@ gst_flv_mux_buffer_to_tag_internal (GstFlvMux * mux, GstBuffer * buffer,
         "codec:%d, rate:%d, width:%d, channels:%d",
         data[11], pad->codec, pad->rate, pad->width, pad->channels);
 
-    if (pad->codec == 10) {
+    if (pad->codec == 10)
       data[12] = is_codec_data ? 0 : 1;
-
-      memcpy (data + 11 + 1 + 1, bdata, bsize);
-    } else {
-      memcpy (data + 11 + 1, bdata, bsize);
-    }
   }
 
-  if (buffer)
-    gst_buffer_unmap (buffer, &map);
+  if (bsize > 0) {
+    GstBuffer *footer;
+
+    tag = gst_buffer_append (tag,
+        gst_buffer_copy_region (buffer, GST_BUFFER_COPY_MEMORY, 0, bsize));
 
-  GST_WRITE_UINT32_BE (data + size - 4, size - 4);
+    _gst_buffer_new_and_alloc (4, &footer, &data);
+    GST_WRITE_UINT32_BE (data, size - 4);
+    tag = gst_buffer_append (tag, footer);
+  } else {
+    GST_WRITE_UINT32_BE (data + size - 4, size - 4);
+  }
 
   GST_BUFFER_PTS (tag) = GST_CLOCK_TIME_NONE;
   GST_BUFFER_DTS (tag) = GST_CLOCK_TIME_NONE;
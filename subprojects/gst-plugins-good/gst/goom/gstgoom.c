@@ -52,6 +52,12 @@ GST_DEBUG_CATEGORY (goom_debug);
 
 #define DEFAULT_WIDTH  320
 #define DEFAULT_HEIGHT 240
+#define DEFAULT_RENDER_WIDTH 0
+#define DEFAULT_RENDER_HEIGHT 0
+
+/* goom gets visibly blocky below this, and some of its effects divide
+ * the dimensions down further */
+#define MIN_RENDER_SIZE 16
 
 /* signals and args */
 enum
@@ -62,8 +68,9 @@ enum
 
 enum
 {
-  ARG_0
-      /* FILL ME */
+  PROP_0,
+  PROP_RENDER_WIDTH,
+  PROP_RENDER_HEIGHT
 };
 
 #if G_BYTE_ORDER == G_BIG_ENDIAN
@@ -95,6 +102,10 @@ static GstStaticPadTemplate sink_template = GST_STATIC_PAD_TEMPLATE ("sink",
 
 
 static void gst_goom_finalize (GObject * object);
+static void gst_goom_set_property (GObject * object, guint prop_id,
+    const GValue * value, GParamSpec * pspec);
+static void gst_goom_get_property (GObject * object, guint prop_id,
+    GValue * value, GParamSpec * pspec);
 
 static gboolean gst_goom_setup (GstAudioVisualizer * base);
 static gboolean gst_goom_render (GstAudioVisualizer * base, GstBuffer * audio,
@@ -116,6 +127,38 @@ gst_goom_class_init (GstGoomClass * klass)
   visualizer_class = (GstAudioVisualizerClass *) klass;
 
   gobject_class->finalize = gst_goom_finalize;
+  gobject_class->set_property = gst_goom_set_property;
+  gobject_class->get_property = gst_goom_get_property;
+
+  /**
+   * GstGoom:render-width:
+   *
+   * Width at which goom renders internally. When smaller than the
+   * negotiated output width, the rendered image is upscaled to the
+   * output size, which is much cheaper than rendering at full
+   * resolution. 0 renders at the output width. Changes take effect on
+   * the next renegotiation.
+   *
+   * Since: 1.22
+   */
+  g_object_class_install_property (gobject_class, PROP_RENDER_WIDTH,
+      g_param_spec_uint ("render-width", "Render width",
+          "Internal rendering width (0 = output width)",
+          0, G_MAXINT, DEFAULT_RENDER_WIDTH,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
+  /**
+   * GstGoom:render-height:
+   *
+   * Height at which goom renders internally, see #GstGoom:render-width.
+   *
+   * Since: 1.22
+   */
+  g_object_class_install_property (gobject_class, PROP_RENDER_HEIGHT,
+      g_param_spec_uint ("render-height", "Render height",
+          "Internal rendering height (0 = output height)",
+          0, G_MAXINT, DEFAULT_RENDER_HEIGHT,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
   gst_element_class_set_static_metadata (gstelement_class, "GOOM: what a GOOM!",
       "Visualization",
@@ -135,9 +178,60 @@ gst_goom_init (GstGoom * goom)
   goom->height = DEFAULT_HEIGHT;
   goom->channels = 0;
 
+  goom->render_width = DEFAULT_RENDER_WIDTH;
+  goom->render_height = DEFAULT_RENDER_HEIGHT;
+  goom->rwidth = goom->width;
+  goom->rheight = goom->height;
+
   goom->plugin = goom_init (goom->width, goom->height);
 }
 
+static void
+gst_goom_set_property (GObject * object, guint prop_id, const GValue * value,
+    GParamSpec * pspec)
+{
+  GstGoom *goom = GST_GOOM (object);
+
+  switch (prop_id) {
+    case PROP_RENDER_WIDTH:
+      GST_OBJECT_LOCK (goom);
+      goom->render_width = g_value_get_uint (value);
+      GST_OBJECT_UNLOCK (goom);
+      break;
+    case PROP_RENDER_HEIGHT:
+      GST_OBJECT_LOCK (goom);
+      goom->render_height = g_value_get_uint (value);
+      GST_OBJECT_UNLOCK (goom);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  }
+}
+
+static void
+gst_goom_get_property (GObject * object, guint prop_id, GValue * value,
+    GParamSpec * pspec)
+{
+  GstGoom *goom = GST_GOOM (object);
+
+  switch (prop_id) {
+    case PROP_RENDER_WIDTH:
+      GST_OBJECT_LOCK (goom);
+      g_value_set_uint (value, goom->render_width);
+      GST_OBJECT_UNLOCK (goom);
+      break;
+    case PROP_RENDER_HEIGHT:
+      GST_OBJECT_LOCK (goom);
+      g_value_set_uint (value, goom->render_height);
+      GST_OBJECT_UNLOCK (goom);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  }
+}
+
 static void
 gst_goom_finalize (GObject * object)
 {
@@ -146,6 +240,11 @@ gst_goom_finalize (GObject * object)
   goom_close (goom->plugin);
   goom->plugin = NULL;
 
+  if (goom->hscale)
+    gst_video_scaler_free (goom->hscale);
+  if (goom->vscale)
+    gst_video_scaler_free (goom->vscale);
+
   G_OBJECT_CLASS (gst_goom_parent_class)->finalize (object);
 }
 
@@ -153,10 +252,47 @@ static gboolean
 gst_goom_setup (GstAudioVisualizer * base)
 {
   GstGoom *goom = GST_GOOM (base);
+  gint rwidth, rheight;
 
   goom->width = GST_VIDEO_INFO_WIDTH (&base->vinfo);
   goom->height = GST_VIDEO_INFO_HEIGHT (&base->vinfo);
-  goom_set_resolution (goom->plugin, goom->width, goom->height);
+
+  GST_OBJECT_LOCK (goom);
+  rwidth = goom->render_width;
+  rheight = goom->render_height;
+  GST_OBJECT_UNLOCK (goom);
+
+  /* render at the requested size, but never upscale the render size
+   * beyond the output size and keep it large enough for goom's effects */
+  if (rwidth == 0 || rwidth > goom->width)
+    rwidth = goom->width;
+  if (rheight == 0 || rheight > goom->height)
+    rheight = goom->height;
+  rwidth = MAX (rwidth, MIN (MIN_RENDER_SIZE, goom->width));
+  rheight = MAX (rheight, MIN (MIN_RENDER_SIZE, goom->height));
+
+  goom->rwidth = rwidth;
+  goom->rheight = rheight;
+  goom_set_resolution (goom->plugin, rwidth, rheight);
+
+  if (goom->hscale) {
+    gst_video_scaler_free (goom->hscale);
+    goom->hscale = NULL;
+  }
+  if (goom->vscale) {
+    gst_video_scaler_free (goom->vscale);
+    goom->vscale = NULL;
+  }
+
+  if (rwidth != goom->width)
+    goom->hscale = gst_video_scaler_new (GST_VIDEO_RESAMPLER_METHOD_CUBIC,
+        GST_VIDEO_SCALER_FLAG_NONE, 0, rwidth, goom->width, NULL);
+  if (rheight != goom->height)
+    goom->vscale = gst_video_scaler_new (GST_VIDEO_RESAMPLER_METHOD_CUBIC,
+        GST_VIDEO_SCALER_FLAG_NONE, 0, rheight, goom->height, NULL);
+
+  GST_DEBUG_OBJECT (goom, "rendering at %dx%d for %dx%d output",
+      rwidth, rheight, goom->width, goom->height);
 
   return TRUE;
 }
@@ -187,7 +323,19 @@ gst_goom_render (GstAudioVisualizer * base, GstBuffer * audio,
     }
   }
 
-  video->data[0] = goom_update (goom->plugin, datain, 0, 0);
+  if (goom->hscale || goom->vscale) {
+    guint32 *render = goom_update (goom->plugin, datain, 0, 0);
+
+    /* upscale the low-resolution render into the output frame; the
+     * scaler does the resampling with Orc and a slice thread pool */
+    gst_video_scaler_2d (goom->hscale, goom->vscale,
+        GST_VIDEO_FRAME_FORMAT (video), render,
+        goom->rwidth * sizeof (guint32), video->data[0],
+        GST_VIDEO_FRAME_PLANE_STRIDE (video, 0), 0, 0,
+        goom->width, goom->height);
+  } else {
+    video->data[0] = goom_update (goom->plugin, datain, 0, 0);
+  }
   gst_buffer_unmap (audio, &amap);
 
   return TRUE;
@@ -22,6 +22,7 @@
 #define __GST_GOOM_H__
 
 #include <gst/pbutils/gstaudiovisualizer.h>
+#include <gst/video/video.h>
 
 #include "goom.h"
 
@@ -49,6 +50,17 @@ struct _GstGoom
   gint width;
   gint height;
 
+  /* properties */
+  guint render_width;
+  guint render_height;
+
+  /* internal rendering size and upscalers, only used when the render
+   * size differs from the output size */
+  gint rwidth;
+  gint rheight;
+  GstVideoScaler *hscale;
+  GstVideoScaler *vscale;
+
   /* goom stuff */
   PluginInfo *plugin;
 };
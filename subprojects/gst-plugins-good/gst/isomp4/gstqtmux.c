@@ -1955,11 +1955,12 @@ gst_qt_mux_send_buffered_data (GstQTMux * qtmux, guint64 * offset)
     goto seek_failed;
 
   /* hm, this could all take a really really long time,
-   * but there may not be another way to get moov atom first
-   * (somehow optimize copy?) */
+   * but there may not be another way to get moov atom first */
   GST_DEBUG_OBJECT (qtmux, "Sending buffered data");
   while (ret == GST_FLOW_OK) {
-    const int bufsize = 4096;
+    /* copy in large chunks, pushing the buffered mdat of a long recording
+     * downstream in page-sized buffers takes minutes at EOS */
+    const int bufsize = 4 * 1024 * 1024;
     GstMapInfo map;
     gsize size;
 
@@ -88,6 +88,11 @@
 /* if the sample index is larger than this, something is likely wrong */
 #define QTDEMUX_MAX_SAMPLE_INDEX_SIZE (200*1024*1024)
 
+/* when linearly extending the sample table, e.g. for a seek beyond the
+ * already-parsed area, parse this many samples at a time so we don't take
+ * the object lock once per sample */
+#define QTDEMUX_SAMPLE_PARSE_BATCH (8192)
+
 /* For converting qt creation times to unix epoch times */
 #define QTDEMUX_SECONDS_PER_DAY (60 * 60 * 24)
 #define QTDEMUX_LEAP_YEARS_FROM_1904_TO_1970 17
@@ -907,8 +912,13 @@ gst_qtdemux_find_index_for_given_media_offset_linear (GstQTDemux * qtdemux,
 
   result++;
   while (index < str->n_samples - 1) {
-    if (!qtdemux_parse_samples (qtdemux, str, index + 1))
-      goto parse_failed;
+    if ((gint32) (index + 1) > str->stbl_index) {
+      guint32 parse_to = MIN (index + QTDEMUX_SAMPLE_PARSE_BATCH,
+          str->n_samples - 1);
+
+      if (!qtdemux_parse_samples (qtdemux, str, parse_to))
+        goto parse_failed;
+    }
 
     if (media_offset < result->offset)
       break;
@@ -954,18 +964,39 @@ gst_qtdemux_find_index_linear (GstQTDemux * qtdemux, QtDemuxStream * str,
     index = gst_qtdemux_find_index (qtdemux, str, media_time);
     sample = str->samples + index;
   } else {
-    while (index < str->n_samples - 1) {
-      if (!qtdemux_parse_samples (qtdemux, str, index + 1))
+    /* extend the parsed range in batches until it covers the requested
+     * time, then binary search in it, rather than parsing and inspecting
+     * one sample at a time */
+    while (str->stbl_index < (gint32) (str->n_samples - 1)) {
+      gint32 prev = str->stbl_index;
+      guint32 start = (prev < 0) ? 0 : (guint32) prev;
+      guint32 parse_to = MIN (start + QTDEMUX_SAMPLE_PARSE_BATCH,
+          str->n_samples - 1);
+
+      if (!qtdemux_parse_samples (qtdemux, str, parse_to))
         goto parse_failed;
 
-      sample = str->samples + index + 1;
-      if (mov_time < sample->timestamp) {
-        sample = str->samples + index;
+      /* no progress means the remaining samples come from movie fragments
+       * and were filled in during moof parsing; scan those linearly below */
+      if (str->stbl_index == prev)
         break;
-      }
 
-      index++;
+      if (mov_time <= str->samples[str->stbl_index].timestamp)
+        break;
     }
+
+    if (str->stbl_index >= 0 &&
+        mov_time <= str->samples[str->stbl_index].timestamp) {
+      index = gst_qtdemux_find_index (qtdemux, str, media_time);
+    } else {
+      index = (str->stbl_index > 0) ? (guint32) str->stbl_index : 0;
+      while (index < str->n_samples - 1) {
+        if (mov_time < str->samples[index + 1].timestamp)
+          break;
+        index++;
+      }
+    }
+    sample = str->samples + index;
   }
 
   /* sample->timestamp is now <= media_time, need to find the corresponding
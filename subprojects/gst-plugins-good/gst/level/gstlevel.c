@@ -100,6 +100,7 @@ enum
   PROP_PEAK_TTL,
   PROP_PEAK_FALLOFF,
   PROP_AUDIO_LEVEL_META,
+  PROP_DECIMATION,
 };
 
 #define gst_level_parent_class parent_class
@@ -184,6 +185,20 @@ gst_level_class_init (GstLevelClass * klass)
       g_param_spec_boolean ("audio-level-meta", "Audio Level Meta",
           "Set GstAudioLevelMeta on buffers", FALSE,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  /**
+   * GstLevel:decimation:
+   *
+   * Measure only every Nth sample frame per channel. The measured power
+   * is scaled to compensate, so RMS values stay comparable, but peaks
+   * falling between measured frames go unnoticed. Useful to cut the
+   * analysis cost when running many streams for e.g. silence detection.
+   *
+   * Since: 1.22
+   */
+  g_object_class_install_property (gobject_class, PROP_DECIMATION,
+      g_param_spec_uint ("decimation", "Decimation",
+          "Measure only every Nth sample frame (1 = all frames)",
+          1, G_MAXUINT, 1, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
   GST_DEBUG_CATEGORY_INIT (level_debug, "level", 0, "Level calculation");
 
@@ -229,6 +244,7 @@ gst_level_init (GstLevel * filter)
   filter->decay_peak_falloff = 10.0;    /* dB falloff (/sec) */
 
   filter->post_messages = TRUE;
+  filter->decimation = 1;
 
   filter->process = NULL;
 
@@ -291,6 +307,9 @@ gst_level_set_property (GObject * object, guint prop_id,
       configure_passthrough (filter, g_value_get_boolean (value));
       GST_OBJECT_LOCK (filter);
       break;
+    case PROP_DECIMATION:
+      filter->decimation = g_value_get_uint (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -325,6 +344,9 @@ gst_level_get_property (GObject * object, guint prop_id,
     case PROP_AUDIO_LEVEL_META:
       g_value_set_boolean (value, filter->audio_level_meta);
       break;
+    case PROP_DECIMATION:
+      g_value_set_uint (value, filter->decimation);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -341,22 +363,28 @@ gst_level_get_property (GObject * object, guint prop_id,
  * to return the average power as a double between 0 and 1
  * also returns the normalized peak power (square of the highest amplitude)
  *
- * caller must assure num is a multiple of channels
- * samples for multiple channels are interleaved
+ * caller must assure num is a multiple of the stride
+ * samples for multiple channels are interleaved; the stride is the
+ * channel count, multiplied by the decimation factor when only every
+ * Nth frame is measured
  * input sample data enters in *in_data and is not modified
  * this filter only accepts signed audio data, so mid level is always 0
  *
+ * the contiguous (stride == 1) case uses two independent accumulators
+ * and branch-free peak tracking, so the loop carries no single serial
+ * dependency and the compiler can vectorize it
+ *
  * for integers, this code considers the non-existent positive max value to be
  * full-scale; so max-1 will not map to 1.0
  */
 
 #define DEFINE_INT_LEVEL_CALCULATOR(TYPE, RESOLUTION)                         \
 static void inline                                                            \
-gst_level_calculate_##TYPE (gpointer data, guint num, guint channels,         \
+gst_level_calculate_##TYPE (gpointer data, guint num, guint stride,           \
                             gdouble *NCS, gdouble *NPS)                       \
 {                                                                             \
   TYPE * in = (TYPE *)data;                                                   \
-  register guint j;                                                           \
+  register guint j = 0;                                                       \
   gdouble squaresum = 0.0;           /* square sum of the input samples */    \
   register gdouble square = 0.0;     /* Square */                             \
   register gdouble peaksquare = 0.0; /* Peak Square Sample */                 \
@@ -365,7 +393,22 @@ gst_level_calculate_##TYPE (gpointer data, guint num, guint channels,         \
   /* *NCS = 0.0; Normalized Cumulative Square */                              \
   /* *NPS = 0.0; Normalized Peak Square */                                    \
                                                                               \
-  for (j = 0; j < num; j += channels) {                                       \
+  if (stride == 1) {                                                          \
+    gdouble squaresum2 = 0.0, peaksquare2 = 0.0;                              \
+                                                                              \
+    for (j = 0; j + 1 < num; j += 2) {                                        \
+      gdouble square1 = ((gdouble) in[j]) * in[j];                            \
+      gdouble square2 = ((gdouble) in[j + 1]) * in[j + 1];                    \
+      peaksquare = MAX (peaksquare, square1);                                 \
+      peaksquare2 = MAX (peaksquare2, square2);                               \
+      squaresum += square1;                                                   \
+      squaresum2 += square2;                                                  \
+    }                                                                         \
+    squaresum += squaresum2;                                                  \
+    peaksquare = MAX (peaksquare, peaksquare2);                               \
+  }                                                                           \
+                                                                              \
+  for (; j < num; j += stride) {                                              \
     square = ((gdouble) in[j]) * in[j];                                       \
     if (square > peaksquare) peaksquare = square;                             \
     squaresum += square;                                                      \
@@ -383,11 +426,11 @@ DEFINE_INT_LEVEL_CALCULATOR (gint8, 7);
 /* FIXME: use orc to calculate squaresums? */
 #define DEFINE_FLOAT_LEVEL_CALCULATOR(TYPE)                                   \
 static void inline                                                            \
-gst_level_calculate_##TYPE (gpointer data, guint num, guint channels,         \
+gst_level_calculate_##TYPE (gpointer data, guint num, guint stride,           \
                             gdouble *NCS, gdouble *NPS)                       \
 {                                                                             \
   TYPE * in = (TYPE *)data;                                                   \
-  register guint j;                                                           \
+  register guint j = 0;                                                       \
   gdouble squaresum = 0.0;           /* square sum of the input samples */    \
   register gdouble square = 0.0;     /* Square */                             \
   register gdouble peaksquare = 0.0; /* Peak Square Sample */                 \
@@ -395,8 +438,22 @@ gst_level_calculate_##TYPE (gpointer data, guint num, guint channels,         \
   /* *NCS = 0.0; Normalized Cumulative Square */                              \
   /* *NPS = 0.0; Normalized Peak Square */                                    \
                                                                               \
-  /* orc_level_squaresum_f64(&squaresum,in,num); */                           \
-  for (j = 0; j < num; j += channels) {                                       \
+  if (stride == 1) {                                                          \
+    gdouble squaresum2 = 0.0, peaksquare2 = 0.0;                              \
+                                                                              \
+    for (j = 0; j + 1 < num; j += 2) {                                        \
+      gdouble square1 = ((gdouble) in[j]) * in[j];                            \
+      gdouble square2 = ((gdouble) in[j + 1]) * in[j + 1];                    \
+      peaksquare = MAX (peaksquare, square1);                                 \
+      peaksquare2 = MAX (peaksquare2, square2);                               \
+      squaresum += square1;                                                   \
+      squaresum2 += square2;                                                  \
+    }                                                                         \
+    squaresum += squaresum2;                                                  \
+    peaksquare = MAX (peaksquare, peaksquare2);                               \
+  }                                                                           \
+                                                                              \
+  for (; j < num; j += stride) {                                              \
     square = ((gdouble) in[j]) * in[j];                                       \
     if (square > peaksquare) peaksquare = square;                             \
     squaresum += square;                                                      \
@@ -659,8 +716,11 @@ gst_level_transform_ip (GstBaseTransform * trans, GstBuffer * in)
 
     for (i = 0; i < channels; ++i) {
       if (!GST_BUFFER_FLAG_IS_SET (in, GST_BUFFER_FLAG_GAP)) {
-        filter->process (in_data + (bps * i), block_int_size, channels, &CS,
-            &filter->peak[i]);
+        filter->process (in_data + (bps * i), block_int_size,
+            channels * filter->decimation, &CS, &filter->peak[i]);
+        /* the skipped frames are assumed to carry the average power of
+         * the measured ones */
+        CS *= filter->decimation;
         CS_tot += CS;
         GST_LOG_OBJECT (filter,
             "[%d]: cumulative squares %lf, over %d samples/%d channels",
@@ -62,6 +62,7 @@ struct _GstLevel {
   gdouble decay_peak_ttl;       /* time to live for peak in nanoseconds */
   gdouble decay_peak_falloff;   /* falloff in dB/sec */
   gboolean audio_level_meta; /* whether or not generate GstAudioLevelMeta */
+  guint decimation;             /* measure only every Nth sample frame */
 
   GstAudioInfo info;
   gint num_frames;              /* frame count (1 sample per channel)
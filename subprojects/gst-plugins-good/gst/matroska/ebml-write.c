@@ -57,6 +57,7 @@ gst_ebml_write_init (GstEbmlWrite * ebml)
   ebml->last_pos = G_MAXUINT64; /* force segment event */
 
   ebml->cache = NULL;
+  ebml->buffer_list = NULL;
   ebml->streamheader = NULL;
   ebml->streamheader_pos = 0;
   ebml->writing_streamheader = FALSE;
@@ -75,6 +76,11 @@ gst_ebml_write_finalize (GObject * object)
     ebml->cache = NULL;
   }
 
+  if (ebml->buffer_list) {
+    gst_buffer_list_unref (ebml->buffer_list);
+    ebml->buffer_list = NULL;
+  }
+
   if (ebml->streamheader) {
     gst_byte_writer_free (ebml->streamheader);
     ebml->streamheader = NULL;
@@ -129,6 +135,11 @@ gst_ebml_write_reset (GstEbmlWrite * ebml)
     ebml->cache = NULL;
   }
 
+  if (ebml->buffer_list) {
+    gst_buffer_list_unref (ebml->buffer_list);
+    ebml->buffer_list = NULL;
+  }
+
   if (ebml->caps) {
     gst_caps_unref (ebml->caps);
     ebml->caps = NULL;
@@ -207,6 +218,112 @@ gst_ebml_write_set_cache (GstEbmlWrite * ebml, guint size)
   ebml->cache_pos = ebml->pos;
 }
 
+/**
+ * gst_ebml_write_start_buffer_list:
+ * @ebml: a #GstEbmlWrite.
+ *
+ * Start aggregating all pushed buffers into one buffer list.
+ *
+ * Unlike the byte-writer cache this does not copy data: media buffers
+ * are appended as-is and everything goes downstream in a single push
+ * on gst_ebml_write_flush_buffer_list(). Writes that seek back into
+ * the aggregated range (e.g. filling in a master element size) are
+ * patched in place instead of causing an extra push.
+ */
+void
+gst_ebml_write_start_buffer_list (GstEbmlWrite * ebml)
+{
+  if (ebml->buffer_list)
+    gst_ebml_write_flush_buffer_list (ebml);
+
+  GST_DEBUG ("Starting buffer list at %" G_GUINT64_FORMAT, ebml->pos);
+  ebml->buffer_list = gst_buffer_list_new ();
+  ebml->buffer_list_pos = ebml->pos;
+  ebml->buffer_list_size = 0;
+}
+
+/**
+ * gst_ebml_write_flush_buffer_list:
+ * @ebml: a #GstEbmlWrite.
+ *
+ * Push all aggregated buffers downstream as a single buffer list.
+ */
+void
+gst_ebml_write_flush_buffer_list (GstEbmlWrite * ebml)
+{
+  GstBufferList *buffer_list;
+
+  if (!ebml->buffer_list)
+    return;
+
+  buffer_list = ebml->buffer_list;
+  ebml->buffer_list = NULL;
+
+  GST_DEBUG ("Flushing buffer list of %u buffers, size %" G_GUINT64_FORMAT,
+      gst_buffer_list_length (buffer_list), ebml->buffer_list_size);
+
+  if (gst_buffer_list_length (buffer_list) == 0) {
+    gst_buffer_list_unref (buffer_list);
+    return;
+  }
+
+  if (ebml->last_write_result == GST_FLOW_OK)
+    ebml->last_write_result = gst_pad_push_list (ebml->srcpad, buffer_list);
+  else
+    gst_buffer_list_unref (buffer_list);
+}
+
+/* Push a fully prepared buffer downstream, or append it to the pending
+ * buffer list when aggregation is active. Takes ownership of @buf. */
+static void
+gst_ebml_write_push (GstEbmlWrite * ebml, GstBuffer * buf)
+{
+  if (ebml->buffer_list) {
+    ebml->buffer_list_size += gst_buffer_get_size (buf);
+    gst_buffer_list_add (ebml->buffer_list, buf);
+    return;
+  }
+
+  ebml->last_write_result = gst_pad_push (ebml->srcpad, buf);
+}
+
+/* Overwrite bytes that are still queued in the pending buffer list,
+ * used when a master element size is filled in after the fact. The
+ * written range must be fully contained in the list. */
+static void
+gst_ebml_write_buffer_list_patch (GstEbmlWrite * ebml, guint64 offset,
+    GstBuffer * buf)
+{
+  GstMapInfo map;
+  guint64 rel = offset - ebml->buffer_list_pos;
+  gsize done = 0;
+  guint i, len;
+
+  GST_DEBUG ("Patching buffer list at %" G_GUINT64_FORMAT, offset);
+
+  gst_buffer_map (buf, &map, GST_MAP_READ);
+  len = gst_buffer_list_length (ebml->buffer_list);
+  for (i = 0; i < len && done < map.size; i++) {
+    GstBuffer *entry = gst_buffer_list_get (ebml->buffer_list, i);
+    gsize entry_size = gst_buffer_get_size (entry);
+
+    if (rel >= entry_size) {
+      rel -= entry_size;
+      continue;
+    }
+
+    entry = gst_buffer_list_get_writable (ebml->buffer_list, i);
+    done += gst_buffer_fill (entry, rel, map.data + done,
+        MIN (map.size - done, entry_size - rel));
+    rel = 0;
+  }
+  gst_buffer_unmap (buf, &map);
+
+  if (done < map.size)
+    GST_WARNING ("Only patched %" G_GSIZE_FORMAT " of %" G_GSIZE_FORMAT
+        " bytes in buffer list", done, map.size);
+}
+
 static gboolean
 gst_ebml_writer_send_segment_event (GstEbmlWrite * ebml, guint64 new_pos)
 {
@@ -254,6 +371,9 @@ gst_ebml_write_flush_cache (GstEbmlWrite * ebml, gboolean is_keyframe,
   GST_BUFFER_OFFSET_END (buffer) = ebml->pos;
   if (ebml->last_write_result == GST_FLOW_OK) {
     if (GST_BUFFER_OFFSET (buffer) != ebml->last_pos) {
+      /* the segment event must not overtake buffers that are still
+       * queued in the pending buffer list */
+      gst_ebml_write_flush_buffer_list (ebml);
       gst_ebml_writer_send_segment_event (ebml, GST_BUFFER_OFFSET (buffer));
       GST_BUFFER_FLAG_SET (buffer, GST_BUFFER_FLAG_DISCONT);
     } else {
@@ -268,7 +388,7 @@ gst_ebml_write_flush_cache (GstEbmlWrite * ebml, gboolean is_keyframe,
       GST_BUFFER_FLAG_SET (buffer, GST_BUFFER_FLAG_DELTA_UNIT);
     }
     ebml->last_pos = ebml->pos;
-    ebml->last_write_result = gst_pad_push (ebml->srcpad, buffer);
+    gst_ebml_write_push (ebml, buffer);
   } else {
     gst_buffer_unref (buffer);
   }
@@ -456,6 +576,23 @@ gst_ebml_write_element_push (GstEbmlWrite * ebml, GstBuffer * buf,
   if (buf_data && map.data)
     gst_buffer_unmap (buf, &map);
 
+  if (ebml->buffer_list) {
+    guint64 offset = ebml->pos - data_size;
+    guint64 list_end = ebml->buffer_list_pos + ebml->buffer_list_size;
+
+    if (offset >= ebml->buffer_list_pos && offset < list_end &&
+        offset + data_size <= list_end) {
+      /* overwrites data that is still queued in the buffer list, e.g.
+       * a master element size being filled in; patch it in place */
+      gst_ebml_write_buffer_list_patch (ebml, offset, buf);
+      gst_buffer_unref (buf);
+      return;
+    } else if (offset < list_end) {
+      /* straddles the end of the queued data; get it out first */
+      gst_ebml_write_flush_buffer_list (ebml);
+    }
+  }
+
   if (ebml->last_write_result == GST_FLOW_OK) {
     buf = gst_buffer_make_writable (buf);
     GST_BUFFER_OFFSET (buf) = ebml->pos - data_size;
@@ -468,13 +605,16 @@ gst_ebml_write_element_push (GstEbmlWrite * ebml, GstBuffer * buf,
     GST_BUFFER_FLAG_SET (buf, GST_BUFFER_FLAG_DELTA_UNIT);
 
     if (GST_BUFFER_OFFSET (buf) != ebml->last_pos) {
+      /* the segment event must not overtake buffers that are still
+       * queued in the pending buffer list */
+      gst_ebml_write_flush_buffer_list (ebml);
       gst_ebml_writer_send_segment_event (ebml, GST_BUFFER_OFFSET (buf));
       GST_BUFFER_FLAG_SET (buf, GST_BUFFER_FLAG_DISCONT);
     } else {
       GST_BUFFER_FLAG_UNSET (buf, GST_BUFFER_FLAG_DISCONT);
     }
     ebml->last_pos = ebml->pos;
-    ebml->last_write_result = gst_pad_push (ebml->srcpad, buf);
+    gst_ebml_write_push (ebml, buf);
   } else {
     gst_buffer_unref (buf);
   }
@@ -520,6 +660,19 @@ gst_ebml_write_seek (GstEbmlWrite * ebml, guint64 pos)
     }
   }
 
+  /* positions inside the pending buffer list are patched in place when
+   * the write comes, so no downstream seek is needed for those */
+  if (ebml->buffer_list) {
+    if (pos >= ebml->buffer_list_pos &&
+        pos <= ebml->buffer_list_pos + ebml->buffer_list_size) {
+      GST_DEBUG ("seeking in buffer list to %" G_GUINT64_FORMAT, pos);
+      ebml->pos = pos;
+      return;
+    }
+    GST_LOG ("Seek outside buffer list range. Flushing...");
+    gst_ebml_write_flush_buffer_list (ebml);
+  }
+
   GST_INFO ("scheduling seek to %" G_GUINT64_FORMAT, pos);
   ebml->pos = pos;
 }
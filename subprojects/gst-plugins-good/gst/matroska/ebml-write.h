@@ -53,6 +53,10 @@ typedef struct _GstEbmlWrite {
   GstByteWriter *cache;
   guint64 cache_pos;
 
+  GstBufferList *buffer_list;
+  guint64 buffer_list_pos;
+  guint64 buffer_list_size;
+
   GstFlowReturn last_write_result;
 
   gboolean writing_streamheader;
@@ -89,6 +93,14 @@ void    gst_ebml_write_flush_cache   (GstEbmlWrite *ebml,
                                       gboolean is_keyframe,
                                       GstClockTime timestamp);
 
+/*
+ * Buffer list aggregation collects all pushed buffers (including large
+ * media buffers that bypass the byte-writer cache) and sends them
+ * downstream in a single buffer list on flush.
+ */
+void    gst_ebml_write_start_buffer_list (GstEbmlWrite *ebml);
+void    gst_ebml_write_flush_buffer_list (GstEbmlWrite *ebml);
+
 /*
  * Seeking.
  */
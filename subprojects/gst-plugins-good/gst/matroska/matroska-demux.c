@@ -332,6 +332,11 @@ gst_matroska_demux_reset (GstElement * element)
     demux->clusters = NULL;
   }
 
+  if (demux->cluster_index) {
+    g_array_unref (demux->cluster_index);
+    demux->cluster_index = NULL;
+  }
+
   g_list_foreach (demux->seek_parsed,
       (GFunc) gst_matroska_read_common_free_parsed_el, NULL);
   g_list_free (demux->seek_parsed);
@@ -2090,6 +2095,69 @@ gst_matroska_cluster_compare (gint64 * i1, gint64 * i2)
     return 0;
 }
 
+typedef struct
+{
+  guint64 offset;
+  GstClockTime time;
+} GstMatroskaClusterIndexEntry;
+
+/* Remember the position of a cluster whose timecode we have seen, so that
+ * later seeks can binary-search known clusters instead of rescanning the
+ * file. The index is kept strictly increasing in both offset and time. */
+static void
+gst_matroska_demux_remember_cluster (GstMatroskaDemux * demux,
+    guint64 offset, GstClockTime time)
+{
+  GstMatroskaClusterIndexEntry entry;
+  guint lo, hi;
+
+  if (!GST_CLOCK_TIME_IS_VALID (time))
+    return;
+
+  if (G_UNLIKELY (!demux->cluster_index)) {
+    demux->cluster_index = g_array_sized_new (FALSE, FALSE,
+        sizeof (GstMatroskaClusterIndexEntry), 128);
+  }
+
+  /* find the first entry with a time not less than @time */
+  lo = 0;
+  hi = demux->cluster_index->len;
+  while (lo < hi) {
+    guint mid = lo + (hi - lo) / 2;
+    GstMatroskaClusterIndexEntry *e = &g_array_index (demux->cluster_index,
+        GstMatroskaClusterIndexEntry, mid);
+
+    if (e->time < time)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+
+  /* skip entries we already know, and anything that would make the index
+   * inconsistent (timecodes not monotonic in file order) */
+  if (lo > 0) {
+    GstMatroskaClusterIndexEntry *prev = &g_array_index (demux->cluster_index,
+        GstMatroskaClusterIndexEntry, lo - 1);
+
+    if (prev->offset >= offset)
+      return;
+  }
+  if (lo < demux->cluster_index->len) {
+    GstMatroskaClusterIndexEntry *next = &g_array_index (demux->cluster_index,
+        GstMatroskaClusterIndexEntry, lo);
+
+    if (next->offset <= offset)
+      return;
+  }
+
+  GST_LOG_OBJECT (demux, "remembering cluster @ %" G_GUINT64_FORMAT
+      " with time %" GST_TIME_FORMAT, offset, GST_TIME_ARGS (time));
+
+  entry.offset = offset;
+  entry.time = time;
+  g_array_insert_val (demux->cluster_index, lo, entry);
+}
+
 /* searches for a cluster start from @pos,
  * return GST_FLOW_OK and cluster position in @pos if found */
 static GstFlowReturn
@@ -2135,6 +2203,53 @@ gst_matroska_demux_search_cluster (GstMatroskaDemux * demux, gint64 * pos,
     }
   }
 
+  /* also try clusters remembered during playback and earlier scans */
+  if (demux->cluster_index && demux->cluster_index->len > 0) {
+    GstMatroskaClusterIndexEntry *e = NULL;
+    guint lo = 0, hi = demux->cluster_index->len;
+
+    /* first known cluster at or after *pos */
+    while (lo < hi) {
+      guint mid = lo + (hi - lo) / 2;
+      GstMatroskaClusterIndexEntry *mid_e =
+          &g_array_index (demux->cluster_index, GstMatroskaClusterIndexEntry,
+          mid);
+
+      if ((gint64) mid_e->offset < *pos)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+
+    if (forward) {
+      if (lo < demux->cluster_index->len)
+        e = &g_array_index (demux->cluster_index,
+            GstMatroskaClusterIndexEntry, lo);
+    } else {
+      if (lo < demux->cluster_index->len &&
+          (gint64) g_array_index (demux->cluster_index,
+              GstMatroskaClusterIndexEntry, lo).offset == *pos)
+        e = &g_array_index (demux->cluster_index,
+            GstMatroskaClusterIndexEntry, lo);
+      else if (lo > 0)
+        e = &g_array_index (demux->cluster_index,
+            GstMatroskaClusterIndexEntry, lo - 1);
+    }
+
+    /* sanity check */
+    if (e) {
+      GST_DEBUG_OBJECT (demux,
+          "learned cluster at offset %" G_GUINT64_FORMAT, e->offset);
+      demux->common.offset = e->offset;
+      ret = gst_matroska_read_common_peek_id_length_pull (&demux->common,
+          GST_ELEMENT_CAST (demux), &id, &length, &needed);
+      if (ret == GST_FLOW_OK && id == GST_MATROSKA_ID_CLUSTER) {
+        newpos = e->offset;
+        goto exit;
+      }
+    }
+  }
+
   /* read in at newpos and scan for ebml cluster id */
   oldpos = oldlength = -1;
   while (1) {
@@ -2565,6 +2680,54 @@ gst_matroska_demux_search_pos (GstMatroskaDemux * demux, GstClockTime time)
   otime = MAX (otime, atime);
   opos = MAX (opos, apos);
 
+  /* narrow the interval using clusters remembered from earlier scans and
+   * playback, so repeated seeks don't have to rescan the same region */
+  if (demux->cluster_index && demux->cluster_index->len > 0 &&
+      time != GST_CLOCK_TIME_NONE) {
+    guint lo = 0, hi = demux->cluster_index->len;
+
+    /* find the first known cluster with a time beyond the target */
+    while (lo < hi) {
+      guint mid = lo + (hi - lo) / 2;
+      GstMatroskaClusterIndexEntry *e = &g_array_index (demux->cluster_index,
+          GstMatroskaClusterIndexEntry, mid);
+
+      if (e->time <= time)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+
+    if (lo > 0) {
+      GstMatroskaClusterIndexEntry *e = &g_array_index (demux->cluster_index,
+          GstMatroskaClusterIndexEntry, lo - 1);
+
+      if (e->offset >= apos) {
+        apos = e->offset;
+        atime = e->time;
+        GST_DEBUG_OBJECT (demux, "known cluster before target: %"
+            G_GUINT64_FORMAT " at %" GST_TIME_FORMAT, apos,
+            GST_TIME_ARGS (atime));
+      }
+    }
+    if (lo < demux->cluster_index->len) {
+      GstMatroskaClusterIndexEntry *e = &g_array_index (demux->cluster_index,
+          GstMatroskaClusterIndexEntry, lo);
+
+      if (e->offset <= opos) {
+        opos = e->offset;
+        otime = e->time;
+        GST_DEBUG_OBJECT (demux, "known cluster after target: %"
+            G_GUINT64_FORMAT " at %" GST_TIME_FORMAT, opos,
+            GST_TIME_ARGS (otime));
+      }
+    }
+
+    /* keep the invariants intact */
+    otime = MAX (otime, atime);
+    opos = MAX (opos, apos);
+  }
+
   maxpos = gst_matroska_read_common_get_length (&demux->common);
 
   /* invariants;
@@ -5742,6 +5905,13 @@ gst_matroska_demux_parse_id (GstMatroskaDemux * demux, guint32 id,
             demux->stream_last_time =
                 demux->cluster_time * demux->common.time_scale;
           }
+          /* learn the cluster position for faster seeking; not in push
+           * mode, where byte offsets are of no use for seeking and the
+           * index would grow without bound on live streams */
+          if (!demux->streaming) {
+            gst_matroska_demux_remember_cluster (demux, demux->cluster_offset,
+                demux->cluster_time * demux->common.time_scale);
+          }
 #if 0
           if (demux->common.element_index) {
             if (demux->common.element_index_writer_id == -1)
@@ -74,6 +74,11 @@ typedef struct _GstMatroskaDemux {
   /* cluster positions (optional) */
   GArray                  *clusters;
 
+  /* (offset, timecode) of clusters learned during playback and seek
+   * scanning, sorted by time; used to narrow down seeks when cues are
+   * sparse or missing */
+  GArray                  *cluster_index;
+
   /* keeping track of playback position */
   GstClockTime             last_stop_end;
   GstClockTime             stream_start_time;
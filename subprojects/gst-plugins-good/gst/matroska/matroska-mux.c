@@ -3593,6 +3593,7 @@ gst_matroska_mux_finish (GstMatroskaMux * mux)
   /* finish last cluster */
   if (mux->cluster) {
     gst_ebml_write_master_finish (ebml, mux->cluster);
+    gst_ebml_write_flush_buffer_list (ebml);
   }
 
   /* cues */
@@ -4053,6 +4054,10 @@ gst_matroska_mux_write_data (GstMatroskaMux * mux, GstMatroskaPad * collect_pad,
       if (!mux->ebml_write->streamable)
         gst_ebml_write_master_finish (ebml, mux->cluster);
 
+      /* the previous cluster is complete now, push it downstream as a
+       * single buffer list */
+      gst_ebml_write_flush_buffer_list (ebml);
+
       /* Forward the GstForceKeyUnit event after finishing the cluster */
       if (mux->force_key_unit_event) {
         gst_pad_push_event (mux->srcpad, mux->force_key_unit_event);
@@ -4063,6 +4068,11 @@ gst_matroska_mux_write_data (GstMatroskaMux * mux, GstMatroskaPad * collect_pad,
 
       mux->prev_cluster_size = ebml->pos - mux->cluster_pos;
       mux->cluster_pos = ebml->pos;
+      /* aggregate the whole cluster into one buffer list so filesink can
+       * write it out in a single vectored write. Not for streaming, where
+       * each block should go out as soon as it is muxed. */
+      if (!mux->ebml_write->streamable)
+        gst_ebml_write_start_buffer_list (ebml);
       gst_ebml_write_set_cache (ebml, 0x20);
       mux->cluster =
           gst_ebml_write_master_start (ebml, GST_MATROSKA_ID_CLUSTER);
@@ -4090,6 +4100,8 @@ gst_matroska_mux_write_data (GstMatroskaMux * mux, GstMatroskaPad * collect_pad,
     cluster_time_scaled =
         gst_util_uint64_scale (buffer_timestamp, 1, mux->time_scale);
     mux->cluster_pos = ebml->pos;
+    if (!mux->ebml_write->streamable)
+      gst_ebml_write_start_buffer_list (ebml);
     gst_ebml_write_set_cache (ebml, 0x20);
     mux->cluster = gst_ebml_write_master_start (ebml, GST_MATROSKA_ID_CLUSTER);
     gst_ebml_write_uint (ebml, GST_MATROSKA_ID_CLUSTERTIMECODE,
@@ -119,6 +119,7 @@ enum
   PROP_SINK_FACTORY,
   PROP_SINK_PRESET,
   PROP_SINK_PROPERTIES,
+  PROP_MAX_FILES_FINALIZING,
   PROP_MUXERPAD_MAP
 };
 
@@ -133,6 +134,7 @@ enum
 #define DEFAULT_USE_ROBUST_MUXING FALSE
 #define DEFAULT_RESET_MUXER TRUE
 #define DEFAULT_ASYNC_FINALIZE FALSE
+#define DEFAULT_MAX_FILES_FINALIZING 0
 #define DEFAULT_START_INDEX 0
 
 typedef struct _AsyncEosHelper
@@ -449,6 +451,25 @@ gst_splitmux_sink_class_init (GstSplitMuxSinkClass * klass)
           "Example: {properties,boolean-prop=true,string-prop=\"hi\"}. "
           "Valid only for async-finalize = TRUE",
           GST_TYPE_STRUCTURE, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+  /**
+   * GstSplitMuxSink:max-files-finalizing
+   *
+   * The maximum number of old fragments that may be finalizing in the
+   * background at once. When the limit is reached, switching to the next
+   * fragment waits on the output thread until one of the old muxer/sink
+   * pairs has drained. 0 means no limit.
+   *
+   * This only has an effect in `async-finalize=TRUE` mode.
+   *
+   * Since: 1.22
+   */
+  g_object_class_install_property (gobject_class, PROP_MAX_FILES_FINALIZING,
+      g_param_spec_uint ("max-files-finalizing", "Max files finalizing",
+          "Max number of old fragments finalizing in the background before "
+          "fragment switches wait for one to finish (0 = no limit). "
+          "Valid only for async-finalize = TRUE",
+          0, G_MAXUINT, DEFAULT_MAX_FILES_FINALIZING,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
   g_object_class_install_property (gobject_class, PROP_START_INDEX,
       g_param_spec_int ("start-index", "Start Index",
           "Start value of fragment index.",
@@ -612,6 +633,7 @@ gst_splitmux_sink_init (GstSplitMuxSink * splitmux)
   splitmux->threshold_timecode_str = NULL;
 
   splitmux->async_finalize = DEFAULT_ASYNC_FINALIZE;
+  splitmux->max_files_finalizing = DEFAULT_MAX_FILES_FINALIZING;
   splitmux->muxer_factory = g_strdup (DEFAULT_MUXER);
   splitmux->muxer_properties = NULL;
   splitmux->sink_factory = g_strdup (DEFAULT_SINK);
@@ -855,6 +877,11 @@ gst_splitmux_sink_set_property (GObject * object, guint prop_id,
       splitmux->async_finalize = g_value_get_boolean (value);
       GST_OBJECT_UNLOCK (splitmux);
       break;
+    case PROP_MAX_FILES_FINALIZING:
+      GST_OBJECT_LOCK (splitmux);
+      splitmux->max_files_finalizing = g_value_get_uint (value);
+      GST_OBJECT_UNLOCK (splitmux);
+      break;
     case PROP_MUXER_FACTORY:
       GST_OBJECT_LOCK (splitmux);
       if (splitmux->muxer_factory)
@@ -1002,6 +1029,11 @@ gst_splitmux_sink_get_property (GObject * object, guint prop_id,
       g_value_set_boolean (value, splitmux->async_finalize);
       GST_OBJECT_UNLOCK (splitmux);
       break;
+    case PROP_MAX_FILES_FINALIZING:
+      GST_OBJECT_LOCK (splitmux);
+      g_value_set_uint (value, splitmux->max_files_finalizing);
+      GST_OBJECT_UNLOCK (splitmux);
+      break;
     case PROP_MUXER_FACTORY:
       GST_OBJECT_LOCK (splitmux);
       g_value_set_string (value, splitmux->muxer_factory);
@@ -1290,6 +1322,23 @@ complete_or_wait_on_out (GstSplitMuxSink * splitmux, MqStreamCtx * ctx)
           /* We've reached the max out running_time to get here, so end this file now */
           if (ctx->out_eos == FALSE) {
             if (splitmux->async_finalize) {
+              /* Bound the number of old fragments that can still be
+               * finalizing in the background before we hand off another
+               * one, so slow storage can't make old muxer/sink pairs
+               * pile up without limit */
+              while (splitmux->max_files_finalizing > 0
+                  && splitmux->files_finalizing >=
+                  splitmux->max_files_finalizing
+                  && splitmux->output_state == SPLITMUX_OUTPUT_STATE_ENDING_FILE
+                  && !ctx->flushing) {
+                GST_LOG_OBJECT (splitmux,
+                    "Waiting for one of %u finalizing fragment(s) to finish",
+                    splitmux->files_finalizing);
+                GST_SPLITMUX_WAIT_OUTPUT (splitmux);
+              }
+              if (ctx->flushing
+                  || splitmux->output_state == SPLITMUX_OUTPUT_STATE_STOPPED)
+                return GST_FLOW_FLUSHING;
               /* We must set EOS asynchronously at this point. We cannot defer
                * it, because we need all contexts to wake up, for the
                * reference context to eventually give us something at
@@ -1302,6 +1351,8 @@ complete_or_wait_on_out (GstSplitMuxSink * splitmux, MqStreamCtx * ctx)
               if (all_contexts_are_async_eos (splitmux)) {
                 GST_INFO_OBJECT (splitmux,
                     "All contexts are async_eos. Moving to the next file.");
+                /* The old muxer/sink pair is now finalizing in the background */
+                splitmux->files_finalizing++;
                 /* We can start the next file once we've asked each pad to go EOS */
                 splitmux->output_state = SPLITMUX_OUTPUT_STATE_START_NEXT_FILE;
                 GST_SPLITMUX_BROADCAST_OUTPUT (splitmux);
@@ -2240,6 +2291,12 @@ bus_handler (GstBin * bin, GstMessage * message)
             g_object_set_qdata ((GObject *) sink, EOS_FROM_US,
                 GINT_TO_POINTER (2));
           }
+          /* This muxer/sink pair has drained everything to the file, so it
+           * no longer counts against the finalizing limit. Wake up any
+           * output thread waiting to end the current fragment. */
+          if (splitmux->files_finalizing > 0)
+            splitmux->files_finalizing--;
+          GST_SPLITMUX_BROADCAST_OUTPUT (splitmux);
           GST_DEBUG_OBJECT (splitmux,
               "Caught async EOS from previous muxer+sink. Dropping.");
           /* We forward the EOS so that it gets aggregated as normal. If the sink
@@ -3927,6 +3984,7 @@ gst_splitmux_sink_reset (GstSplitMuxSink * splitmux)
   splitmux->fragment_reference_bytes = 0;
   splitmux->muxed_out_bytes = 0;
   splitmux->ready_for_output = FALSE;
+  splitmux->files_finalizing = 0;
 
   g_atomic_int_set (&(splitmux->split_requested), FALSE);
   g_atomic_int_set (&(splitmux->do_split_next_gop), FALSE);
@@ -215,6 +215,9 @@ struct _GstSplitMuxSink
 
   /* Async finalize options */
   gboolean async_finalize;
+  guint max_files_finalizing;
+  /* Number of old fragments still finalizing in the background */
+  guint files_finalizing;
   gchar *muxer_factory;
   gchar *muxer_preset;
   GstStructure *muxer_properties;
@@ -1336,20 +1336,24 @@ gst_rtp_h264_depay_process (GstRTPBaseDepayload * depayload, GstRTPBuffer * rtp)
           /* reconstruct NAL header */
           nal_header = (payload[0] & 0xe0) | (payload[1] & 0x1f);
 
-          /* strip type header, keep FU header, we'll reuse it to reconstruct
-           * the NAL header. */
-          payload += 1;
-          payload_len -= 1;
+          /* strip type header and FU header */
+          payload += 2;
+          payload_len -= 2;
 
-          nalu_size = payload_len;
+          nalu_size = payload_len + 1;
           outsize = nalu_size + sizeof (sync_bytes);
-          outbuf = gst_buffer_new_and_alloc (outsize);
 
+          /* small buffer for the sync bytes (filled in when the NAL is
+           * complete) and the reconstructed NAL header, the payload follows
+           * as a zero-copy sub-buffer of the RTP packet */
+          outbuf = gst_buffer_new_and_alloc (sizeof (sync_bytes) + 1);
           gst_buffer_map (outbuf, &map, GST_MAP_WRITE);
-          memcpy (map.data + sizeof (sync_bytes), payload, nalu_size);
           map.data[sizeof (sync_bytes)] = nal_header;
           gst_buffer_unmap (outbuf, &map);
 
+          outbuf = gst_buffer_append (outbuf,
+              gst_rtp_buffer_get_payload_subbuffer (rtp, 2, -1));
+
           gst_rtp_copy_video_meta (rtph264depay, outbuf, rtp->buffer);
 
           GST_DEBUG_OBJECT (rtph264depay, "queueing %d bytes", outsize);
@@ -1376,13 +1380,13 @@ gst_rtp_h264_depay_process (GstRTPBaseDepayload * depayload, GstRTPBuffer * rtp)
           }
           rtph264depay->last_fu_seqnum = gst_rtp_buffer_get_seq (rtp);
 
-          /* strip off FU indicator and FU header bytes */
+          /* strip off FU indicator and FU header bytes, the rest of the
+           * payload goes into the adapter as-is without copying */
           payload += 2;
           payload_len -= 2;
 
           outsize = payload_len;
-          outbuf = gst_buffer_new_and_alloc (outsize);
-          gst_buffer_fill (outbuf, 0, payload, outsize);
+          outbuf = gst_rtp_buffer_get_payload_subbuffer (rtp, 2, -1);
 
           gst_rtp_copy_video_meta (rtph264depay, outbuf, rtp->buffer);
 
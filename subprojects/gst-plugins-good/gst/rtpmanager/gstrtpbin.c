@@ -346,6 +346,7 @@ enum
 #define DEFAULT_RTP_PROFILE          GST_RTP_PROFILE_AVP
 #define DEFAULT_NTP_TIME_SOURCE      GST_RTP_NTP_TIME_SOURCE_NTP
 #define DEFAULT_RTCP_SYNC_SEND_TIME  TRUE
+#define DEFAULT_SHARED_RTCP_THREAD   FALSE
 #define DEFAULT_MAX_RTCP_RTP_TIME_DIFF 1000
 #define DEFAULT_MAX_DROPOUT_TIME     60000
 #define DEFAULT_MAX_MISORDER_TIME    2000
@@ -375,6 +376,7 @@ enum
   PROP_RTP_PROFILE,
   PROP_NTP_TIME_SOURCE,
   PROP_RTCP_SYNC_SEND_TIME,
+  PROP_SHARED_RTCP_THREAD,
   PROP_MAX_RTCP_RTP_TIME_DIFF,
   PROP_MAX_DROPOUT_TIME,
   PROP_MAX_MISORDER_TIME,
@@ -765,7 +767,7 @@ create_session (GstRtpBin * rtpbin, gint id)
   g_object_set (demux, "max-streams", rtpbin->max_streams, NULL);
   g_object_set (session, "sdes", rtpbin->sdes, "rtp-profile",
       rtpbin->rtp_profile, "rtcp-sync-send-time", rtpbin->rtcp_sync_send_time,
-      NULL);
+      "shared-rtcp-thread", rtpbin->shared_rtcp_thread, NULL);
   if (rtpbin->use_pipeline_clock)
     g_object_set (session, "use-pipeline-clock", rtpbin->use_pipeline_clock,
         NULL);
@@ -2738,6 +2740,22 @@ gst_rtp_bin_class_init (GstRtpBinClass * klass)
           DEFAULT_RTCP_SYNC_SEND_TIME,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstRtpBin:shared-rtcp-thread:
+   *
+   * Schedule RTCP of all sessions on one shared thread instead of a
+   * dedicated RTCP thread per session. See
+   * #GstRtpSession:shared-rtcp-thread.
+   *
+   * Since: 1.22
+   */
+  g_object_class_install_property (gobject_class, PROP_SHARED_RTCP_THREAD,
+      g_param_spec_boolean ("shared-rtcp-thread", "Shared RTCP Thread",
+          "Schedule RTCP of all sessions on one shared thread "
+          "instead of a thread per session",
+          DEFAULT_SHARED_RTCP_THREAD,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   g_object_class_install_property (gobject_class, PROP_MAX_RTCP_RTP_TIME_DIFF,
       g_param_spec_int ("max-rtcp-rtp-time-diff", "Max RTCP RTP Time Diff",
           "Maximum amount of time in ms that the RTP time in RTCP SRs "
@@ -2963,6 +2981,7 @@ gst_rtp_bin_init (GstRtpBin * rtpbin)
   rtpbin->rtp_profile = DEFAULT_RTP_PROFILE;
   rtpbin->ntp_time_source = DEFAULT_NTP_TIME_SOURCE;
   rtpbin->rtcp_sync_send_time = DEFAULT_RTCP_SYNC_SEND_TIME;
+  rtpbin->shared_rtcp_thread = DEFAULT_SHARED_RTCP_THREAD;
   rtpbin->max_rtcp_rtp_time_diff = DEFAULT_MAX_RTCP_RTP_TIME_DIFF;
   rtpbin->max_dropout_time = DEFAULT_MAX_DROPOUT_TIME;
   rtpbin->max_misorder_time = DEFAULT_MAX_MISORDER_TIME;
@@ -3253,6 +3272,13 @@ gst_rtp_bin_set_property (GObject * object, guint prop_id,
       GST_RTP_BIN_UNLOCK (rtpbin);
       break;
     }
+    case PROP_SHARED_RTCP_THREAD:
+      GST_RTP_BIN_LOCK (rtpbin);
+      rtpbin->shared_rtcp_thread = g_value_get_boolean (value);
+      GST_RTP_BIN_UNLOCK (rtpbin);
+      gst_rtp_bin_propagate_property_to_session (rtpbin,
+          "shared-rtcp-thread", value);
+      break;
     case PROP_MAX_RTCP_RTP_TIME_DIFF:
       GST_RTP_BIN_LOCK (rtpbin);
       rtpbin->max_rtcp_rtp_time_diff = g_value_get_int (value);
@@ -3379,6 +3405,9 @@ gst_rtp_bin_get_property (GObject * object, guint prop_id,
     case PROP_RTCP_SYNC_SEND_TIME:
       g_value_set_boolean (value, rtpbin->rtcp_sync_send_time);
       break;
+    case PROP_SHARED_RTCP_THREAD:
+      g_value_set_boolean (value, rtpbin->shared_rtcp_thread);
+      break;
     case PROP_MAX_RTCP_RTP_TIME_DIFF:
       GST_RTP_BIN_LOCK (rtpbin);
       g_value_set_int (value, rtpbin->max_rtcp_rtp_time_diff);
@@ -70,6 +70,7 @@ struct _GstRtpBin {
   gboolean        do_retransmission;
   GstRTPProfile   rtp_profile;
   gboolean        rtcp_sync_send_time;
+  gboolean        shared_rtcp_thread;
   gint            max_rtcp_rtp_time_diff;
   guint32         max_dropout_time;
   guint32         max_misorder_time;
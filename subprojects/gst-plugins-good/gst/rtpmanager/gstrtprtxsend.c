@@ -386,7 +386,6 @@ gst_rtp_rtx_buffer_new (GstRtpRtxSend * rtx, GstBuffer * buffer)
   GstRTPBuffer new_rtp = GST_RTP_BUFFER_INIT;
   GstBuffer *new_buffer = gst_buffer_new ();
   GstMapInfo map;
-  guint payload_len = 0;
   SSRCRtxData *data;
   guint32 ssrc;
   guint16 seqnum;
@@ -422,17 +421,22 @@ gst_rtp_rtx_buffer_new (GstRtpRtxSend * rtx, GstBuffer * buffer)
     gst_buffer_append_memory (new_buffer, mem);
   }
 
-  /* copy payload and add OSN just before */
-  payload_len = 2 + rtp.size[2];
-  mem = gst_allocator_alloc (NULL, payload_len, NULL);
+  /* add OSN just before the payload */
+  mem = gst_allocator_alloc (NULL, 2, NULL);
 
   gst_memory_map (mem, &map, GST_MAP_WRITE);
   GST_WRITE_UINT16_BE (map.data, gst_rtp_buffer_get_seq (&rtp));
-  if (rtp.size[2])
-    memcpy (map.data + 2, rtp.data[2], rtp.size[2]);
   gst_memory_unmap (mem, &map);
   gst_buffer_append_memory (new_buffer, mem);
 
+  /* share the payload with the original buffer instead of copying it; the
+   * rtx header rewrites below only ever touch the copied fixed header */
+  if (rtp.size[2]) {
+    GstBuffer *payload = gst_buffer_copy_region (buffer,
+        GST_BUFFER_COPY_MEMORY, rtp.size[0] + rtp.size[1], rtp.size[2]);
+    new_buffer = gst_buffer_append (new_buffer, payload);
+  }
+
   /* everything needed is copied */
   gst_rtp_buffer_unmap (&rtp);
 
@@ -222,6 +222,7 @@ enum
 #define DEFAULT_RTP_PROFILE          GST_RTP_PROFILE_AVP
 #define DEFAULT_NTP_TIME_SOURCE      GST_RTP_NTP_TIME_SOURCE_NTP
 #define DEFAULT_RTCP_SYNC_SEND_TIME  TRUE
+#define DEFAULT_SHARED_RTCP_THREAD   FALSE
 
 enum
 {
@@ -243,7 +244,8 @@ enum
   PROP_TWCC_STATS,
   PROP_RTP_PROFILE,
   PROP_NTP_TIME_SOURCE,
-  PROP_RTCP_SYNC_SEND_TIME
+  PROP_RTCP_SYNC_SEND_TIME,
+  PROP_SHARED_RTCP_THREAD
 };
 
 #define GST_RTP_SESSION_LOCK(sess)   g_mutex_lock (&(sess)->priv->lock)
@@ -267,6 +269,11 @@ struct _GstRtpSessionPrivate
   gboolean thread_stopped;
   gboolean wait_send;
 
+  /* shared RTCP scheduling */
+  gboolean shared_rtcp_thread;
+  gboolean use_shared_thread;
+  gboolean scheduler_started;
+
   /* caps mapping */
   GHashTable *ptmap;
 
@@ -805,6 +812,25 @@ gst_rtp_session_class_init (GstRtpSessionClass * klass)
           DEFAULT_RTCP_SYNC_SEND_TIME,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstRtpSession:shared-rtcp-thread:
+   *
+   * Schedule RTCP for this session on a single thread shared by all
+   * sessions with this property enabled, instead of spawning a dedicated
+   * RTCP thread per session. This keeps the thread count constant when
+   * running many hundreds of sessions in one process. Since the thread is
+   * shared, a blocking send_rtcp_src pad in one session delays the RTCP
+   * of the other sessions.
+   *
+   * Since: 1.22
+   */
+  g_object_class_install_property (gobject_class, PROP_SHARED_RTCP_THREAD,
+      g_param_spec_boolean ("shared-rtcp-thread", "Shared RTCP Thread",
+          "Schedule RTCP on a single thread shared by all sessions "
+          "instead of a thread per session",
+          DEFAULT_SHARED_RTCP_THREAD,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   gstelement_class->change_state =
       GST_DEBUG_FUNCPTR (gst_rtp_session_change_state);
   gstelement_class->request_new_pad =
@@ -902,6 +928,7 @@ gst_rtp_session_init (GstRtpSession * rtpsession)
   rtpsession->priv->sent_rtx_req_count = 0;
 
   rtpsession->priv->ntp_time_source = DEFAULT_NTP_TIME_SOURCE;
+  rtpsession->priv->shared_rtcp_thread = DEFAULT_SHARED_RTCP_THREAD;
 }
 
 static void
@@ -977,6 +1004,9 @@ gst_rtp_session_set_property (GObject * object, guint prop_id,
     case PROP_RTCP_SYNC_SEND_TIME:
       priv->rtcp_sync_send_time = g_value_get_boolean (value);
       break;
+    case PROP_SHARED_RTCP_THREAD:
+      priv->shared_rtcp_thread = g_value_get_boolean (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -1056,6 +1086,9 @@ gst_rtp_session_get_property (GObject * object, guint prop_id,
     case PROP_RTCP_SYNC_SEND_TIME:
       g_value_set_boolean (value, priv->rtcp_sync_send_time);
       break;
+    case PROP_SHARED_RTCP_THREAD:
+      g_value_set_boolean (value, priv->shared_rtcp_thread);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -1135,6 +1168,173 @@ get_current_times (GstRtpSession * rtpsession, GstClockTime * running_time,
     *ntpnstime = ntpns;
 }
 
+/* A single thread shared by all sessions with the shared-rtcp-thread
+ * property enabled. It keeps track of the earliest RTCP timeout over all
+ * registered sessions and dispatches rtp_session_on_timeout() for the
+ * sessions that are due, instead of each session blocking its own thread
+ * on the clock. The thread is created on first use and then lives for the
+ * remainder of the process, waiting on the condition when no session is
+ * registered. The scheduler lock is always taken after the session lock,
+ * never the other way around. */
+static struct
+{
+  GMutex lock;
+  GCond cond;                   /* scheduler wakeup */
+  GCond done_cond;              /* end of a dispatch pass, for joining */
+  GThread *thread;
+  GList *sessions;              /* GstRtpSession references */
+  GstClockID id;                /* pending clock wait */
+  gboolean busy;                /* inside a dispatch pass */
+  GstClock *sysclock;
+} rtcp_scheduler;
+
+/* wake up the scheduler so that it recomputes its timeouts. Can be called
+ * with the session lock held. */
+static void
+rtcp_scheduler_kick (void)
+{
+  g_mutex_lock (&rtcp_scheduler.lock);
+  if (rtcp_scheduler.id)
+    gst_clock_id_unschedule (rtcp_scheduler.id);
+  g_cond_signal (&rtcp_scheduler.cond);
+  g_mutex_unlock (&rtcp_scheduler.lock);
+}
+
+static gpointer
+rtcp_scheduler_thread (gpointer data)
+{
+  GST_DEBUG ("entering shared RTCP scheduler thread");
+
+  g_mutex_lock (&rtcp_scheduler.lock);
+  while (TRUE) {
+    GstClockTime earliest = GST_CLOCK_TIME_NONE;
+    GstClockTime current_time;
+    GList *sessions, *walk;
+
+    sessions = g_list_copy_deep (rtcp_scheduler.sessions,
+        (GCopyFunc) gst_object_ref, NULL);
+    rtcp_scheduler.busy = TRUE;
+    g_mutex_unlock (&rtcp_scheduler.lock);
+
+    current_time = gst_clock_get_time (rtcp_scheduler.sysclock);
+
+    for (walk = sessions; walk; walk = walk->next) {
+      GstRtpSession *rtpsession = walk->data;
+      RTPSession *session;
+      GstClockTime next_timeout;
+
+      GST_RTP_SESSION_LOCK (rtpsession);
+      if (rtpsession->priv->wait_send || rtpsession->priv->stop_thread) {
+        GST_RTP_SESSION_UNLOCK (rtpsession);
+        continue;
+      }
+      session = rtpsession->priv->session;
+      if (!rtpsession->priv->scheduler_started) {
+        GST_DEBUG_OBJECT (rtpsession, "starting at %" GST_TIME_FORMAT,
+            GST_TIME_ARGS (current_time));
+        session->start_time = current_time;
+        rtpsession->priv->scheduler_started = TRUE;
+      }
+      GST_RTP_SESSION_UNLOCK (rtpsession);
+
+      next_timeout = rtp_session_next_timeout (session, current_time);
+
+      if (next_timeout != GST_CLOCK_TIME_NONE && next_timeout <= current_time) {
+        GstClockTime running_time;
+        guint64 ntpnstime;
+
+        get_current_times (rtpsession, &running_time, &ntpnstime);
+
+        GST_DEBUG_OBJECT (rtpsession, "timeout at %" GST_TIME_FORMAT,
+            GST_TIME_ARGS (next_timeout));
+
+        /* this might push RTCP downstream */
+        rtp_session_on_timeout (session, current_time, ntpnstime,
+            running_time);
+
+        next_timeout = rtp_session_next_timeout (session,
+            gst_clock_get_time (rtcp_scheduler.sysclock));
+      }
+
+      if (next_timeout != GST_CLOCK_TIME_NONE &&
+          (earliest == GST_CLOCK_TIME_NONE || next_timeout < earliest))
+        earliest = next_timeout;
+    }
+    g_list_free_full (sessions, gst_object_unref);
+
+    g_mutex_lock (&rtcp_scheduler.lock);
+    rtcp_scheduler.busy = FALSE;
+    g_cond_broadcast (&rtcp_scheduler.done_cond);
+
+    if (earliest == GST_CLOCK_TIME_NONE) {
+      /* no session has a pending timeout, wait for a kick */
+      g_cond_wait (&rtcp_scheduler.cond, &rtcp_scheduler.lock);
+    } else {
+      GstClockID id;
+
+      id = rtcp_scheduler.id =
+          gst_clock_new_single_shot_id (rtcp_scheduler.sysclock, earliest);
+      g_mutex_unlock (&rtcp_scheduler.lock);
+
+      gst_clock_id_wait (id, NULL);
+
+      g_mutex_lock (&rtcp_scheduler.lock);
+      gst_clock_id_unref (id);
+      rtcp_scheduler.id = NULL;
+    }
+  }
+
+  return NULL;
+}
+
+static void
+rtcp_scheduler_add (GstRtpSession * rtpsession)
+{
+  g_mutex_lock (&rtcp_scheduler.lock);
+  if (rtcp_scheduler.thread == NULL) {
+    rtcp_scheduler.sysclock = gst_system_clock_obtain ();
+    rtcp_scheduler.thread = g_thread_new ("rtpsession-rtcp-sched",
+        rtcp_scheduler_thread, NULL);
+  }
+  if (!g_list_find (rtcp_scheduler.sessions, rtpsession))
+    rtcp_scheduler.sessions =
+        g_list_prepend (rtcp_scheduler.sessions, gst_object_ref (rtpsession));
+  if (rtcp_scheduler.id)
+    gst_clock_id_unschedule (rtcp_scheduler.id);
+  g_cond_signal (&rtcp_scheduler.cond);
+  g_mutex_unlock (&rtcp_scheduler.lock);
+}
+
+static void
+rtcp_scheduler_remove (GstRtpSession * rtpsession)
+{
+  GList *link;
+
+  g_mutex_lock (&rtcp_scheduler.lock);
+  link = g_list_find (rtcp_scheduler.sessions, rtpsession);
+  if (link) {
+    rtcp_scheduler.sessions =
+        g_list_delete_link (rtcp_scheduler.sessions, link);
+    gst_object_unref (rtpsession);
+  }
+  if (rtcp_scheduler.id)
+    gst_clock_id_unschedule (rtcp_scheduler.id);
+  g_cond_signal (&rtcp_scheduler.cond);
+  g_mutex_unlock (&rtcp_scheduler.lock);
+}
+
+/* wait until the dispatch pass that might still be using a just removed
+ * session has finished. Must be called after rtcp_scheduler_remove() and
+ * without the session lock. */
+static void
+rtcp_scheduler_wait_done (void)
+{
+  g_mutex_lock (&rtcp_scheduler.lock);
+  while (rtcp_scheduler.busy)
+    g_cond_wait (&rtcp_scheduler.done_cond, &rtcp_scheduler.lock);
+  g_mutex_unlock (&rtcp_scheduler.lock);
+}
+
 /* must be called with GST_RTP_SESSION_LOCK */
 static void
 signal_waiting_rtcp_thread_unlocked (GstRtpSession * rtpsession)
@@ -1143,6 +1343,8 @@ signal_waiting_rtcp_thread_unlocked (GstRtpSession * rtpsession)
     GST_LOG_OBJECT (rtpsession, "signal RTCP thread");
     rtpsession->priv->wait_send = FALSE;
     GST_RTP_SESSION_SIGNAL (rtpsession);
+    if (rtpsession->priv->use_shared_thread)
+      rtcp_scheduler_kick ();
   }
 }
 
@@ -1235,6 +1437,12 @@ start_rtcp_thread (GstRtpSession * rtpsession)
 
   GST_RTP_SESSION_LOCK (rtpsession);
   rtpsession->priv->stop_thread = FALSE;
+  rtpsession->priv->use_shared_thread = rtpsession->priv->shared_rtcp_thread;
+  if (rtpsession->priv->use_shared_thread) {
+    GST_RTP_SESSION_UNLOCK (rtpsession);
+    rtcp_scheduler_add (rtpsession);
+    return TRUE;
+  }
   if (rtpsession->priv->thread_stopped) {
     /* if the thread stopped, and we still have a handle to the thread, join it
      * now. We can safely join with the lock held, the thread will not take it
@@ -1262,20 +1470,36 @@ start_rtcp_thread (GstRtpSession * rtpsession)
 static void
 stop_rtcp_thread (GstRtpSession * rtpsession)
 {
+  gboolean use_shared;
+
   GST_DEBUG_OBJECT (rtpsession, "stopping RTCP thread");
 
   GST_RTP_SESSION_LOCK (rtpsession);
   rtpsession->priv->stop_thread = TRUE;
+  use_shared = rtpsession->priv->use_shared_thread;
   signal_waiting_rtcp_thread_unlocked (rtpsession);
   if (rtpsession->priv->id)
     gst_clock_id_unschedule (rtpsession->priv->id);
   GST_RTP_SESSION_UNLOCK (rtpsession);
+
+  if (use_shared)
+    rtcp_scheduler_remove (rtpsession);
 }
 
 static void
 join_rtcp_thread (GstRtpSession * rtpsession)
 {
   GST_RTP_SESSION_LOCK (rtpsession);
+  if (rtpsession->priv->use_shared_thread) {
+    GST_RTP_SESSION_UNLOCK (rtpsession);
+    /* the session was removed from the scheduler in stop_rtcp_thread(),
+     * wait until the dispatch pass that might still use it has finished */
+    rtcp_scheduler_wait_done ();
+    GST_RTP_SESSION_LOCK (rtpsession);
+    rtpsession->priv->use_shared_thread = FALSE;
+    GST_RTP_SESSION_UNLOCK (rtpsession);
+    return;
+  }
   /* don't try to join when we have no thread */
   if (rtpsession->priv->thread != NULL) {
     GST_DEBUG_OBJECT (rtpsession, "joining RTCP thread");
@@ -1305,6 +1529,7 @@ gst_rtp_session_change_state (GstElement * element, GstStateChange transition)
     case GST_STATE_CHANGE_READY_TO_PAUSED:
       GST_RTP_SESSION_LOCK (rtpsession);
       rtpsession->priv->wait_send = TRUE;
+      rtpsession->priv->scheduler_started = FALSE;
       GST_RTP_SESSION_UNLOCK (rtpsession);
       break;
     case GST_STATE_CHANGE_PAUSED_TO_PLAYING:
@@ -1714,6 +1939,7 @@ static void
 gst_rtp_session_reconsider (RTPSession * sess, gpointer user_data)
 {
   GstRtpSession *rtpsession;
+  gboolean use_shared;
 
   rtpsession = GST_RTP_SESSION_CAST (user_data);
 
@@ -1721,7 +1947,11 @@ gst_rtp_session_reconsider (RTPSession * sess, gpointer user_data)
   GST_DEBUG_OBJECT (rtpsession, "unlock timer for reconsideration");
   if (rtpsession->priv->id)
     gst_clock_id_unschedule (rtpsession->priv->id);
+  use_shared = rtpsession->priv->use_shared_thread;
   GST_RTP_SESSION_UNLOCK (rtpsession);
+
+  if (use_shared)
+    rtcp_scheduler_kick ();
 }
 
 static gboolean
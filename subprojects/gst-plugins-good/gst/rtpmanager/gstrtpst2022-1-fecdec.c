@@ -375,7 +375,32 @@ _xor_mem (guint8 * restrict dst, const guint8 * restrict src, gsize length)
 {
   guint i;
 
-  for (i = 0; i < (length / sizeof (guint64)); ++i) {
+  /* 32-byte blocks first: a straight-line block body is turned into
+   * full-width vector XORs by the compiler on targets that have them */
+  for (i = 0; i < (length / 32); ++i) {
+#if G_BYTE_ORDER == G_LITTLE_ENDIAN
+    GST_WRITE_UINT64_LE (dst,
+        GST_READ_UINT64_LE (dst) ^ GST_READ_UINT64_LE (src));
+    GST_WRITE_UINT64_LE (dst + 8,
+        GST_READ_UINT64_LE (dst + 8) ^ GST_READ_UINT64_LE (src + 8));
+    GST_WRITE_UINT64_LE (dst + 16,
+        GST_READ_UINT64_LE (dst + 16) ^ GST_READ_UINT64_LE (src + 16));
+    GST_WRITE_UINT64_LE (dst + 24,
+        GST_READ_UINT64_LE (dst + 24) ^ GST_READ_UINT64_LE (src + 24));
+#else
+    GST_WRITE_UINT64_BE (dst,
+        GST_READ_UINT64_BE (dst) ^ GST_READ_UINT64_BE (src));
+    GST_WRITE_UINT64_BE (dst + 8,
+        GST_READ_UINT64_BE (dst + 8) ^ GST_READ_UINT64_BE (src + 8));
+    GST_WRITE_UINT64_BE (dst + 16,
+        GST_READ_UINT64_BE (dst + 16) ^ GST_READ_UINT64_BE (src + 16));
+    GST_WRITE_UINT64_BE (dst + 24,
+        GST_READ_UINT64_BE (dst + 24) ^ GST_READ_UINT64_BE (src + 24));
+#endif
+    dst += 32;
+    src += 32;
+  }
+  for (i = 0; i < ((length % 32) / sizeof (guint64)); ++i) {
 #if G_BYTE_ORDER == G_LITTLE_ENDIAN
     GST_WRITE_UINT64_LE (dst,
         GST_READ_UINT64_LE (dst) ^ GST_READ_UINT64_LE (src));
@@ -406,21 +431,32 @@ xor_items (GstRTPST_2022_1_FecDec * dec, Rtp2DFecHeader * fec, GList * packets,
   gboolean xored_marker;
   gboolean xored_padding;
   gboolean xored_extension;
+  const GstRTPBuffer rtp_init = GST_RTP_BUFFER_INIT;
+  GstRTPBuffer *media_rtps;
+  guint n_packets, i;
 
-  /* Figure out the recovered packet length first */
-  xored_payload_len = fec->len;
-  for (tmp = packets; tmp; tmp = tmp->next) {
-    GstRTPBuffer media_rtp = GST_RTP_BUFFER_INIT;
+  /* Map each surviving packet only once, both the length recovery and the
+   * payload XOR below read from the same mapping */
+  n_packets = g_list_length (packets);
+  media_rtps = g_newa (GstRTPBuffer, n_packets);
+
+  for (tmp = packets, i = 0; tmp; tmp = tmp->next, i++) {
     Item *item = (Item *) tmp->data;
 
-    gst_rtp_buffer_map (item->buffer, GST_MAP_READ, &media_rtp);
-    xored_payload_len ^= gst_rtp_buffer_get_payload_len (&media_rtp);
-    gst_rtp_buffer_unmap (&media_rtp);
+    media_rtps[i] = rtp_init;
+    gst_rtp_buffer_map (item->buffer, GST_MAP_READ, &media_rtps[i]);
   }
 
+  /* Figure out the recovered packet length first */
+  xored_payload_len = fec->len;
+  for (i = 0; i < n_packets; i++)
+    xored_payload_len ^= gst_rtp_buffer_get_payload_len (&media_rtps[i]);
+
   if (xored_payload_len > fec->payload_len) {
     GST_WARNING_OBJECT (dec, "FEC payload len %u < length recovery %u",
         fec->payload_len, xored_payload_len);
+    for (i = 0; i < n_packets; i++)
+      gst_rtp_buffer_unmap (&media_rtps[i]);
     goto done;
   }
 
@@ -437,22 +473,21 @@ xor_items (GstRTPST_2022_1_FecDec * dec, Rtp2DFecHeader * fec, GList * packets,
   xored_padding = fec->padding;
   xored_extension = fec->extension;
 
-  for (tmp = packets; tmp; tmp = tmp->next) {
-    GstRTPBuffer media_rtp = GST_RTP_BUFFER_INIT;
-    Item *item = (Item *) tmp->data;
-
-    gst_rtp_buffer_map (item->buffer, GST_MAP_READ, &media_rtp);
-    _xor_mem (xored, gst_rtp_buffer_get_payload (&media_rtp),
-        MIN (gst_rtp_buffer_get_payload_len (&media_rtp), xored_payload_len));
-    xored_timestamp ^= gst_rtp_buffer_get_timestamp (&media_rtp);
-    xored_pt ^= gst_rtp_buffer_get_payload_type (&media_rtp);
-    xored_marker ^= gst_rtp_buffer_get_marker (&media_rtp);
-    xored_padding ^= gst_rtp_buffer_get_padding (&media_rtp);
-    xored_extension ^= gst_rtp_buffer_get_extension (&media_rtp);
+  for (i = 0; i < n_packets; i++) {
+    GstRTPBuffer *media_rtp = &media_rtps[i];
 
-    gst_rtp_buffer_unmap (&media_rtp);
+    _xor_mem (xored, gst_rtp_buffer_get_payload (media_rtp),
+        MIN (gst_rtp_buffer_get_payload_len (media_rtp), xored_payload_len));
+    xored_timestamp ^= gst_rtp_buffer_get_timestamp (media_rtp);
+    xored_pt ^= gst_rtp_buffer_get_payload_type (media_rtp);
+    xored_marker ^= gst_rtp_buffer_get_marker (media_rtp);
+    xored_padding ^= gst_rtp_buffer_get_padding (media_rtp);
+    xored_extension ^= gst_rtp_buffer_get_extension (media_rtp);
   }
 
+  for (i = 0; i < n_packets; i++)
+    gst_rtp_buffer_unmap (&media_rtps[i]);
+
   GST_DEBUG_OBJECT (dec,
       "Recovered buffer through %s FEC with seqnum %u, payload len %u and timestamp %u",
       fec->D ? "row" : "column", seqnum, xored_payload_len, xored_timestamp);
@@ -4406,6 +4406,7 @@ rtp_session_on_timeout (RTPSession * sess, GstClockTime current_time,
   GHashTable *table_copy;
   ReportOutput *output;
   gboolean all_empty = FALSE;
+  gboolean all_sources_bye;
 
   g_return_val_if_fail (RTP_IS_SESSION (sess), GST_FLOW_ERROR);
 
@@ -4513,6 +4514,11 @@ done:
   /* notify about updated statistics */
   g_object_notify (G_OBJECT (sess), "stats");
 
+  /* sample whether all internal sources sent BYE once for this batch of
+   * packets instead of walking the whole source table again for every
+   * packet; every extra walk takes the session lock the media path needs */
+  all_sources_bye = rtp_session_are_all_sources_bye (sess);
+
   /* push out the RTCP packets */
   while ((output = g_queue_pop_head (&data.output))) {
     gboolean do_not_suppress, empty_buffer;
@@ -4539,7 +4545,7 @@ done:
           sess->stats.avg_rtcp_packet_size, packet_size);
       result =
           sess->callbacks.send_rtcp (sess, source, buffer,
-          rtp_session_are_all_sources_bye (sess), sess->send_rtcp_user_data);
+          all_sources_bye, sess->send_rtcp_user_data);
 
       RTP_SESSION_LOCK (sess);
       sess->stats.nacks_sent += data.nacked_seqnums;
@@ -288,6 +288,25 @@ rtp_timer_queue_insert_head (RtpTimerQueue * queue, RtpTimer * timer)
     rtp_timer_queue_insert_before (queue, it, timer);
 }
 
+static void
+rtp_timer_queue_insert_sorted (RtpTimerQueue * queue, RtpTimer * timer)
+{
+  RtpTimer *head = rtp_timer_queue_get_head (queue);
+  RtpTimer *tail = rtp_timer_queue_get_tail (queue);
+
+  /* Scan from whichever end is closer in time. Expected (RTX) timers have
+   * timeouts well below the queued lost timers, so inserting them from the
+   * tail would walk over every lost timer in the queue on each packet. */
+  if (head != NULL && tail != NULL &&
+      GST_CLOCK_TIME_IS_VALID (head->timeout) &&
+      GST_CLOCK_TIME_IS_VALID (tail->timeout) &&
+      GST_CLOCK_DIFF (head->timeout, timer->timeout) <
+      GST_CLOCK_DIFF (timer->timeout, tail->timeout))
+    rtp_timer_queue_insert_head (queue, timer);
+  else
+    rtp_timer_queue_insert_tail (queue, timer);
+}
+
 static void
 rtp_timer_queue_init (RtpTimerQueue * queue)
 {
@@ -395,8 +414,9 @@ rtp_timer_queue_new (void)
  *
  * Insert a timer into the queue. Earliest timer are at the head and then
  * timer are sorted by seqnum (smaller seqnum first). This function is o(n)
- * but it is expected that most timers added are schedule later, in which case
- * the insertion will be faster.
+ * but it scans from whichever end of the queue is closest to the new
+ * timeout, so timers scheduled near the head or the tail are inserted
+ * quickly.
  *
  * Returns: %FALSE if a timer with the same seqnum already existed
  */
@@ -414,7 +434,7 @@ rtp_timer_queue_insert (RtpTimerQueue * queue, RtpTimer * timer)
   if (timer->timeout == -1)
     rtp_timer_queue_insert_head (queue, timer);
   else
-    rtp_timer_queue_insert_tail (queue, timer);
+    rtp_timer_queue_insert_sorted (queue, timer);
 
   g_hash_table_insert (queue->hashtable,
       GINT_TO_POINTER (timer->seqnum), timer);
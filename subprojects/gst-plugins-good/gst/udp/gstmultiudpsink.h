@@ -65,6 +65,9 @@ struct _GstMultiUDPSink {
   GCancellable  *cancellable;
   gboolean       made_cancel_fd;
 
+  /* whether the kernel supports UDP generic segmentation offload */
+  gboolean       gso_supported;
+
   /* client management */
   GMutex         client_lock;
   GList         *clients;
@@ -102,6 +105,7 @@ struct _GstMultiUDPSink {
   gint           buffer_size;
   gchar         *bind_address;
   gint           bind_port;
+  gboolean       enable_gso;
 };
 
 struct _GstMultiUDPSinkClass {
@@ -570,6 +570,8 @@ static GstStaticPadTemplate src_template = GST_STATIC_PAD_TEMPLATE ("src",
 #define UDP_DEFAULT_LOOP               TRUE
 #define UDP_DEFAULT_RETRIEVE_SENDER_ADDRESS TRUE
 #define UDP_DEFAULT_MTU                (1492)
+#define UDP_DEFAULT_BATCH_SIZE         (1)
+#define UDP_MAX_BATCH_SIZE             (64)
 
 enum
 {
@@ -593,6 +595,7 @@ enum
   PROP_RETRIEVE_SENDER_ADDRESS,
   PROP_MTU,
   PROP_SOCKET_TIMESTAMP,
+  PROP_BATCH_SIZE,
 };
 
 static void gst_udpsrc_uri_handler_init (gpointer g_iface, gpointer iface_data);
@@ -601,6 +604,8 @@ static GstCaps *gst_udpsrc_getcaps (GstBaseSrc * src, GstCaps * filter);
 static gboolean gst_udpsrc_close (GstUDPSrc * src);
 static gboolean gst_udpsrc_unlock (GstBaseSrc * bsrc);
 static gboolean gst_udpsrc_unlock_stop (GstBaseSrc * bsrc);
+static GstFlowReturn gst_udpsrc_create (GstPushSrc * psrc,
+    GstBuffer ** outbuf);
 static GstFlowReturn gst_udpsrc_fill (GstPushSrc * psrc, GstBuffer * outbuf);
 
 static void gst_udpsrc_finalize (GObject * object);
@@ -779,6 +784,30 @@ gst_udpsrc_class_init (GstUDPSrcClass * klass)
           GST_SOCKET_TIMESTAMP_MODE, GST_SOCKET_TIMESTAMP_MODE_REALTIME,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstUDPSrc:batch-size:
+   *
+   * Maximum number of datagrams to receive per system call with
+   * g_socket_receive_messages() (recvmmsg() on Linux). When more than one
+   * packet is pending in the kernel, the whole batch is pushed downstream
+   * as a single buffer list, reducing the per-packet syscall and push
+   * overhead on high packet rate streams.
+   *
+   * Batching is not used when per-packet socket control messages are
+   * needed, i.e. for multicast filtering or when
+   * #GstUDPSrc:socket-timestamp is enabled. Note that in batched mode
+   * packets larger than #GstUDPSrc:mtu are truncated, so make sure the mtu
+   * is large enough for the expected packet size.
+   *
+   * Since: 1.22
+   */
+  g_object_class_install_property (gobject_class, PROP_BATCH_SIZE,
+      g_param_spec_uint ("batch-size", "Batch Size",
+          "Maximum number of datagrams to receive per system call "
+          "(1 = disable batching)",
+          1, UDP_MAX_BATCH_SIZE, UDP_DEFAULT_BATCH_SIZE,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   gst_element_class_add_static_pad_template (gstelement_class, &src_template);
 
   gst_element_class_set_static_metadata (gstelement_class,
@@ -794,6 +823,7 @@ gst_udpsrc_class_init (GstUDPSrcClass * klass)
   gstbasesrc_class->get_caps = gst_udpsrc_getcaps;
   gstbasesrc_class->decide_allocation = gst_udpsrc_decide_allocation;
 
+  gstpushsrc_class->create = gst_udpsrc_create;
   gstpushsrc_class->fill = gst_udpsrc_fill;
 
   gst_type_mark_as_plugin_api (GST_TYPE_SOCKET_TIMESTAMP_MODE, 0);
@@ -821,6 +851,7 @@ gst_udpsrc_init (GstUDPSrc * udpsrc)
   udpsrc->loop = UDP_DEFAULT_LOOP;
   udpsrc->retrieve_sender_address = UDP_DEFAULT_RETRIEVE_SENDER_ADDRESS;
   udpsrc->mtu = UDP_DEFAULT_MTU;
+  udpsrc->batch_size = UDP_DEFAULT_BATCH_SIZE;
 
   /* configure basesrc to be a live source */
   gst_base_src_set_live (GST_BASE_SRC (udpsrc), TRUE);
@@ -912,6 +943,266 @@ gst_udpsrc_free_cancellable (GstUDPSrc * src)
   src->cancellable = NULL;
 }
 
+static GstFlowReturn
+gst_udpsrc_create (GstPushSrc * psrc, GstBuffer ** outbuf)
+{
+  GstUDPSrc *udpsrc;
+  GstBaseSrcClass *bclass;
+  GInputMessage *gmsgs;
+  GInputVector *ivecs;
+  GstBuffer **bufs;
+  GstMapInfo *infos;
+  GSocketAddress **saddrs;
+  GstBufferList *list;
+  gboolean need_msgs, try_again;
+  guint batch, n_alloc, i;
+  gint res;
+  gsize offset;
+  GError *err = NULL;
+  GstFlowReturn ret;
+
+  udpsrc = GST_UDPSRC_CAST (psrc);
+  bclass = GST_BASE_SRC_GET_CLASS (udpsrc);
+
+  batch = udpsrc->batch_size;
+
+  /* Batched receives can't use per-packet socket control messages, which we
+   * need for multicast filtering and for socket timestamps; same conditions
+   * as in gst_udpsrc_fill() */
+  need_msgs =
+      g_inet_address_get_is_multicast (g_inet_socket_address_get_address
+      (udpsrc->addr));
+#ifdef IP_MULTICAST_ALL
+  if (g_inet_address_get_family (g_inet_socket_address_get_address
+          (udpsrc->addr)) == G_SOCKET_FAMILY_IPV4)
+    need_msgs = FALSE;
+#endif
+#ifdef SO_TIMESTAMPNS
+  if (udpsrc->socket_timestamp_mode == GST_SOCKET_TIMESTAMP_MODE_REALTIME)
+    need_msgs = TRUE;
+#endif
+
+  if (batch <= 1 || need_msgs) {
+    GstBuffer *buf = NULL;
+
+    /* one packet per syscall */
+    ret = bclass->alloc (GST_BASE_SRC_CAST (udpsrc), -1, udpsrc->mtu, &buf);
+    if (G_UNLIKELY (ret != GST_FLOW_OK))
+      return ret;
+
+    ret = gst_udpsrc_fill (psrc, buf);
+    if (G_UNLIKELY (ret != GST_FLOW_OK))
+      gst_buffer_unref (buf);
+    else
+      *outbuf = buf;
+
+    return ret;
+  }
+
+  gmsgs = g_newa (GInputMessage, batch);
+  ivecs = g_newa (GInputVector, batch);
+  bufs = g_newa (GstBuffer *, batch);
+  infos = g_newa (GstMapInfo, batch);
+  saddrs = g_newa (GSocketAddress *, batch);
+
+  /* prepare a message per datagram, each receiving into its own pool
+   * buffer */
+  for (n_alloc = 0; n_alloc < batch; n_alloc++) {
+    bufs[n_alloc] = NULL;
+    ret = bclass->alloc (GST_BASE_SRC_CAST (udpsrc), -1, udpsrc->mtu,
+        &bufs[n_alloc]);
+    if (G_UNLIKELY (ret != GST_FLOW_OK))
+      goto alloc_error;
+
+    if (!gst_buffer_map (bufs[n_alloc], &infos[n_alloc], GST_MAP_READWRITE)) {
+      gst_buffer_unref (bufs[n_alloc]);
+      goto buffer_map_error;
+    }
+
+    ivecs[n_alloc].buffer = infos[n_alloc].data;
+    ivecs[n_alloc].size = infos[n_alloc].size;
+
+    saddrs[n_alloc] = NULL;
+
+    memset (&gmsgs[n_alloc], 0, sizeof (GInputMessage));
+    gmsgs[n_alloc].vectors = &ivecs[n_alloc];
+    gmsgs[n_alloc].num_vectors = 1;
+    if (udpsrc->retrieve_sender_address)
+      gmsgs[n_alloc].address = &saddrs[n_alloc];
+  }
+
+retry:
+  do {
+    gint64 timeout;
+
+    try_again = FALSE;
+
+    if (udpsrc->timeout)
+      timeout = udpsrc->timeout / 1000;
+    else
+      timeout = -1;
+
+    GST_LOG_OBJECT (udpsrc, "doing select, timeout %" G_GINT64_FORMAT, timeout);
+
+    if (!g_socket_condition_timed_wait (udpsrc->used_socket, G_IO_IN | G_IO_PRI,
+            timeout, udpsrc->cancellable, &err)) {
+      if (g_error_matches (err, G_IO_ERROR, G_IO_ERROR_BUSY)
+          || g_error_matches (err, G_IO_ERROR, G_IO_ERROR_CANCELLED)) {
+        goto stopped;
+      } else if (g_error_matches (err, G_IO_ERROR, G_IO_ERROR_TIMED_OUT)) {
+        g_clear_error (&err);
+        /* timeout, post element message */
+        gst_element_post_message (GST_ELEMENT_CAST (udpsrc),
+            gst_message_new_element (GST_OBJECT_CAST (udpsrc),
+                gst_structure_new ("GstUDPSrcTimeout",
+                    "timeout", G_TYPE_UINT64, udpsrc->timeout, NULL)));
+      } else {
+        goto select_error;
+      }
+
+      try_again = TRUE;
+    }
+  } while (G_UNLIKELY (try_again));
+
+  /* receive as many pending datagrams as fit in the batch with a single
+   * syscall (recvmmsg) */
+  res = g_socket_receive_messages (udpsrc->used_socket, gmsgs, batch,
+      G_SOCKET_MSG_NONE, udpsrc->cancellable, &err);
+
+  if (G_UNLIKELY (res < 0)) {
+    /* G_IO_ERROR_HOST_UNREACHABLE for a UDP socket means that a packet sent
+     * with udpsink generated a "port unreachable" ICMP response. We ignore
+     * that and try again.
+     * On Windows we get G_IO_ERROR_CONNECTION_CLOSED instead */
+    if (g_error_matches (err, G_IO_ERROR, G_IO_ERROR_HOST_UNREACHABLE) ||
+        g_error_matches (err, G_IO_ERROR, G_IO_ERROR_CONNECTION_CLOSED)) {
+      g_clear_error (&err);
+      goto retry;
+    }
+    goto receive_error;
+  }
+
+  if (G_UNLIKELY (res == 0))
+    goto retry;
+
+  /* the kernel is done writing, unmap everything */
+  for (i = 0; i < batch; i++)
+    gst_buffer_unmap (bufs[i], &infos[i]);
+
+  /* release the buffers we prepared but didn't fill */
+  for (i = res; i < batch; i++)
+    gst_buffer_unref (bufs[i]);
+
+  offset = udpsrc->skip_first_bytes;
+
+  for (i = 0; i < (guint) res; i++) {
+    gsize size = gmsgs[i].bytes_received;
+
+    if (G_UNLIKELY (offset > 0 && size < offset))
+      goto skip_error;
+
+    gst_buffer_resize (bufs[i], offset, size - offset);
+
+    /* use buffer metadata so receivers can also track the address */
+    if (saddrs[i]) {
+      gst_buffer_add_net_address_meta (bufs[i], saddrs[i]);
+      g_object_unref (saddrs[i]);
+      saddrs[i] = NULL;
+    }
+
+    GST_LOG_OBJECT (udpsrc, "read packet of %" G_GSIZE_FORMAT " bytes", size);
+  }
+
+  if (res == 1) {
+    /* don't bother with a list for a single packet */
+    *outbuf = bufs[0];
+    return GST_FLOW_OK;
+  }
+
+  GST_LOG_OBJECT (udpsrc, "read %d packets", res);
+
+  list = gst_buffer_list_new_sized (res);
+  for (i = 0; i < (guint) res; i++)
+    gst_buffer_list_add (list, bufs[i]);
+
+  gst_base_src_submit_buffer_list (GST_BASE_SRC_CAST (udpsrc), list);
+  *outbuf = NULL;
+
+  return GST_FLOW_OK;
+
+  /* ERRORS */
+alloc_error:
+  {
+    for (i = 0; i < n_alloc; i++) {
+      gst_buffer_unmap (bufs[i], &infos[i]);
+      gst_buffer_unref (bufs[i]);
+    }
+    return ret;
+  }
+buffer_map_error:
+  {
+    for (i = 0; i < n_alloc; i++) {
+      gst_buffer_unmap (bufs[i], &infos[i]);
+      gst_buffer_unref (bufs[i]);
+    }
+    GST_ELEMENT_ERROR (udpsrc, RESOURCE, READ, (NULL),
+        ("Failed to map memory"));
+    return GST_FLOW_ERROR;
+  }
+select_error:
+  {
+    for (i = 0; i < batch; i++) {
+      gst_buffer_unmap (bufs[i], &infos[i]);
+      gst_buffer_unref (bufs[i]);
+    }
+    GST_ELEMENT_ERROR (udpsrc, RESOURCE, READ, (NULL),
+        ("select error: %s", err->message));
+    g_clear_error (&err);
+    return GST_FLOW_ERROR;
+  }
+stopped:
+  {
+    for (i = 0; i < batch; i++) {
+      gst_buffer_unmap (bufs[i], &infos[i]);
+      gst_buffer_unref (bufs[i]);
+    }
+    GST_DEBUG ("stop called");
+    g_clear_error (&err);
+    return GST_FLOW_FLUSHING;
+  }
+receive_error:
+  {
+    for (i = 0; i < batch; i++) {
+      gst_buffer_unmap (bufs[i], &infos[i]);
+      gst_buffer_unref (bufs[i]);
+    }
+    if (g_error_matches (err, G_IO_ERROR, G_IO_ERROR_BUSY) ||
+        g_error_matches (err, G_IO_ERROR, G_IO_ERROR_CANCELLED)) {
+      g_clear_error (&err);
+      return GST_FLOW_FLUSHING;
+    } else {
+      GST_ELEMENT_ERROR (udpsrc, RESOURCE, READ, (NULL),
+          ("receive error %d: %s", res, err->message));
+      g_clear_error (&err);
+      return GST_FLOW_ERROR;
+    }
+  }
+skip_error:
+  {
+    guint j;
+
+    for (j = i; j < (guint) res; j++) {
+      gst_buffer_unref (bufs[j]);
+      g_clear_object (&saddrs[j]);
+    }
+    for (j = 0; j < i; j++)
+      gst_buffer_unref (bufs[j]);
+    GST_ELEMENT_ERROR (udpsrc, STREAM, DECODE, (NULL),
+        ("UDP buffer to small to skip header"));
+    return GST_FLOW_ERROR;
+  }
+}
+
 static GstFlowReturn
 gst_udpsrc_fill (GstPushSrc * psrc, GstBuffer * outbuf)
 {
@@ -1374,6 +1665,9 @@ gst_udpsrc_set_property (GObject * object, guint prop_id, const GValue * value,
     case PROP_SOCKET_TIMESTAMP:
       udpsrc->socket_timestamp_mode = g_value_get_enum (value);
       break;
+    case PROP_BATCH_SIZE:
+      udpsrc->batch_size = g_value_get_uint (value);
+      break;
     default:
       break;
   }
@@ -1440,6 +1734,9 @@ gst_udpsrc_get_property (GObject * object, guint prop_id, GValue * value,
     case PROP_SOCKET_TIMESTAMP:
       g_value_set_enum (value, udpsrc->socket_timestamp_mode);
       break;
+    case PROP_BATCH_SIZE:
+      g_value_set_uint (value, udpsrc->batch_size);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
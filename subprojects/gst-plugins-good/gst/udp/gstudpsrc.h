@@ -93,6 +93,9 @@ struct _GstUDPSrc {
   /* Initial size of buffers in the buffer pool */
   guint mtu;
 
+  /* Max number of datagrams to receive per syscall */
+  guint batch_size;
+
   /* Extra memory for buffers with a size superior to max_packet_size */
   GstMemory *extra_mem;
 
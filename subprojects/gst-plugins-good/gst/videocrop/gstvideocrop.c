@@ -469,11 +469,14 @@ static gboolean
 gst_video_crop_decide_allocation (GstBaseTransform * trans, GstQuery * query)
 {
   GstVideoCrop *crop = GST_VIDEO_CROP (trans);
-  gboolean use_crop_meta;
+  gboolean use_crop_meta, use_video_meta;
 
+  use_video_meta =
+      gst_query_find_allocation_meta (query, GST_VIDEO_META_API_TYPE, NULL);
   use_crop_meta = (gst_query_find_allocation_meta (query,
-          GST_VIDEO_CROP_META_API_TYPE, NULL) &&
-      gst_query_find_allocation_meta (query, GST_VIDEO_META_API_TYPE, NULL));
+          GST_VIDEO_CROP_META_API_TYPE, NULL) && use_video_meta);
+
+  crop->rewrite_video_meta = FALSE;
 
   if ((crop->crop_left | crop->crop_right | crop->crop_top | crop->
           crop_bottom) == 0) {
@@ -484,6 +487,19 @@ gst_video_crop_decide_allocation (GstBaseTransform * trans, GstQuery * query)
     GST_INFO_OBJECT (crop, "we are doing in-place transform using crop meta");
     gst_base_transform_set_passthrough (GST_BASE_TRANSFORM (crop), FALSE);
     gst_base_transform_set_in_place (GST_BASE_TRANSFORM (crop), TRUE);
+  } else if (use_video_meta && crop->raw_caps
+      && !(crop->packing == VIDEO_CROP_PIXEL_FORMAT_PACKED_COMPLEX
+          && (crop->crop_left & 1))) {
+    /* downstream can handle arbitrary plane offsets and strides, so the
+     * crop can be done by re-pointing the video meta into the original
+     * frame without copying any pixels. Odd left crops on horizontally
+     * sub-sampled packed formats still need the copy path, which shifts
+     * the luma samples within the macropixels. */
+    GST_INFO_OBJECT (crop,
+        "we are doing in-place transform by rewriting the video meta");
+    gst_base_transform_set_passthrough (GST_BASE_TRANSFORM (crop), FALSE);
+    gst_base_transform_set_in_place (GST_BASE_TRANSFORM (crop), TRUE);
+    crop->rewrite_video_meta = TRUE;
   } else if (crop->raw_caps) {
     GST_INFO_OBJECT (crop, "we are not using passthrough");
     gst_base_transform_set_passthrough (GST_BASE_TRANSFORM (crop), FALSE);
@@ -530,6 +546,43 @@ gst_video_crop_before_transform (GstBaseTransform * trans, GstBuffer * in)
     gst_object_sync_values (GST_OBJECT (video_crop), stream_time);
 }
 
+/* Move the video meta's plane offsets to the top-left corner of the
+ * cropped region, using the same rounding on sub-sampled planes as the
+ * copy paths do */
+static void
+gst_video_crop_rewrite_video_meta (GstVideoCrop * vcrop,
+    GstVideoMeta * video_meta, gint x, gint y)
+{
+  const GstVideoFormatInfo *format_info = vcrop->in_info.finfo;
+  gint crop_left = vcrop->crop_left + x;
+  gint crop_top = vcrop->crop_top + y;
+  guint p;
+
+  /* stay at the start of a macro-pixel for packed 4:2:2 */
+  if (vcrop->packing == VIDEO_CROP_PIXEL_FORMAT_PACKED_COMPLEX)
+    crop_left = ROUND_DOWN_2 (crop_left);
+
+  for (p = 0; p < video_meta->n_planes; ++p) {
+    guint sub_w_factor, sub_h_factor;
+    guint subsampled_crop_left, subsampled_crop_top;
+
+    sub_w_factor = 1 << GST_VIDEO_FORMAT_INFO_W_SUB (format_info, p);
+    sub_h_factor = 1 << GST_VIDEO_FORMAT_INFO_H_SUB (format_info, p);
+    subsampled_crop_left = GST_ROUND_DOWN_N ((guint) crop_left, sub_w_factor);
+    subsampled_crop_top = GST_ROUND_DOWN_N ((guint) crop_top, sub_h_factor);
+
+    video_meta->offset[p] +=
+        (gsize) GST_VIDEO_FORMAT_INFO_SCALE_HEIGHT (format_info, p,
+        subsampled_crop_top) * video_meta->stride[p] +
+        GST_VIDEO_FORMAT_INFO_SCALE_WIDTH (format_info, p,
+        subsampled_crop_left) * GST_VIDEO_INFO_COMP_PSTRIDE (&vcrop->in_info,
+        p);
+  }
+
+  video_meta->width = GST_VIDEO_INFO_WIDTH (&vcrop->out_info);
+  video_meta->height = GST_VIDEO_INFO_HEIGHT (&vcrop->out_info);
+}
+
 static GstFlowReturn
 gst_video_crop_transform_ip (GstBaseTransform * trans, GstBuffer * buf)
 {
@@ -558,6 +611,29 @@ gst_video_crop_transform_ip (GstBaseTransform * trans, GstBuffer * buf)
   }
 
   crop_meta = gst_buffer_get_video_crop_meta (buf);
+
+  if (vcrop->rewrite_video_meta) {
+    gint x = 0, y = 0;
+
+    /* fold any crop requested by upstream into the offsets too, since
+     * downstream does not handle the crop meta */
+    if (crop_meta) {
+      x = crop_meta->x;
+      y = crop_meta->y;
+    }
+
+    gst_video_crop_rewrite_video_meta (vcrop, video_meta, x, y);
+
+    if (crop_meta) {
+      crop_meta->x = 0;
+      crop_meta->y = 0;
+      crop_meta->width = video_meta->width;
+      crop_meta->height = video_meta->height;
+    }
+
+    return GST_FLOW_OK;
+  }
+
   if (!crop_meta)
     crop_meta = gst_buffer_add_video_crop_meta (buf);
 
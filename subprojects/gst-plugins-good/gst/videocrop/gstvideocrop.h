@@ -82,6 +82,10 @@ struct _GstVideoCrop
   gint macro_y_off;
 
   gboolean raw_caps;
+
+  /* downstream supports video meta but no crop meta: crop in place by
+   * rewriting the plane offsets instead of copying */
+  gboolean rewrite_video_meta;
 };
 
 struct _GstVideoCropClass
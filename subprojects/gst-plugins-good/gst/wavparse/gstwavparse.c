@@ -94,11 +94,13 @@ static void gst_wavparse_get_property (GObject * object, guint prop_id,
     GValue * value, GParamSpec * pspec);
 
 #define DEFAULT_IGNORE_LENGTH FALSE
+#define DEFAULT_BLOCKSIZE 0
 
 enum
 {
   PROP_0,
   PROP_IGNORE_LENGTH,
+  PROP_BLOCKSIZE,
 };
 
 static GstStaticPadTemplate sink_template_factory =
@@ -180,6 +182,24 @@ gst_wavparse_class_init (GstWavParseClass * klass)
           DEFAULT_IGNORE_LENGTH, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS)
       );
 
+  /**
+   * GstWavParse:blocksize:
+   *
+   * Size in bytes of the data buffers to output, 0 means to pick a
+   * reasonable size automatically (about 40 milliseconds of audio).
+   * Non-realtime workloads such as file-to-file transcoding can set this
+   * to several megabytes so that they are bound by I/O rather than by
+   * the per-buffer overhead. The value is rounded down to a whole number
+   * of sample frames.
+   *
+   * Since: 1.22
+   */
+  g_object_class_install_property (object_class, PROP_BLOCKSIZE,
+      g_param_spec_uint ("blocksize", "Block size",
+          "Size in bytes of output buffers (0 = automatic)",
+          0, G_MAXUINT, DEFAULT_BLOCKSIZE,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   gstelement_class->change_state = gst_wavparse_change_state;
   gstelement_class->send_event = gst_wavparse_send_event;
 
@@ -1714,15 +1734,21 @@ gst_wavparse_stream_headers (GstWavParse * wav)
 
   wav->state = GST_WAVPARSE_DATA;
 
-  /* determine reasonable max buffer size,
-   * that is, buffers not too small either size or time wise
-   * so we do not end up with too many of them */
-  /* var abuse */
-  if (gst_wavparse_time_to_bytepos (wav, 40 * GST_MSECOND, &upstream_size))
-    wav->max_buf_size = upstream_size;
-  else
-    wav->max_buf_size = 0;
-  wav->max_buf_size = MAX (wav->max_buf_size, MAX_BUFFER_SIZE);
+  if (wav->blocksize > 0) {
+    /* user-configured buffer size, e.g. for non-realtime bulk processing;
+     * never go below one sample frame */
+    wav->max_buf_size = MAX (wav->blocksize, wav->blockalign);
+  } else {
+    /* determine reasonable max buffer size,
+     * that is, buffers not too small either size or time wise
+     * so we do not end up with too many of them */
+    /* var abuse */
+    if (gst_wavparse_time_to_bytepos (wav, 40 * GST_MSECOND, &upstream_size))
+      wav->max_buf_size = upstream_size;
+    else
+      wav->max_buf_size = 0;
+    wav->max_buf_size = MAX (wav->max_buf_size, MAX_BUFFER_SIZE);
+  }
   if (wav->blockalign > 0)
     wav->max_buf_size -= (wav->max_buf_size % wav->blockalign);
 
@@ -2965,6 +2991,9 @@ gst_wavparse_set_property (GObject * object, guint prop_id,
     case PROP_IGNORE_LENGTH:
       self->ignore_length = g_value_get_boolean (value);
       break;
+    case PROP_BLOCKSIZE:
+      self->blocksize = g_value_get_uint (value);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (self, prop_id, pspec);
   }
@@ -2984,6 +3013,9 @@ gst_wavparse_get_property (GObject * object, guint prop_id,
     case PROP_IGNORE_LENGTH:
       g_value_set_boolean (value, self->ignore_length);
       break;
+    case PROP_BLOCKSIZE:
+      g_value_set_uint (value, self->blocksize);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (self, prop_id, pspec);
   }
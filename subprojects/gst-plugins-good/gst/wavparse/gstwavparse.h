@@ -122,6 +122,7 @@ struct _GstWavParse {
   gboolean discont;
 
   gboolean ignore_length;
+  guint blocksize;
 
   /* Size of the data as written in the chunk size */
   guint32 chunk_size;
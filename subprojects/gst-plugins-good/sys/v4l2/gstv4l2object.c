@@ -510,6 +510,7 @@ gst_v4l2_object_new (GstElement * element,
   v4l2object->video_fd = -1;
   v4l2object->active = FALSE;
   v4l2object->videodev = g_strdup (default_device);
+  v4l2object->dmabuf_supported = -1;
 
   v4l2object->norms = NULL;
   v4l2object->channels = NULL;
@@ -3070,27 +3071,28 @@ error:
 static gboolean
 gst_v4l2_object_is_dmabuf_supported (GstV4l2Object * v4l2object)
 {
-  gboolean ret = TRUE;
-  struct v4l2_exportbuffer expbuf = {
-    .type = v4l2object->type,
-    .index = -1,
-    .plane = -1,
-    .flags = O_CLOEXEC | O_RDWR,
-  };
-
   if (v4l2object->fmtdesc &&
       v4l2object->fmtdesc->flags & V4L2_FMT_FLAG_EMULATED) {
     GST_WARNING_OBJECT (v4l2object->dbg_obj,
         "libv4l2 converter detected, disabling DMABuf");
-    ret = FALSE;
+    return FALSE;
   }
 
-  /* Expected to fail, but ENOTTY tells us that it is not implemented. */
-  v4l2object->ioctl (v4l2object->video_fd, VIDIOC_EXPBUF, &expbuf);
-  if (errno == ENOTTY)
-    ret = FALSE;
+  /* probing is per device, no need to redo it on every renegotiation */
+  if (v4l2object->dmabuf_supported == -1) {
+    struct v4l2_exportbuffer expbuf = {
+      .type = v4l2object->type,
+      .index = -1,
+      .plane = -1,
+      .flags = O_CLOEXEC | O_RDWR,
+    };
 
-  return ret;
+    /* Expected to fail, but ENOTTY tells us that it is not implemented. */
+    v4l2object->ioctl (v4l2object->video_fd, VIDIOC_EXPBUF, &expbuf);
+    v4l2object->dmabuf_supported = (errno != ENOTTY);
+  }
+
+  return v4l2object->dmabuf_supported;
 }
 
 static gboolean
@@ -5203,3 +5205,42 @@ gst_v4l2_object_try_import (GstV4l2Object * obj, GstBuffer * buffer)
   /* for the remaining, only the kernel driver can tell */
   return TRUE;
 }
+
+/* Switch an output device that ended up in MMAP mode through
+ * GST_V4L2_IO_AUTO over to DMABuf importation when the first upstream
+ * buffer turns out to be DMABuf memory with a layout the driver accepts.
+ * Must be called before the pool is activated; once buffers have been
+ * requested the memory type cannot change anymore. */
+gboolean
+gst_v4l2_object_try_auto_dmabuf_import (GstV4l2Object * obj,
+    GstBuffer * buffer)
+{
+  GstV4l2IOMode old_mode = obj->mode;
+
+  if (obj->req_mode != GST_V4L2_IO_AUTO || obj->mode != GST_V4L2_IO_MMAP)
+    return FALSE;
+
+  if (!V4L2_TYPE_IS_OUTPUT (obj->type))
+    return FALSE;
+
+  if (!obj->pool || gst_buffer_pool_is_active (obj->pool))
+    return FALSE;
+
+  if (!GST_V4L2_ALLOCATOR_CAN_REQUEST (GST_V4L2_BUFFER_POOL (obj->pool)->
+          vallocator, DMABUF)) {
+    GST_DEBUG_OBJECT (obj->dbg_obj, "Driver does not support DMABuf import");
+    return FALSE;
+  }
+
+  /* let gst_v4l2_object_try_import() run its layout and memory checks as
+   * if importation had been requested */
+  obj->mode = GST_V4L2_IO_DMABUF_IMPORT;
+  if (!gst_v4l2_object_try_import (obj, buffer)) {
+    obj->mode = old_mode;
+    return FALSE;
+  }
+
+  GST_INFO_OBJECT (obj->dbg_obj,
+      "Importing upstream DMABuf instead of copying into MMAP buffers");
+  return TRUE;
+}
@@ -147,6 +147,8 @@ struct _GstV4l2Object {
   /* Features */
   gboolean need_video_meta;
   gboolean has_alpha_component;
+  /* cached result of the VIDIOC_EXPBUF probe, -1 until probed */
+  gint dmabuf_supported;
 
   /* only used if the device supports MPLANE
    * nb planes is meaning of v4l2 planes
@@ -289,6 +291,7 @@ GstCaps*     gst_v4l2_object_get_codec_caps (void);
 gboolean     gst_v4l2_object_set_format  (GstV4l2Object * v4l2object, GstCaps * caps, GstV4l2Error * error);
 gboolean     gst_v4l2_object_try_format  (GstV4l2Object * v4l2object, GstCaps * caps, GstV4l2Error * error);
 gboolean     gst_v4l2_object_try_import  (GstV4l2Object * v4l2object, GstBuffer * buffer);
+gboolean     gst_v4l2_object_try_auto_dmabuf_import (GstV4l2Object * obj, GstBuffer * buffer);
 
 gboolean     gst_v4l2_object_caps_equal       (GstV4l2Object * v4l2object, GstCaps * caps);
 gboolean     gst_v4l2_object_caps_is_subset   (GstV4l2Object * v4l2object, GstCaps * caps);
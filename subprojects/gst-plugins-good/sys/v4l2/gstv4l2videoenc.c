@@ -765,6 +765,13 @@ gst_v4l2_video_enc_handle_frame (GstVideoEncoder * encoder,
       guint min = MAX (self->v4l2output->min_buffers,
           GST_V4L2_MIN_BUFFERS (self->v4l2output));
 
+      /* If upstream negotiated DMABuf (e.g. v4l2src on the same SoC),
+       * import those buffers instead of copying them into our own MMAP
+       * buffers; the driver then cycles the exact upstream buffers. */
+      if (frame->input_buffer)
+        gst_v4l2_object_try_auto_dmabuf_import (self->v4l2output,
+            frame->input_buffer);
+
       gst_buffer_pool_config_set_params (config, self->input_state->caps,
           self->v4l2output->info.size, min, min);
 
@@ -718,6 +718,7 @@ gst_v4l2_close (GstV4l2Object * v4l2object)
   /* close device */
   v4l2object->close (v4l2object->video_fd);
   v4l2object->video_fd = -1;
+  v4l2object->dmabuf_supported = -1;
 
   /* empty lists */
   gst_v4l2_empty_lists (v4l2object);
@@ -557,6 +557,29 @@ gst_ximage_src_ximage_get (GstXImageSrc * ximagesrc)
       }
     } while (XPending (ximagesrc->xcontext->disp));
 
+    if (!have_damage) {
+      gboolean need_pointer = FALSE;
+
+#ifdef HAVE_XFIXES
+      /* pointer movement does not generate damage, so a pointer that is
+       * being composited (or was composited into the last frame) still
+       * needs a fresh frame to draw into */
+      need_pointer = ximagesrc->cursor_image != NULL ||
+          (ximagesrc->show_pointer && ximagesrc->have_xfixes &&
+          gst_ximage_is_pointer_in_region (ximagesrc));
+#endif
+
+      /* only hand out the previous frame again when downstream has dropped
+       * all its references to it; the caller re-timestamps the buffer, which
+       * must not happen behind the back of anyone still holding it */
+      if (!need_pointer && gst_buffer_is_writable (ximagesrc->last_ximage)) {
+        GST_LOG_OBJECT (ximagesrc,
+            "no damage and no pointer to composite, reusing last frame");
+        gst_buffer_unref (ximage);
+        return gst_buffer_ref (ximagesrc->last_ximage);
+      }
+    }
+
     if (have_damage) {
       XRectangle *rects;
       int nrects;
@@ -305,6 +305,51 @@ GST_START_TEST (test_timer_queue_timer_offset)
 
 GST_END_TEST;
 
+GST_START_TEST (test_timer_queue_insert_from_closest_end)
+{
+  RtpTimerQueue *queue = rtp_timer_queue_new ();
+  RtpTimer *timer, *next, *prev;
+  guint16 seqnum;
+
+  /* fill the queue with lost timers with large timeouts, like an RTX
+   * session under packet loss would */
+  for (seqnum = 0; seqnum < 100; seqnum++)
+    rtp_timer_queue_set_lost (queue, seqnum,
+        GST_SECOND + seqnum * GST_MSECOND, GST_MSECOND, 0);
+
+  /* an expected timer with a timeout below all lost timers must be
+   * inserted at the head, scanning from the closest end */
+  rtp_timer_queue_set_expected (queue, 100, GST_MSECOND, 0, GST_MSECOND);
+
+  timer = rtp_timer_queue_find (queue, 100);
+  fail_if (timer == NULL);
+  fail_unless (timer == rtp_timer_queue_peek_earliest (queue));
+  next = (RtpTimer *) timer->list.next;
+  prev = (RtpTimer *) timer->list.prev;
+  fail_unless (prev == NULL);
+  fail_if (next == NULL);
+  fail_unless_equals_int (0, next->seqnum);
+
+  /* a timeout in between still ends up correctly sorted */
+  rtp_timer_queue_set_expected (queue, 101, GST_SECOND + 50 * GST_MSECOND,
+      0, GST_MSECOND);
+
+  timer = rtp_timer_queue_find (queue, 101);
+  fail_if (timer == NULL);
+  next = (RtpTimer *) timer->list.next;
+  prev = (RtpTimer *) timer->list.prev;
+  fail_if (prev == NULL);
+  fail_if (next == NULL);
+  fail_unless_equals_int (50, prev->seqnum);
+  fail_unless_equals_int (51, next->seqnum);
+
+  fail_unless_equals_int (102, rtp_timer_queue_length (queue));
+
+  g_object_unref (queue);
+}
+
+GST_END_TEST;
+
 static Suite *
 rtptimerqueue_suite (void)
 {
@@ -319,6 +364,7 @@ rtptimerqueue_suite (void)
   tcase_add_test (tc_chain, test_timer_queue_update_timer_seqnum);
   tcase_add_test (tc_chain, test_timer_queue_dup_timer);
   tcase_add_test (tc_chain, test_timer_queue_timer_offset);
+  tcase_add_test (tc_chain, test_timer_queue_insert_from_closest_end);
 
   return s;
 }
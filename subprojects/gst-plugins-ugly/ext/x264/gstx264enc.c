@@ -364,6 +364,7 @@ enum
   ARG_THREADS,
   ARG_SLICED_THREADS,
   ARG_SYNC_LOOKAHEAD,
+  ARG_LOOKAHEAD_THREADS,
   ARG_PASS,
   ARG_QUANTIZER,
   ARG_MULTIPASS_CACHE_FILE,
@@ -432,6 +433,7 @@ enum
 #define ARG_INTERLACED_DEFAULT         FALSE
 #define ARG_SLICED_THREADS_DEFAULT     FALSE
 #define ARG_SYNC_LOOKAHEAD_DEFAULT     -1
+#define ARG_LOOKAHEAD_THREADS_DEFAULT  0        /* 0 means 'auto' */
 #define ARG_RC_MB_TREE_DEFAULT         TRUE
 #define ARG_RC_LOOKAHEAD_DEFAULT       40
 #define ARG_INTRA_REFRESH_DEFAULT      FALSE
@@ -1038,6 +1040,20 @@ gst_x264_enc_class_init (GstX264EncClass * klass)
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
   g_string_append_printf (x264enc_defaults, ":sync-lookahead=%d",
       ARG_SYNC_LOOKAHEAD_DEFAULT);
+  /**
+   * GstX264Enc:lookahead-threads:
+   *
+   * Number of threads used for the frametype lookahead (0 for automatic).
+   * With sliced-threads the otherwise serial lookahead is the scaling
+   * bottleneck on machines with many cores.
+   *
+   * Since: 1.22
+   */
+  g_object_class_install_property (gobject_class, ARG_LOOKAHEAD_THREADS,
+      g_param_spec_uint ("lookahead-threads", "Lookahead Threads",
+          "Number of threads used for the frametype lookahead "
+          "(0 for automatic)", 0, G_MAXINT, ARG_LOOKAHEAD_THREADS_DEFAULT,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
   g_object_class_install_property (gobject_class, ARG_MULTIPASS_CACHE_FILE,
       g_param_spec_string ("multipass-cache-file", "Multipass Cache File",
           "Filename for multipass cache file",
@@ -1288,6 +1304,7 @@ gst_x264_enc_init (GstX264Enc * encoder)
   encoder->threads = ARG_THREADS_DEFAULT;
   encoder->sliced_threads = ARG_SLICED_THREADS_DEFAULT;
   encoder->sync_lookahead = ARG_SYNC_LOOKAHEAD_DEFAULT;
+  encoder->lookahead_threads = ARG_LOOKAHEAD_THREADS_DEFAULT;
   encoder->pass = ARG_PASS_DEFAULT;
   encoder->quantizer = ARG_QUANTIZER_DEFAULT;
   encoder->mp_cache_file = g_strdup (ARG_MULTIPASS_CACHE_FILE_DEFAULT);
@@ -2717,6 +2734,11 @@ gst_x264_enc_set_property (GObject * object, guint prop_id,
       g_string_append_printf (encoder->option_string, ":sync-lookahead=%d",
           encoder->sync_lookahead);
       break;
+    case ARG_LOOKAHEAD_THREADS:
+      encoder->lookahead_threads = g_value_get_uint (value);
+      g_string_append_printf (encoder->option_string, ":lookahead-threads=%d",
+          encoder->lookahead_threads);
+      break;
     case ARG_MULTIPASS_CACHE_FILE:
       g_free (encoder->mp_cache_file);
       encoder->mp_cache_file = g_value_dup_string (value);
@@ -2889,6 +2911,9 @@ gst_x264_enc_get_property (GObject * object, guint prop_id,
     case ARG_SYNC_LOOKAHEAD:
       g_value_set_int (value, encoder->sync_lookahead);
       break;
+    case ARG_LOOKAHEAD_THREADS:
+      g_value_set_uint (value, encoder->lookahead_threads);
+      break;
     case ARG_PASS:
       g_value_set_enum (value, encoder->pass);
       break;
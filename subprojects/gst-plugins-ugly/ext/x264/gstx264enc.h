@@ -75,6 +75,7 @@ struct _GstX264Enc
   guint threads;
   gboolean sliced_threads;
   gint sync_lookahead;
+  guint lookahead_threads;
   gint pass;
   guint quantizer;
   gchar *mp_cache_file;
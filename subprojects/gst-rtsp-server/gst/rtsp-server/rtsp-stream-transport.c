@@ -932,7 +932,10 @@ gst_rtsp_stream_transport_backlog_pop (GstRTSPStreamTransport * trans,
 
   item = (BackLogItem *) gst_queue_array_pop_head_struct (priv->items);
 
-  priv->first_rtp_timestamp = get_first_backlog_timestamp (trans);
+  /* Popping a non-RTP item cannot change which RTP item comes first,
+   * only rescan the backlog when needed */
+  if (item->is_rtp)
+    priv->first_rtp_timestamp = get_first_backlog_timestamp (trans);
 
   if (buffer)
     *buffer = item->buffer;
@@ -963,9 +966,10 @@ gst_rtsp_stream_transport_backlog_is_empty (GstRTSPStreamTransport * trans)
 void
 gst_rtsp_stream_transport_clear_backlog (GstRTSPStreamTransport * trans)
 {
-  while (!gst_rtsp_stream_transport_backlog_is_empty (trans)) {
-    gst_rtsp_stream_transport_backlog_pop (trans, NULL, NULL, NULL);
-  }
+  GstRTSPStreamTransportPrivate *priv = trans->priv;
+
+  gst_queue_array_clear (priv->items);
+  priv->first_rtp_timestamp = GST_CLOCK_TIME_NONE;
 }
 
 /* Internal API, protects access to the TCP backlog. Safe to
@@ -1316,10 +1316,14 @@ create_and_configure_udpsink (GstRTSPStream * stream, GstElement ** udpsink,
 
   g_object_set (G_OBJECT (*udpsink), "send-duplicates", FALSE, NULL);
 
-  if (is_rtp)
+  if (is_rtp) {
     g_object_set (G_OBJECT (*udpsink), "buffer-size", priv->buffer_size, NULL);
-  else
+  } else {
     g_object_set (G_OBJECT (*udpsink), "sync", FALSE, NULL);
+    /* only the RTP sink's last-sample is used (for RTP-Info), avoid the
+     * per-packet bookkeeping on the RTCP sink */
+    g_object_set (G_OBJECT (*udpsink), "enable-last-sample", FALSE, NULL);
+  }
 
   /* Needs to be async for RECORD streams, otherwise we will never go to
    * PLAYING because the sinks will wait for data while the udpsrc can't
@@ -3632,9 +3636,12 @@ create_sender_part (GstRTSPStream * stream, const GstRTSPTransport * transport)
         g_object_set (priv->appsink[i], "sync", priv->do_rate_control, NULL);
 
       /* we need to set sync and preroll to FALSE for the sink to avoid
-       * deadlock. This is only needed for sink sending RTCP data. */
+       * deadlock. This is only needed for sink sending RTCP data.
+       * The last-sample of the RTCP sink is never queried (only the RTP
+       * one is, for RTP-Info), so don't pay for keeping it around. */
       if (i == 1)
-        g_object_set (priv->appsink[i], "async", FALSE, "sync", FALSE, NULL);
+        g_object_set (priv->appsink[i], "async", FALSE, "sync", FALSE,
+            "enable-last-sample", FALSE, NULL);
 
       gst_app_sink_set_callbacks (GST_APP_SINK_CAST (priv->appsink[i]),
           &sink_cb, stream, NULL);
@@ -4842,6 +4849,7 @@ gst_rtsp_stream_add_transport (GstRTSPStream * stream,
 {
   GstRTSPStreamPrivate *priv;
   gboolean res;
+  gboolean request_keyframe;
 
   g_return_val_if_fail (GST_IS_RTSP_STREAM (stream), FALSE);
   priv = stream->priv;
@@ -4849,12 +4857,25 @@ gst_rtsp_stream_add_transport (GstRTSPStream * stream,
   g_return_val_if_fail (priv->joined_bin != NULL, FALSE);
 
   g_mutex_lock (&priv->lock);
+  /* If other clients already receive this stream it is running mid-GOP,
+   * so ask upstream for a new keyframe to let the new client start
+   * decoding right away instead of waiting for the next natural one */
+  request_keyframe = priv->transports != NULL;
   res = update_transport (stream, trans, TRUE);
   if (res)
     gst_rtsp_stream_transport_set_message_sent_full (trans, on_message_sent,
         stream, NULL);
   g_mutex_unlock (&priv->lock);
 
+  if (res && request_keyframe && priv->srcpad) {
+    GST_DEBUG_OBJECT (stream,
+        "new transport on a running stream, requesting a keyframe");
+    gst_pad_send_event (priv->srcpad,
+        gst_event_new_custom (GST_EVENT_CUSTOM_UPSTREAM,
+            gst_structure_new ("GstForceKeyUnit",
+                "all-headers", G_TYPE_BOOLEAN, TRUE, NULL)));
+  }
+
   return res;
 }
 
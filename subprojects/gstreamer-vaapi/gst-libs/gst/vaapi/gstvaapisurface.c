@@ -945,6 +945,7 @@ gboolean
 gst_vaapi_surface_sync (GstVaapiSurface * surface)
 {
   GstVaapiDisplay *display;
+  GstVaapiSurfaceStatus surface_status;
   VAStatus status;
 
   g_return_val_if_fail (surface != NULL, FALSE);
@@ -953,6 +954,13 @@ gst_vaapi_surface_sync (GstVaapiSurface * surface)
   if (!display)
     return FALSE;
 
+  /* If the surface is already idle, skip the blocking vaSyncSurface() call.
+   * That call is made with the display lock taken and would stall every
+   * other user of this display until the hardware is done */
+  if (gst_vaapi_surface_query_status (surface, &surface_status) &&
+      (surface_status & GST_VAAPI_SURFACE_STATUS_IDLE))
+    return TRUE;
+
   GST_VAAPI_DISPLAY_LOCK (display);
   status = vaSyncSurface (GST_VAAPI_DISPLAY_VADISPLAY (display),
       GST_VAAPI_SURFACE_ID (surface));
@@ -421,6 +421,9 @@ struct _GstTypeFindFactory {
   GstTypeFindFunction           function;
   gchar **                      extensions;
   GstCaps *                     caps;
+  /* serialized caps from the binary registry, parsed into @caps on
+   * first use, see gst_type_find_factory_get_caps() */
+  gchar *                       caps_string;
 
   gpointer                      user_data;
   GDestroyNotify                user_data_notify;
@@ -462,6 +465,9 @@ struct _GstElementFactory {
   GType                 type;                   /* unique GType of element or 0 if not loaded */
 
   gpointer              metadata;
+  /* serialized metadata from the binary registry, deserialized into
+   * @metadata on first access */
+  gchar *               metadata_string;
 
   GList *               staticpadtemplates;     /* GstStaticPadTemplate list */
   guint                 numpadtemplates;
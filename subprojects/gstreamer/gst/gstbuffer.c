@@ -144,6 +144,12 @@ GType _gst_buffer_type = 0;
 
 #define GST_BUFFER_MEM_MAX         16
 
+/* Number of inline meta slots in GstBufferImpl and the size of each one.
+ * 128 bytes holds all of the common metas; larger metas, or metas added
+ * once all slots are taken, fall back to the slice allocator as before. */
+#define GST_BUFFER_META_SLOTS      4
+#define GST_BUFFER_META_SLOT_SIZE  128
+
 #define GST_BUFFER_SLICE_SIZE(b)   (((GstBufferImpl *)(b))->slice_size)
 #define GST_BUFFER_MEM_LEN(b)      (((GstBufferImpl *)(b))->len)
 #define GST_BUFFER_MEM_ARRAY(b)    (((GstBufferImpl *)(b))->mem)
@@ -165,12 +171,105 @@ typedef struct
   /* memory of the buffer when allocated from 1 chunk */
   GstMemory *bufmem;
 
-  /* FIXME, make metadata allocation more efficient by using part of the
-   * GstBufferImpl */
   GstMetaItem *item;
   GstMetaItem *tail_item;
+
+  /* inline storage for the first few metas, so that decorating a buffer
+   * with the typical handful of metas does not allocate. A set bit in
+   * meta_slots_used means the corresponding slot is taken. */
+  guint meta_slots_used;
+  guint64 meta_slab[GST_BUFFER_META_SLOTS][GST_BUFFER_META_SLOT_SIZE / 8];
 } GstBufferImpl;
 
+static inline gpointer
+gst_buffer_meta_item_alloc (GstBuffer * buffer, gsize size)
+{
+  GstBufferImpl *impl = (GstBufferImpl *) buffer;
+
+  if (size <= GST_BUFFER_META_SLOT_SIZE &&
+      impl->meta_slots_used != (1 << GST_BUFFER_META_SLOTS) - 1) {
+    guint i;
+
+    for (i = 0; i < GST_BUFFER_META_SLOTS; i++) {
+      if (!(impl->meta_slots_used & (1 << i))) {
+        impl->meta_slots_used |= (1 << i);
+        return impl->meta_slab[i];
+      }
+    }
+  }
+  return g_slice_alloc (size);
+}
+
+static inline void
+gst_buffer_meta_item_free (GstBuffer * buffer, GstMetaItem * item, gsize size)
+{
+  GstBufferImpl *impl = (GstBufferImpl *) buffer;
+  guint8 *p = (guint8 *) item;
+  guint8 *slab = (guint8 *) impl->meta_slab;
+
+  if (p >= slab && p < slab + sizeof (impl->meta_slab))
+    impl->meta_slots_used &= ~(1 << ((p - slab) / GST_BUFFER_META_SLOT_SIZE));
+  else
+    g_slice_free1 (size, item);
+}
+
+/* Per-thread cache of plain GstBufferImpl allocations. Buffer alloc/free
+ * is one of the hottest paths in a running pipeline; recycling the
+ * fixed-size structure through a small thread-local stack keeps the
+ * common case free of any atomic operations or slice-allocator
+ * magazine locks. Buffers freed on another thread than the one that
+ * allocated them simply land in the freeing thread's cache. */
+#define BUFFER_CACHE_SIZE 16
+
+typedef struct
+{
+  guint len;
+  gpointer items[BUFFER_CACHE_SIZE];
+} GstBufferThreadCache;
+
+static void
+_gst_buffer_thread_cache_free (gpointer data)
+{
+  GstBufferThreadCache *cache = data;
+  guint i;
+
+  for (i = 0; i < cache->len; i++)
+    g_slice_free1 (sizeof (GstBufferImpl), cache->items[i]);
+  g_free (cache);
+}
+
+static GPrivate buffer_thread_cache =
+G_PRIVATE_INIT (_gst_buffer_thread_cache_free);
+
+static inline GstBufferImpl *
+gst_buffer_impl_alloc (void)
+{
+  GstBufferThreadCache *cache = g_private_get (&buffer_thread_cache);
+
+  if (G_LIKELY (cache != NULL && cache->len > 0))
+    return cache->items[--cache->len];
+
+  return g_slice_new (GstBufferImpl);
+}
+
+static inline void
+gst_buffer_impl_release (GstBufferImpl * impl)
+{
+#ifndef USE_POISONING
+  GstBufferThreadCache *cache = g_private_get (&buffer_thread_cache);
+
+  if (G_UNLIKELY (cache == NULL)) {
+    cache = g_new0 (GstBufferThreadCache, 1);
+    g_private_set (&buffer_thread_cache, cache);
+  }
+  if (G_LIKELY (cache->len < BUFFER_CACHE_SIZE)) {
+    cache->items[cache->len++] = impl;
+    return;
+  }
+#endif
+  g_slice_free1 (sizeof (GstBufferImpl), impl);
+}
+
 static gint64 meta_seq;         /* 0 *//* ATOMIC */
 
 /* TODO: use GLib's once https://gitlab.gnome.org/GNOME/glib/issues/1076 lands */
@@ -789,8 +888,8 @@ _gst_buffer_free (GstBuffer * buffer)
       info->free_func (meta, buffer);
 
     next = walk->next;
-    /* and free the slice */
-    g_slice_free1 (ITEM_SIZE (info), walk);
+    /* and free the item */
+    gst_buffer_meta_item_free (buffer, walk, ITEM_SIZE (info));
   }
 
   /* get the size, when unreffing the memory, we could also unref the buffer
@@ -811,7 +910,10 @@ _gst_buffer_free (GstBuffer * buffer)
 #ifdef USE_POISONING
     memset (buffer, 0xff, msize);
 #endif
-    g_slice_free1 (msize, buffer);
+    if (msize == sizeof (GstBufferImpl))
+      gst_buffer_impl_release ((GstBufferImpl *) buffer);
+    else
+      g_slice_free1 (msize, buffer);
   } else {
     gst_memory_unref (GST_BUFFER_BUFMEM (buffer));
   }
@@ -836,6 +938,7 @@ gst_buffer_init (GstBufferImpl * buffer, gsize size)
 
   GST_BUFFER_MEM_LEN (buffer) = 0;
   GST_BUFFER_META (buffer) = NULL;
+  buffer->meta_slots_used = 0;
 }
 
 /**
@@ -850,7 +953,7 @@ gst_buffer_new (void)
 {
   GstBufferImpl *newbuf;
 
-  newbuf = g_slice_new (GstBufferImpl);
+  newbuf = gst_buffer_impl_alloc ();
   GST_CAT_LOG (GST_CAT_BUFFER, "new %p", newbuf);
 
   gst_buffer_init (newbuf, sizeof (GstBufferImpl));
@@ -2300,16 +2403,15 @@ gst_buffer_add_meta (GstBuffer * buffer, const GstMetaInfo * info,
   g_return_val_if_fail (info != NULL, NULL);
   g_return_val_if_fail (gst_buffer_is_writable (buffer), NULL);
 
-  /* create a new slice */
+  /* grab an inline slot or a new slice */
   size = ITEM_SIZE (info);
+  item = gst_buffer_meta_item_alloc (buffer, size);
   /* We warn in gst_meta_register() about metas without
    * init function but let's play safe here and prevent
    * uninitialized memory
    */
   if (!info->init_func)
-    item = g_slice_alloc0 (size);
-  else
-    item = g_slice_alloc (size);
+    memset (item, 0, size);
   result = &item->meta;
   result->info = info;
   result->flags = GST_META_FLAG_NONE;
@@ -2337,7 +2439,7 @@ gst_buffer_add_meta (GstBuffer * buffer, const GstMetaInfo * info,
 
 init_failed:
   {
-    g_slice_free1 (size, item);
+    gst_buffer_meta_item_free (buffer, item, size);
     return NULL;
   }
 }
@@ -2387,8 +2489,8 @@ gst_buffer_remove_meta (GstBuffer * buffer, GstMeta * meta)
       if (info->free_func)
         info->free_func (m, buffer);
 
-      /* and free the slice */
-      g_slice_free1 (ITEM_SIZE (info), walk);
+      /* and free the item */
+      gst_buffer_meta_item_free (buffer, walk, ITEM_SIZE (info));
       break;
     }
     prev = walk;
@@ -2535,8 +2637,8 @@ gst_buffer_foreach_meta (GstBuffer * buffer, GstBufferForeachMetaFunc func,
       if (info->free_func)
         info->free_func (m, buffer);
 
-      /* and free the slice */
-      g_slice_free1 (ITEM_SIZE (info), walk);
+      /* and free the item */
+      gst_buffer_meta_item_free (buffer, walk, ITEM_SIZE (info));
     } else {
       prev = walk;
     }
@@ -1392,6 +1392,143 @@ gst_buffer_pool_release_buffer (GstBufferPool * pool, GstBuffer * buffer)
   gst_object_unref (pool);
 }
 
+/**
+ * gst_buffer_pool_acquire_buffers:
+ * @pool: a #GstBufferPool
+ * @buffers: (array length=n_buffers) (out): an array to store #GstBuffer
+ *     pointers into
+ * @n_buffers: the number of buffers to acquire
+ * @params: (transfer none) (allow-none): parameters.
+ *
+ * Acquires @n_buffers buffers from @pool in one call, amortizing the
+ * per-acquisition bookkeeping over the whole batch. This is cheaper than
+ * calling gst_buffer_pool_acquire_buffer() in a loop when multiple threads
+ * contend for the same pool, e.g. when an encoder acquires a group of
+ * frames at once.
+ *
+ * When this function does not return %GST_FLOW_OK, any buffers acquired so
+ * far have been returned to the pool and all entries of @buffers are set to
+ * %NULL.
+ *
+ * Returns: a #GstFlowReturn such as %GST_FLOW_FLUSHING when the pool is
+ * inactive.
+ *
+ * Since: 1.22
+ */
+GstFlowReturn
+gst_buffer_pool_acquire_buffers (GstBufferPool * pool, GstBuffer ** buffers,
+    guint n_buffers, GstBufferPoolAcquireParams * params)
+{
+  GstBufferPoolClass *pclass;
+  GstFlowReturn result = GST_FLOW_OK;
+  guint i;
+
+  g_return_val_if_fail (GST_IS_BUFFER_POOL (pool), GST_FLOW_ERROR);
+  g_return_val_if_fail (buffers != NULL, GST_FLOW_ERROR);
+  g_return_val_if_fail (n_buffers > 0, GST_FLOW_ERROR);
+
+  pclass = GST_BUFFER_POOL_GET_CLASS (pool);
+
+  if (G_UNLIKELY (!pclass->acquire_buffer))
+    return GST_FLOW_NOT_SUPPORTED;
+
+  /* assume the whole batch will be outstanding so that a concurrent
+   * set_active doesn't clear the buffers, one atomic for the batch */
+  g_atomic_int_add (&pool->priv->outstanding, n_buffers);
+
+  for (i = 0; i < n_buffers; i++) {
+    result = pclass->acquire_buffer (pool, &buffers[i], params);
+    if (G_UNLIKELY (result != GST_FLOW_OK))
+      break;
+
+    buffers[i]->pool = gst_object_ref (pool);
+  }
+
+  if (G_UNLIKELY (result != GST_FLOW_OK)) {
+    guint acquired = i;
+
+    /* return the partial batch, the unref releases them to the pool */
+    for (i = 0; i < acquired; i++) {
+      gst_buffer_unref (buffers[i]);
+      buffers[i] = NULL;
+    }
+    /* correct the outstanding count for the buffers we did not get; this
+     * must run the usual zero-transition handling */
+    for (i = acquired; i < n_buffers; i++) {
+      buffers[i] = NULL;
+      dec_outstanding (pool);
+    }
+  }
+
+  return result;
+}
+
+/**
+ * gst_buffer_pool_release_buffers:
+ * @pool: a #GstBufferPool
+ * @buffers: (array length=n_buffers) (transfer full): an array of #GstBuffer
+ * @n_buffers: the number of buffers to release
+ *
+ * Releases @n_buffers buffers to @pool in one call, the batched counterpart
+ * of gst_buffer_pool_release_buffer(). Buffers that were not acquired from
+ * @pool are skipped.
+ *
+ * Since: 1.22
+ */
+void
+gst_buffer_pool_release_buffers (GstBufferPool * pool, GstBuffer ** buffers,
+    guint n_buffers)
+{
+  GstBufferPoolClass *pclass;
+  guint i, released = 0;
+
+  g_return_if_fail (GST_IS_BUFFER_POOL (pool));
+  g_return_if_fail (buffers != NULL);
+
+  pclass = GST_BUFFER_POOL_GET_CLASS (pool);
+
+  for (i = 0; i < n_buffers; i++) {
+    GstBuffer *buffer = buffers[i];
+
+    /* check that the buffer is ours, all buffers returned to the pool have the
+     * pool member set to NULL and the pool refcount decreased */
+    if (!g_atomic_pointer_compare_and_exchange (&buffer->pool, pool, NULL))
+      continue;
+
+    if (G_LIKELY (pclass->reset_buffer))
+      pclass->reset_buffer (pool, buffer);
+
+    if (G_LIKELY (pclass->release_buffer))
+      pclass->release_buffer (pool, buffer);
+
+    released++;
+  }
+
+  if (released == 0)
+    return;
+
+  /* one atomic for the whole batch; same zero-transition handling as
+   * dec_outstanding() */
+  if (g_atomic_int_add (&pool->priv->outstanding, -released) ==
+      (gint) released) {
+    /* all buffers are returned to the pool, see if we need to free them */
+    if (GST_BUFFER_POOL_IS_FLUSHING (pool)) {
+      /* take the lock so that set_active is not run concurrently */
+      GST_BUFFER_POOL_LOCK (pool);
+      /* now that we have the lock, check if we have been de-activated with
+       * outstanding buffers */
+      if (!pool->priv->active)
+        do_stop (pool);
+
+      GST_BUFFER_POOL_UNLOCK (pool);
+    }
+  }
+
+  /* drop the refcounts that the buffers had to us */
+  for (i = 0; i < released; i++)
+    gst_object_unref (pool);
+}
+
 /**
  * gst_buffer_pool_set_flushing:
  * @pool: a #GstBufferPool
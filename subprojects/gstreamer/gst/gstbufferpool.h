@@ -345,6 +345,15 @@ GstFlowReturn    gst_buffer_pool_acquire_buffer  (GstBufferPool *pool, GstBuffer
 GST_API
 void             gst_buffer_pool_release_buffer  (GstBufferPool *pool, GstBuffer *buffer);
 
+GST_API
+GstFlowReturn    gst_buffer_pool_acquire_buffers (GstBufferPool *pool, GstBuffer **buffers,
+                                                  guint n_buffers,
+                                                  GstBufferPoolAcquireParams *params);
+
+GST_API
+void             gst_buffer_pool_release_buffers (GstBufferPool *pool, GstBuffer **buffers,
+                                                  guint n_buffers);
+
 G_END_DECLS
 
 #endif /* __GST_BUFFER_POOL_H__ */
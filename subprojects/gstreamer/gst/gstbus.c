@@ -152,6 +152,13 @@ struct _GstBusPrivate
   gboolean enable_async;
   GstPoll *poll;
   GPollFD pollfd;
+
+  /* set to 1 (atomically) while the control fd carries an unconsumed wakeup
+   * token. Posting threads only write to the control fd on a 0 -> 1
+   * transition, so a burst of messages causes a single wakeup syscall
+   * instead of one per message. The reader clears it again once it finds
+   * the queue empty. */
+  gint poll_pending;
 };
 
 #define gst_bus_parent_class parent_class
@@ -380,7 +387,8 @@ gst_bus_post (GstBus * bus, GstMessage * message)
       /* pass the message to the async queue, refcount passed in the queue */
       GST_DEBUG_OBJECT (bus, "[msg %p] pushing on async queue", message);
       gst_atomic_queue_push (bus->priv->queue, message);
-      gst_poll_write_control (bus->priv->poll);
+      if (g_atomic_int_compare_and_exchange (&bus->priv->poll_pending, 0, 1))
+        gst_poll_write_control (bus->priv->poll);
       GST_DEBUG_OBJECT (bus, "[msg %p] pushed on async queue", message);
 
       break;
@@ -404,7 +412,8 @@ gst_bus_post (GstBus * bus, GstMessage * message)
       g_mutex_lock (lock);
 
       gst_atomic_queue_push (bus->priv->queue, message);
-      gst_poll_write_control (bus->priv->poll);
+      if (g_atomic_int_compare_and_exchange (&bus->priv->poll_pending, 0, 1))
+        gst_poll_write_control (bus->priv->poll);
 
       /* now block till the message is freed */
       g_cond_wait (cond, lock);
@@ -538,25 +547,6 @@ gst_bus_timed_pop_filtered (GstBus * bus, GstClockTime timeout,
         gst_atomic_queue_length (bus->priv->queue));
 
     while ((message = gst_atomic_queue_pop (bus->priv->queue))) {
-      if (bus->priv->poll) {
-        while (!gst_poll_read_control (bus->priv->poll)) {
-          if (errno == EWOULDBLOCK) {
-            /* Retry, this can happen if pushing to the queue has finished,
-             * popping here succeeded but writing control did not finish
-             * before we got to this line. */
-            /* Give other threads the chance to do something */
-            g_thread_yield ();
-            continue;
-          } else {
-            /* This is a real error and means that either the bus is in an
-             * inconsistent state, or the GstPoll is invalid. GstPoll already
-             * prints a critical warning about this, no need to do that again
-             * ourselves */
-            break;
-          }
-        }
-      }
-
       GST_DEBUG_OBJECT (bus, "got message %p, %s from %s, type mask is %u",
           message, GST_MESSAGE_TYPE_NAME (message),
           GST_MESSAGE_SRC_NAME (message), (guint) types);
@@ -575,6 +565,34 @@ gst_bus_timed_pop_filtered (GstBus * bus, GstClockTime timeout,
       message = NULL;
     }
 
+    /* the queue is empty; consume the wakeup token (if any) so that we will
+     * block in gst_poll_wait() below and the bus watch GSource stops firing.
+     * A message can get pushed right after we found the queue empty; the
+     * recheck after clearing the flag catches it, because its poster either
+     * saw the flag still set (and the message is found by the recheck) or
+     * wrote a fresh token. */
+    if (bus->priv->poll && g_atomic_int_get (&bus->priv->poll_pending)) {
+      while (!gst_poll_read_control (bus->priv->poll)) {
+        if (errno == EWOULDBLOCK) {
+          /* Retry, this can happen if pushing to the queue has finished,
+           * popping here succeeded but writing control did not finish
+           * before we got to this line. */
+          /* Give other threads the chance to do something */
+          g_thread_yield ();
+          continue;
+        } else {
+          /* This is a real error and means that either the bus is in an
+           * inconsistent state, or the GstPoll is invalid. GstPoll already
+           * prints a critical warning about this, no need to do that again
+           * ourselves */
+          break;
+        }
+      }
+      g_atomic_int_set (&bus->priv->poll_pending, 0);
+      /* recheck the queue before deciding to wait */
+      continue;
+    }
+
     /* no need to wait, exit loop */
     if (timeout == 0)
       break;
@@ -148,9 +148,106 @@ _priv_gst_caps_initialize (void)
       G_TYPE_STRING, gst_caps_transform_to_string);
 }
 
+/* Memoization cache for intersections of shared (non-writable) caps.
+ * Renegotiation tends to intersect the same few caps pairs over and
+ * over across pads and pipelines; remembering recent results turns
+ * those calls into a table probe instead of a full zig-zag walk. The
+ * entries hold references to both operands, so a cached key can never
+ * be the dangling pointer of a freed caps, and a non-writable caps is
+ * immutable by the mini-object contract so the pointers are stable
+ * keys for the contents. */
+#define CAPS_INTERSECT_CACHE_SIZE 64    /* must be a power of two */
+
+typedef struct
+{
+  GstCaps *caps1;
+  GstCaps *caps2;
+  GstCaps *result;
+  GstCapsIntersectMode mode;
+} CapsIntersectCacheEntry;
+
+static CapsIntersectCacheEntry caps_intersect_cache[CAPS_INTERSECT_CACHE_SIZE];
+G_LOCK_DEFINE_STATIC (caps_intersect_cache);
+
+static inline guint
+caps_intersect_cache_index (const GstCaps * caps1, const GstCaps * caps2,
+    GstCapsIntersectMode mode)
+{
+  guint hash;
+
+  /* mini-objects are at least pointer-aligned, drop the dead bits */
+  hash = (guint) (GPOINTER_TO_SIZE (caps1) >> 4);
+  hash = hash * 33 ^ (guint) (GPOINTER_TO_SIZE (caps2) >> 4);
+  hash = hash * 33 ^ (guint) mode;
+
+  return hash & (CAPS_INTERSECT_CACHE_SIZE - 1);
+}
+
+static GstCaps *
+caps_intersect_cache_lookup (GstCaps * caps1, GstCaps * caps2,
+    GstCapsIntersectMode mode)
+{
+  CapsIntersectCacheEntry *entry;
+  GstCaps *result = NULL;
+
+  G_LOCK (caps_intersect_cache);
+  entry = &caps_intersect_cache[caps_intersect_cache_index (caps1, caps2,
+          mode)];
+  if (entry->caps1 == caps1 && entry->caps2 == caps2 && entry->mode == mode)
+    result = gst_caps_ref (entry->result);
+  G_UNLOCK (caps_intersect_cache);
+
+  return result;
+}
+
+static void
+caps_intersect_cache_store (GstCaps * caps1, GstCaps * caps2,
+    GstCapsIntersectMode mode, GstCaps * result)
+{
+  CapsIntersectCacheEntry *entry;
+  CapsIntersectCacheEntry old;
+
+  G_LOCK (caps_intersect_cache);
+  entry = &caps_intersect_cache[caps_intersect_cache_index (caps1, caps2,
+          mode)];
+  old = *entry;
+  entry->caps1 = gst_caps_ref (caps1);
+  entry->caps2 = gst_caps_ref (caps2);
+  entry->result = gst_caps_ref (result);
+  entry->mode = mode;
+  G_UNLOCK (caps_intersect_cache);
+
+  if (old.caps1) {
+    gst_caps_unref (old.caps1);
+    gst_caps_unref (old.caps2);
+    gst_caps_unref (old.result);
+  }
+}
+
+static void
+caps_intersect_cache_clear (void)
+{
+  guint i;
+
+  G_LOCK (caps_intersect_cache);
+  for (i = 0; i < CAPS_INTERSECT_CACHE_SIZE; i++) {
+    CapsIntersectCacheEntry *entry = &caps_intersect_cache[i];
+
+    if (entry->caps1) {
+      gst_caps_unref (entry->caps1);
+      gst_caps_unref (entry->caps2);
+      gst_caps_unref (entry->result);
+      entry->caps1 = entry->caps2 = entry->result = NULL;
+    }
+  }
+  G_UNLOCK (caps_intersect_cache);
+}
+
 void
 _priv_gst_caps_cleanup (void)
 {
+  caps_intersect_cache_clear ();
+
   gst_caps_unref (_gst_caps_any);
   _gst_caps_any = NULL;
   gst_caps_unref (_gst_caps_none);
@@ -1764,6 +1861,29 @@ gst_caps_intersect_full (GstCaps * caps1, GstCaps * caps2,
   if (G_UNLIKELY (CAPS_IS_ANY (caps2)))
     return gst_caps_ref (caps1);
 
+  /* only shared caps are immutable and thus usable as cache keys */
+  if (!IS_WRITABLE (caps1) && !IS_WRITABLE (caps2)) {
+    GstCaps *result;
+
+    if ((result = caps_intersect_cache_lookup (caps1, caps2, mode)))
+      return result;
+
+    switch (mode) {
+      case GST_CAPS_INTERSECT_FIRST:
+        result = gst_caps_intersect_first (caps1, caps2);
+        break;
+      default:
+        g_warning ("Unknown caps intersect mode: %d", mode);
+        /* fallthrough */
+      case GST_CAPS_INTERSECT_ZIG_ZAG:
+        result = gst_caps_intersect_zig_zag (caps1, caps2);
+        break;
+    }
+    caps_intersect_cache_store (caps1, caps2, mode, result);
+
+    return result;
+  }
+
   switch (mode) {
     case GST_CAPS_INTERSECT_FIRST:
       return gst_caps_intersect_first (caps1, caps2);
@@ -479,13 +479,27 @@ gst_device_monitor_get_devices (GstDeviceMonitor * monitor)
  * Since: 1.4
  */
 
+struct ProviderStart
+{
+  GstDeviceProvider *provider;
+  gboolean started;
+};
+
+static void
+provider_start_func (gpointer data, gpointer user_data)
+{
+  struct ProviderStart *pstart = data;
+
+  pstart->started = gst_device_provider_start (pstart->provider);
+}
+
 gboolean
 gst_device_monitor_start (GstDeviceMonitor * monitor)
 {
-  guint i;
-  GQueue pending = G_QUEUE_INIT;
+  guint i, n_providers;
+  struct ProviderStart *pending;
   GList *started = NULL;
-  GstDeviceProvider *provider;
+  GThreadPool *pool;
 
   g_return_val_if_fail (GST_IS_DEVICE_MONITOR (monitor), FALSE);
 
@@ -512,25 +526,31 @@ gst_device_monitor_start (GstDeviceMonitor * monitor)
 
   gst_bus_set_flushing (monitor->priv->bus, FALSE);
 
-  for (i = 0; i < monitor->priv->providers->len; i++) {
-    GstDeviceProvider *provider;
-
-    provider = g_ptr_array_index (monitor->priv->providers, i);
-    g_queue_push_tail (&pending, gst_object_ref (provider));
-  }
-
-  while ((provider = g_queue_pop_head (&pending))) {
-    GST_OBJECT_UNLOCK (monitor);
-
-    if (gst_device_provider_start (provider)) {
-      started = g_list_prepend (started, provider);
-    } else {
-      gst_object_unref (provider);
-    }
+  n_providers = monitor->priv->providers->len;
+  pending = g_new0 (struct ProviderStart, n_providers);
+  for (i = 0; i < n_providers; i++)
+    pending[i].provider =
+        gst_object_ref (g_ptr_array_index (monitor->priv->providers, i));
+  GST_OBJECT_UNLOCK (monitor);
 
-    GST_OBJECT_LOCK (monitor);
+  /* the providers are independent of each other, so start them in parallel;
+   * a single provider probing slow hardware otherwise serializes startup
+   * behind it */
+  pool = g_thread_pool_new (provider_start_func, NULL, -1, FALSE, NULL);
+  for (i = 0; i < n_providers; i++)
+    g_thread_pool_push (pool, &pending[i], NULL);
+  /* this waits for all pushed tasks to complete */
+  g_thread_pool_free (pool, FALSE, TRUE);
+
+  for (i = 0; i < n_providers; i++) {
+    if (pending[i].started)
+      started = g_list_prepend (started, pending[i].provider);
+    else
+      gst_object_unref (pending[i].provider);
   }
+  g_free (pending);
 
+  GST_OBJECT_LOCK (monitor);
   if (started) {
     monitor->priv->started_providers = started;
   } else {
@@ -155,6 +155,7 @@ gst_element_factory_cleanup (GstElementFactory * factory)
     gst_structure_free ((GstStructure *) factory->metadata);
     factory->metadata = NULL;
   }
+  g_clear_pointer (&factory->metadata_string, g_free);
   if (factory->type) {
     factory->type = G_TYPE_INVALID;
   }
@@ -846,6 +847,24 @@ gst_element_factory_get_element_type (GstElementFactory * factory)
   return factory->type;
 }
 
+/* Factories loaded from the binary registry keep their metadata in
+ * serialized form and only deserialize it on first access, which for
+ * most factories never happens during the lifetime of a process. */
+static GstStructure *
+gst_element_factory_ensure_metadata (GstElementFactory * factory)
+{
+  if (G_UNLIKELY (factory->metadata == NULL
+          && factory->metadata_string != NULL)) {
+    GST_OBJECT_LOCK (factory);
+    if (factory->metadata == NULL) {
+      factory->metadata =
+          gst_structure_from_string (factory->metadata_string, NULL);
+    }
+    GST_OBJECT_UNLOCK (factory);
+  }
+  return (GstStructure *) factory->metadata;
+}
+
 /**
  * gst_element_factory_get_metadata:
  * @factory: a #GstElementFactory
@@ -862,7 +881,8 @@ gst_element_factory_get_metadata (GstElementFactory * factory,
 {
   g_return_val_if_fail (GST_IS_ELEMENT_FACTORY (factory), NULL);
 
-  return gst_structure_get_string ((GstStructure *) factory->metadata, key);
+  return gst_structure_get_string (gst_element_factory_ensure_metadata
+      (factory), key);
 }
 
 /**
@@ -884,7 +904,7 @@ gst_element_factory_get_metadata_keys (GstElementFactory * factory)
 
   g_return_val_if_fail (GST_IS_ELEMENT_FACTORY (factory), NULL);
 
-  metadata = (GstStructure *) factory->metadata;
+  metadata = gst_element_factory_ensure_metadata (factory);
   if (metadata == NULL)
     return NULL;
 
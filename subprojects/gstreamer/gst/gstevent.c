@@ -140,6 +140,66 @@ static GstEventQuarks event_quarks[] = {
 
 GST_DEFINE_MINI_OBJECT_TYPE (GstEvent, gst_event);
 
+/* Thread-local recycling of GstEventImpl. Events are allocated and freed
+ * at buffer rates in pipelines with per-buffer serialized events, so the
+ * fixed-size structure is cached on the freeing thread instead of going
+ * back through the slice allocator every time. The cache hands out
+ * zeroed structures, matching the g_slice_new0() it replaces. */
+#define EVENT_CACHE_SIZE 16
+
+typedef struct
+{
+  guint len;
+  gpointer items[EVENT_CACHE_SIZE];
+} GstEventThreadCache;
+
+static void
+_gst_event_thread_cache_free (gpointer data)
+{
+  GstEventThreadCache *cache = data;
+  guint i;
+
+  for (i = 0; i < cache->len; i++)
+    g_slice_free1 (sizeof (GstEventImpl), cache->items[i]);
+  g_free (cache);
+}
+
+static GPrivate event_thread_cache =
+G_PRIVATE_INIT (_gst_event_thread_cache_free);
+
+static inline GstEventImpl *
+gst_event_impl_alloc (void)
+{
+  GstEventThreadCache *cache = g_private_get (&event_thread_cache);
+  GstEventImpl *event;
+
+  if (G_LIKELY (cache != NULL && cache->len > 0)) {
+    event = cache->items[--cache->len];
+    memset (event, 0, sizeof (GstEventImpl));
+    return event;
+  }
+
+  return g_slice_new0 (GstEventImpl);
+}
+
+static inline void
+gst_event_impl_release (GstEventImpl * event)
+{
+#ifndef USE_POISONING
+  GstEventThreadCache *cache = g_private_get (&event_thread_cache);
+
+  if (G_UNLIKELY (cache == NULL)) {
+    cache = g_new0 (GstEventThreadCache, 1);
+    g_private_set (&event_thread_cache, cache);
+  }
+  if (G_LIKELY (cache->len < EVENT_CACHE_SIZE)) {
+    cache->items[cache->len++] = event;
+    return;
+  }
+#endif
+  g_slice_free1 (sizeof (GstEventImpl), event);
+}
+
 void
 _priv_gst_event_initialize (void)
 {
@@ -234,7 +294,7 @@ _gst_event_free (GstEvent * event)
   memset (event, 0xff, sizeof (GstEventImpl));
 #endif
 
-  g_slice_free1 (sizeof (GstEventImpl), event);
+  gst_event_impl_release ((GstEventImpl *) event);
 }
 
 static void gst_event_init (GstEventImpl * event, GstEventType type);
@@ -245,7 +305,7 @@ _gst_event_copy (GstEvent * event)
   GstEventImpl *copy;
   GstStructure *s;
 
-  copy = g_slice_new0 (GstEventImpl);
+  copy = gst_event_impl_alloc ();
 
   gst_event_init (copy, GST_EVENT_TYPE (event));
 
@@ -305,7 +365,7 @@ gst_event_new_custom (GstEventType type, GstStructure * structure)
 {
   GstEventImpl *event;
 
-  event = g_slice_new0 (GstEventImpl);
+  event = gst_event_impl_alloc ();
 
   GST_CAT_DEBUG (GST_CAT_EVENT, "creating new event %p %s %d", event,
       gst_event_type_get_name (type), type);
@@ -326,7 +386,7 @@ gst_event_new_custom (GstEventType type, GstStructure * structure)
   /* ERRORS */
 had_parent:
   {
-    g_slice_free1 (sizeof (GstEventImpl), event);
+    gst_event_impl_release (event);
     g_warning ("structure is already owned by another object");
     return NULL;
   }
@@ -3275,6 +3275,7 @@ typedef struct
 {
   guint max_size_per_thread;
   guint thread_timeout;
+  gboolean dump_on_error;
   GQueue threads;
   GHashTable *thread_index;
 } GstRingBufferLogger;
@@ -3411,6 +3412,25 @@ gst_ring_buffer_logger_log (GstDebugCategory * category,
     log->log_size = 0;
   }
 
+  if (G_UNLIKELY (level == GST_LEVEL_ERROR && logger->dump_on_error)) {
+    GList *t;
+    gchar *buf;
+
+    /* flight-recorder dump: write out everything collected so far and start
+     * over, so a burst of errors does not repeat the same lines */
+    g_printerr ("--- GStreamer ring buffer log dump (on ERROR) ---\n");
+    for (t = logger->threads.head; t; t = t->next) {
+      GstRingBufferLog *tlog = t->data;
+
+      while ((buf = g_queue_pop_head (&tlog->log))) {
+        g_printerr ("%s", buf);
+        g_free (buf);
+      }
+      tlog->log_size = 0;
+    }
+    g_printerr ("--- end of ring buffer log dump ---\n");
+  }
+
   G_UNLOCK (ring_buffer_logger);
 }
 
@@ -3535,6 +3555,29 @@ gst_debug_remove_ring_buffer_logger (void)
   gst_debug_remove_log_function (gst_ring_buffer_logger_log);
 }
 
+/**
+ * gst_debug_ring_buffer_logger_set_dump_on_error:
+ * @dump_on_error: whether to dump the collected logs on ERROR messages
+ *
+ * Configures the ring buffer logger added with
+ * gst_debug_add_ring_buffer_logger() to write out all collected logs of all
+ * threads to stderr whenever a message of level #GST_LEVEL_ERROR is logged,
+ * flight-recorder style. The collected logs are cleared after the dump, so
+ * consecutive errors only report what was logged in between.
+ *
+ * Since: 1.22
+ */
+void
+gst_debug_ring_buffer_logger_set_dump_on_error (gboolean dump_on_error)
+{
+  g_return_if_fail (ring_buffer_logger != NULL);
+
+  G_LOCK (ring_buffer_logger);
+  if (ring_buffer_logger)
+    ring_buffer_logger->dump_on_error = dump_on_error;
+  G_UNLOCK (ring_buffer_logger);
+}
+
 #else /* GST_DISABLE_GST_DEBUG */
 #ifndef GST_REMOVE_DISABLED
 
@@ -3555,5 +3598,10 @@ gst_debug_remove_ring_buffer_logger (void)
 {
 }
 
+void
+gst_debug_ring_buffer_logger_set_dump_on_error (gboolean dump_on_error)
+{
+}
+
 #endif /* GST_REMOVE_DISABLED */
 #endif /* GST_DISABLE_GST_DEBUG */
@@ -1806,6 +1806,8 @@ GST_API
 void                  gst_debug_remove_ring_buffer_logger   (void);
 GST_API
 gchar **              gst_debug_ring_buffer_logger_get_logs (void);
+GST_API
+void                  gst_debug_ring_buffer_logger_set_dump_on_error (gboolean dump_on_error);
 
 G_END_DECLS
 
@@ -138,6 +138,9 @@ struct _GstPadPrivate
   GArray *events;
   guint last_cookie;
 
+  /* number of threads currently pushing through the pad. Modified
+   * atomically so that the probe-free push fast path can drop its
+   * reference without re-taking the object lock */
   gint using;
   guint probe_list_cookie;
 
@@ -1393,7 +1396,8 @@ cleanup_hook (GstPad * pad, GHook * hook)
     }
   }
   g_hook_destroy_link (&pad->probes, hook);
-  pad->num_probes--;
+  /* atomic because the push fast path samples it without the lock */
+  g_atomic_int_add (&pad->num_probes, -1);
 }
 
 /**
@@ -1456,7 +1460,8 @@ gst_pad_add_probe (GstPad * pad, GstPadProbeType mask,
 
   /* add the probe */
   g_hook_append (&pad->probes, hook);
-  pad->num_probes++;
+  /* atomic because the push fast path samples it without the lock */
+  g_atomic_int_inc (&pad->num_probes);
   /* incremenent cookie so that the new hook gets called */
   pad->priv->probe_list_cookie++;
 
@@ -1479,7 +1484,7 @@ gst_pad_add_probe (GstPad * pad, GstPadProbeType mask,
 
   /* call the callback if we need to be called for idle callbacks */
   if ((mask & GST_PAD_PROBE_TYPE_IDLE) && (callback != NULL)) {
-    if (pad->priv->using > 0) {
+    if (g_atomic_int_get (&pad->priv->using) > 0) {
       /* the pad is in use, we can't signal the idle callback yet. Since we set the
        * flag above, the last thread to leave the push will do the callback. New
        * threads going into the push will block. */
@@ -3677,8 +3682,13 @@ probe_hook_marshal (GHook * hook, ProbeMarshall * data)
   if (ret != GST_PAD_PROBE_REMOVE)
     data->marshalled = TRUE;
 
-  if ((flags & GST_PAD_PROBE_TYPE_IDLE))
+  if ((flags & GST_PAD_PROBE_TYPE_IDLE)) {
     pad->priv->idle_running--;
+    /* wake up threads waiting for the idle probes to finish, like the
+     * push fast path fallback in gst_pad_push_data() */
+    if (pad->priv->idle_running == 0)
+      GST_PAD_BLOCK_BROADCAST (pad);
+  }
 
   if (ret != GST_PAD_PROBE_HANDLED && original_data != NULL
       && info->data == NULL) {
@@ -4661,6 +4671,7 @@ gst_pad_push_data (GstPad * pad, GstPadProbeType type, void *data)
   GstPad *peer;
   GstFlowReturn ret;
   gboolean handled = FALSE;
+  gint probes_before;
 
   GST_OBJECT_LOCK (pad);
   if (G_UNLIKELY (GST_PAD_IS_FLUSHING (pad)))
@@ -4691,19 +4702,28 @@ gst_pad_push_data (GstPad * pad, GstPadProbeType type, void *data)
   if (G_UNLIKELY ((ret = check_sticky (pad, NULL))) != GST_FLOW_OK)
     goto events_error;
 
-  /* do block probes */
+  /* do block probes. The snapshot tells us whether the probe walk could
+   * have run a callback: a probe returning GST_PAD_PROBE_REMOVE is
+   * removed from the count during the walk, but it did run and may have
+   * relinked the pad, so the post-walk count must not be used here. */
+  probes_before = pad->num_probes;
   PROBE_HANDLE (pad, type | GST_PAD_PROBE_TYPE_BLOCK, data, probe_stopped,
       probe_handled);
 
-  /* recheck sticky events because the probe might have cause a relink */
-  if (G_UNLIKELY ((ret = check_sticky (pad, NULL))) != GST_FLOW_OK)
+  /* recheck sticky events because the probe might have caused a relink.
+   * Without probes the lock was never released since the check above, so
+   * nothing can have changed and the recheck is skipped. */
+  if (G_UNLIKELY (probes_before > 0
+          && (ret = check_sticky (pad, NULL)) != GST_FLOW_OK))
     goto events_error;
 
   /* do post-blocking probes */
+  probes_before = pad->num_probes;
   PROBE_HANDLE (pad, type, data, probe_stopped, probe_handled);
 
-  /* recheck sticky events because the probe might have cause a relink */
-  if (G_UNLIKELY ((ret = check_sticky (pad, NULL))) != GST_FLOW_OK)
+  /* recheck sticky events because the probe might have caused a relink */
+  if (G_UNLIKELY (probes_before > 0
+          && (ret = check_sticky (pad, NULL)) != GST_FLOW_OK))
     goto events_error;
 
   if (G_UNLIKELY ((peer = GST_PAD_PEER (pad)) == NULL))
@@ -4711,7 +4731,7 @@ gst_pad_push_data (GstPad * pad, GstPadProbeType type, void *data)
 
   /* take ref to peer pad before releasing the lock */
   gst_object_ref (peer);
-  pad->priv->using++;
+  g_atomic_int_inc (&pad->priv->using);
   GST_OBJECT_UNLOCK (pad);
 
   ret = gst_pad_chain_data_unchecked (peer, type, data);
@@ -4719,15 +4739,30 @@ gst_pad_push_data (GstPad * pad, GstPadProbeType type, void *data)
 
   gst_object_unref (peer);
 
-  GST_OBJECT_LOCK (pad);
+  /* Probe-free fast path: avoid re-taking the object lock after the push.
+   * last_flowret is a plain word store and the using counter is dropped
+   * atomically. If a probe was installed while we were pushing we detect
+   * that by re-checking num_probes after the decrement and fall back to
+   * the locked path to fire the idle callbacks. */
   pad->ABI.abi.last_flowret = ret;
-  pad->priv->using--;
-  if (pad->priv->using == 0) {
-    /* pad is not active anymore, trigger idle callbacks */
-    PROBE_NO_DATA (pad, GST_PAD_PROBE_TYPE_PUSH | GST_PAD_PROBE_TYPE_IDLE,
-        probe_stopped, ret);
+  if (g_atomic_int_dec_and_test (&pad->priv->using)
+      && G_UNLIKELY (g_atomic_int_get (&pad->num_probes) > 0)) {
+    GST_OBJECT_LOCK (pad);
+    /* An idle probe added between our decrement and taking the lock may
+     * be running its callback directly from gst_pad_add_probe(), which
+     * sampled using == 0 and claimed the idle notification for this
+     * transition. Wait for that call to finish before marshalling the
+     * idle probes ourselves so the new probe is never run twice
+     * concurrently; if it returned GST_PAD_PROBE_REMOVE from the direct
+     * call it is gone by the time we get here and is not called again. */
+    if (do_pad_idle_probe_wait (pad) != GST_FLOW_FLUSHING
+        && g_atomic_int_get (&pad->priv->using) == 0) {
+      /* pad is not active anymore, trigger idle callbacks */
+      PROBE_NO_DATA (pad, GST_PAD_PROBE_TYPE_PUSH | GST_PAD_PROBE_TYPE_IDLE,
+          probe_stopped, ret);
+    }
+    GST_OBJECT_UNLOCK (pad);
   }
-  GST_OBJECT_UNLOCK (pad);
 
   return ret;
 
@@ -5165,7 +5200,7 @@ gst_pad_pull_range (GstPad * pad, guint64 offset, guint size,
     goto not_linked;
 
   gst_object_ref (peer);
-  pad->priv->using++;
+  g_atomic_int_inc (&pad->priv->using);
   GST_OBJECT_UNLOCK (pad);
 
   ret = gst_pad_get_range_unchecked (peer, offset, size, &res_buf);
@@ -5173,9 +5208,9 @@ gst_pad_pull_range (GstPad * pad, guint64 offset, guint size,
   gst_object_unref (peer);
 
   GST_OBJECT_LOCK (pad);
-  pad->priv->using--;
+  g_atomic_int_add (&pad->priv->using, -1);
   pad->ABI.abi.last_flowret = ret;
-  if (pad->priv->using == 0) {
+  if (g_atomic_int_get (&pad->priv->using) == 0) {
     /* pad is not active anymore, trigger idle callbacks */
     PROBE_NO_DATA (pad, GST_PAD_PROBE_TYPE_PULL | GST_PAD_PROBE_TYPE_IDLE,
         probe_stopped_unref, ret);
@@ -5541,7 +5576,7 @@ gst_pad_push_event_unchecked (GstPad * pad, GstEvent * event,
     goto not_linked;
 
   gst_object_ref (peerpad);
-  pad->priv->using++;
+  g_atomic_int_inc (&pad->priv->using);
   GST_OBJECT_UNLOCK (pad);
 
   GST_LOG_OBJECT (pad, "sending event %p (%s) to peerpad %" GST_PTR_FORMAT,
@@ -5558,8 +5593,8 @@ gst_pad_push_event_unchecked (GstPad * pad, GstEvent * event,
   gst_object_unref (peerpad);
 
   GST_OBJECT_LOCK (pad);
-  pad->priv->using--;
-  if (pad->priv->using == 0) {
+  g_atomic_int_add (&pad->priv->using, -1);
+  if (g_atomic_int_get (&pad->priv->using) == 0) {
     /* pad is not active anymore, trigger idle callbacks */
     PROBE_NO_DATA (pad, GST_PAD_PROBE_TYPE_PUSH | GST_PAD_PROBE_TYPE_IDLE,
         idle_probe_stopped, ret);
@@ -1101,11 +1101,18 @@ typedef enum
   REGISTRY_SCAN_HELPER_RUNNING
 } GstRegistryScanHelperState;
 
+/* Maximum number of scanner children to spread plugin loading over. Loading
+ * plugins is mostly independent work, so cold registry rebuilds scale with
+ * the number of children up to this cap. */
+#define MAX_SCAN_HELPERS 4
+
 typedef struct
 {
   GstRegistry *registry;
   GstRegistryScanHelperState helper_state;
-  GstPluginLoader *helper;
+  GstPluginLoader *helpers[MAX_SCAN_HELPERS];
+  guint n_helpers;
+  guint next_helper;
   gboolean changed;
 } GstRegistryScanContext;
 
@@ -1133,17 +1140,21 @@ init_scan_context (GstRegistryScanContext * context, GstRegistry * registry)
   else
     context->helper_state = REGISTRY_SCAN_HELPER_DISABLED;
 
-  context->helper = NULL;
+  context->n_helpers = 0;
+  context->next_helper = 0;
   context->changed = FALSE;
 }
 
 static void
 clear_scan_context (GstRegistryScanContext * context)
 {
-  if (context->helper) {
-    context->changed |= _priv_gst_plugin_loader_funcs.destroy (context->helper);
-    context->helper = NULL;
-  }
+  guint i;
+
+  for (i = 0; i < context->n_helpers; i++)
+    context->changed |=
+        _priv_gst_plugin_loader_funcs.destroy (context->helpers[i]);
+  context->n_helpers = 0;
+  context->next_helper = 0;
 }
 
 static gboolean
@@ -1159,11 +1170,26 @@ gst_registry_scan_plugin_file (GstRegistryScanContext * context,
 #endif
 
 
-  /* Have a plugin to load - see if the scan-helper needs starting */
+  /* Have a plugin to load - see if the scan-helpers need starting */
   if (context->helper_state == REGISTRY_SCAN_HELPER_NOT_STARTED) {
-    GST_DEBUG ("Starting plugin scanner for file %s", filename);
-    context->helper = _priv_gst_plugin_loader_funcs.create (context->registry);
-    if (context->helper != NULL)
+    /* start one scanner child per processor up to the cap, so plugins can
+     * be loaded and introspected concurrently; each child keeps its own
+     * pending list and crash handling. When the scanner is not reused the
+     * context is torn down after every file, so a pool would only add
+     * spawn overhead there. */
+    guint n = __registry_reuse_plugin_scanner ?
+        MIN (g_get_num_processors (), MAX_SCAN_HELPERS) : 1;
+
+    GST_DEBUG ("Starting %u plugin scanner(s) for file %s", n, filename);
+    while (context->n_helpers < n) {
+      GstPluginLoader *helper =
+          _priv_gst_plugin_loader_funcs.create (context->registry);
+
+      if (helper == NULL)
+        break;
+      context->helpers[context->n_helpers++] = helper;
+    }
+    if (context->n_helpers > 0)
       context->helper_state = REGISTRY_SCAN_HELPER_RUNNING;
     else {
       GST_WARNING ("Failed starting plugin scanner. Scanning in-process");
@@ -1172,14 +1198,19 @@ gst_registry_scan_plugin_file (GstRegistryScanContext * context,
   }
 
   if (context->helper_state == REGISTRY_SCAN_HELPER_RUNNING) {
+    GstPluginLoader *helper = context->helpers[context->next_helper];
+
+    context->next_helper = (context->next_helper + 1) % context->n_helpers;
+
     GST_DEBUG ("Using scan-helper to load plugin %s", filename);
-    if (!_priv_gst_plugin_loader_funcs.load (context->helper,
+    if (!_priv_gst_plugin_loader_funcs.load (helper,
             filename, file_size, file_mtime)) {
       g_warning ("External plugin loader failed. This most likely means that "
           "the plugin loader helper binary was not found or could not be run. "
           "You might need to set the GST_PLUGIN_SCANNER environment variable "
           "if your setup is unusual. This should normally not be required "
           "though.");
+      clear_scan_context (context);
       context->helper_state = REGISTRY_SCAN_HELPER_DISABLED;
     }
   }
@@ -300,9 +300,14 @@ gst_registry_chunks_save_feature (GList ** list, GstPluginFeature * feature)
       }
     }
 
-    /* pack element metadata strings */
-    gst_registry_chunks_save_string (list,
-        gst_structure_to_string (factory->metadata));
+    /* pack element metadata strings, reusing the serialized form when
+     * the metadata was never deserialized since the last cache load */
+    if (factory->metadata == NULL && factory->metadata_string != NULL)
+      gst_registry_chunks_save_string (list,
+          g_strdup (factory->metadata_string));
+    else
+      gst_registry_chunks_save_string (list,
+          gst_structure_to_string (factory->metadata));
   } else if (GST_IS_TYPE_FIND_FACTORY (feature)) {
     GstRegistryChunkTypeFindFactory *tff;
     GstTypeFindFactory *factory = GST_TYPE_FIND_FACTORY (feature);
@@ -335,6 +340,10 @@ gst_registry_chunks_save_feature (GList ** list, GstPluginFeature * feature)
       gst_caps_unref (fcaps);
 
       gst_registry_chunks_save_string (list, str);
+    } else if (factory->caps_string) {
+      /* caps were never materialized, the serialized form is still
+       * the simplified one we loaded from the cache */
+      gst_registry_chunks_save_string (list, g_strdup (factory->caps_string));
     } else {
       gst_registry_chunks_save_const_string (list, "");
     }
@@ -612,17 +621,12 @@ gst_registry_chunks_load_feature (GstRegistry * registry, gchar ** in,
     unpack_element (*in, ef, GstRegistryChunkElementFactory, end, fail);
     pf = (GstRegistryChunkPluginFeature *) ef;
 
-    /* unpack element factory strings */
+    /* unpack element factory strings. The metadata structure is kept in
+     * string form and only deserialized when somebody needs it, which
+     * saves parsing hundreds of structures at registry load time. */
     unpack_string_nocopy (*in, meta_data_str, end, fail);
-    if (meta_data_str && *meta_data_str) {
-      factory->metadata = gst_structure_from_string (meta_data_str, NULL);
-      if (!factory->metadata) {
-        GST_ERROR
-            ("Error when trying to deserialize structure for metadata '%s'",
-            meta_data_str);
-        goto fail;
-      }
-    }
+    if (meta_data_str && *meta_data_str)
+      factory->metadata_string = g_strdup (meta_data_str);
     n = ef->npadtemplates;
     GST_DEBUG ("Element factory : npadtemplates=%d", n);
 
@@ -669,12 +673,11 @@ gst_registry_chunks_load_feature (GstRegistry * registry, gchar ** in,
     unpack_element (*in, tff, GstRegistryChunkTypeFindFactory, end, fail);
     pf = (GstRegistryChunkPluginFeature *) tff;
 
-    /* load typefinder caps */
+    /* load typefinder caps, parsed lazily on first use */
     unpack_string_nocopy (*in, const_str, end, fail);
+    factory->caps = NULL;
     if (const_str != NULL && *const_str != '\0')
-      factory->caps = gst_caps_from_string (const_str);
-    else
-      factory->caps = NULL;
+      factory->caps_string = g_strdup (const_str);
 
     /* load extensions */
     if (tff->nextensions) {
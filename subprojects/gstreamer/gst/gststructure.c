@@ -171,9 +171,18 @@ typedef struct
    *  else it's a pointer to the arr field. */
   GstStructureField *fields;
 
+  /* quark -> field index + 1, maintained for structures with more fields
+   * than GST_STRUCTURE_INDEX_THRESHOLD so that lookups don't scan the whole
+   * array. Only updated while mutating, which requires exclusive ownership,
+   * so concurrent lookups on shared structures can read it without locking */
+  GHashTable *field_index;
+
   GstStructureField arr[1];
 } GstStructureImpl;
 
+/* linear scanning is faster than hashing for a small number of fields */
+#define GST_STRUCTURE_INDEX_THRESHOLD 8
+
 #define GST_STRUCTURE_REFCOUNT(s) (((GstStructureImpl*)(s))->parent_refcount)
 #define GST_STRUCTURE_LEN(s) (((GstStructureImpl*)(s))->fields_len)
 
@@ -190,6 +199,25 @@ typedef struct
 #define IS_TAGLIST(structure) \
     (structure->name == GST_QUARK (TAGLIST))
 
+/* rebuild the quark -> index map from the fields array. Called while
+ * mutating, so there can be no concurrent lookups */
+static void
+_structure_index_rebuild (GstStructure * s)
+{
+  GstStructureImpl *impl = (GstStructureImpl *) s;
+  guint i;
+
+  if (impl->field_index == NULL)
+    impl->field_index = g_hash_table_new (NULL, NULL);
+  else
+    g_hash_table_remove_all (impl->field_index);
+
+  for (i = 0; i < impl->fields_len; i++) {
+    g_hash_table_insert (impl->field_index,
+        GUINT_TO_POINTER (impl->fields[i].name), GUINT_TO_POINTER (i + 1));
+  }
+}
+
 /* Replacement for g_array_append_val */
 static void
 _structure_append_val (GstStructure * s, GstStructureField * val)
@@ -218,6 +246,15 @@ _structure_append_val (GstStructure * s, GstStructureField * val)
 
   /* Finally set value */
   impl->fields[impl->fields_len++] = *val;
+
+  /* keep the lookup index of large structures up to date */
+  if (G_UNLIKELY (impl->fields_len > GST_STRUCTURE_INDEX_THRESHOLD)) {
+    if (impl->field_index == NULL)
+      _structure_index_rebuild (s);
+    else
+      g_hash_table_insert (impl->field_index,
+          GUINT_TO_POINTER (val->name), GUINT_TO_POINTER (impl->fields_len));
+  }
 }
 
 /* Replacement for g_array_remove_index */
@@ -236,6 +273,17 @@ _structure_remove_index (GstStructure * s, guint idx)
         &impl->fields[idx + 1],
         (impl->fields_len - idx - 1) * sizeof (GstStructureField));
   impl->fields_len--;
+
+  /* the indices after idx all shifted, rebuild the lookup index or drop
+   * it when the linear scan is faster again */
+  if (G_UNLIKELY (impl->field_index != NULL)) {
+    if (impl->fields_len > GST_STRUCTURE_INDEX_THRESHOLD) {
+      _structure_index_rebuild (s);
+    } else {
+      g_hash_table_destroy (impl->field_index);
+      impl->field_index = NULL;
+    }
+  }
 }
 
 static void gst_structure_set_field (GstStructure * structure,
@@ -541,6 +589,9 @@ gst_structure_free (GstStructure * structure)
   if (GST_STRUCTURE_IS_USING_DYNAMIC_ARRAY (structure))
     g_free (((GstStructureImpl *) structure)->fields);
 
+  if (((GstStructureImpl *) structure)->field_index != NULL)
+    g_hash_table_destroy (((GstStructureImpl *) structure)->field_index);
+
 #ifdef USE_POISONING
   memset (structure, 0xff, sizeof (GstStructure));
 #endif
@@ -1084,6 +1135,17 @@ gst_structure_id_get_field (const GstStructure * structure, GQuark field_id)
   GstStructureField *field;
   guint i, len;
 
+  /* large structures maintain a quark -> index map */
+  if (((const GstStructureImpl *) structure)->field_index != NULL) {
+    gpointer idx = g_hash_table_lookup (
+        ((const GstStructureImpl *) structure)->field_index,
+        GUINT_TO_POINTER (field_id));
+
+    if (idx == NULL)
+      return NULL;
+    return GST_STRUCTURE_FIELD (structure, GPOINTER_TO_UINT (idx) - 1);
+  }
+
   len = GST_STRUCTURE_LEN (structure);
 
   for (i = 0; i < len; i++) {
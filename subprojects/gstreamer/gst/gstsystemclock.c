@@ -350,6 +350,8 @@ struct _GstSystemClockPrivate
 
   GstClockType clock_type;
 
+  GstClockTime timer_slack;
+
 #ifdef G_OS_WIN32
   LARGE_INTEGER frequency;
 #endif                          /* G_OS_WIN32 */
@@ -368,10 +370,13 @@ struct _GstSystemClockPrivate
 #define DEFAULT_CLOCK_TYPE GST_CLOCK_TYPE_MONOTONIC
 #endif
 
+#define DEFAULT_TIMER_SLACK 0
+
 enum
 {
   PROP_0,
   PROP_CLOCK_TYPE,
+  PROP_TIMER_SLACK,
   /* FILL ME */
 };
 
@@ -429,6 +434,23 @@ gst_system_clock_class_init (GstSystemClockClass * klass)
           GST_TYPE_CLOCK_TYPE, DEFAULT_CLOCK_TYPE,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstSystemClock:timer-slack:
+   *
+   * The maximum amount of time, in nanoseconds, that a wait on this clock
+   * may finish before the requested time. A larger slack lets wakeups of
+   * nearby clock entries coalesce into fewer thread wakeups, reducing the
+   * CPU usage of idle pipelines at the cost of timing accuracy. The
+   * default of 0 keeps waits as accurate as the platform allows.
+   *
+   * Since: 1.22
+   */
+  g_object_class_install_property (gobject_class, PROP_TIMER_SLACK,
+      g_param_spec_uint64 ("timer-slack", "Timer slack",
+          "The maximum time waits may finish early to allow wakeup "
+          "coalescing (in nanoseconds)", 0, G_MAXUINT64, DEFAULT_TIMER_SLACK,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
   gstclock_class->get_internal_time = gst_system_clock_get_internal_time;
   gstclock_class->get_resolution = gst_system_clock_get_resolution;
   gstclock_class->wait = gst_system_clock_id_wait_jitter;
@@ -450,6 +472,7 @@ gst_system_clock_init (GstSystemClock * clock)
   clock->priv = priv = gst_system_clock_get_instance_private (clock);
 
   priv->clock_type = DEFAULT_CLOCK_TYPE;
+  priv->timer_slack = DEFAULT_TIMER_SLACK;
 
   priv->entries = NULL;
   g_cond_init (&priv->entries_changed);
@@ -542,6 +565,11 @@ gst_system_clock_set_property (GObject * object, guint prop_id,
       GST_CAT_DEBUG_OBJECT (GST_CAT_CLOCK, sysclock, "clock-type set to %d",
           sysclock->priv->clock_type);
       break;
+    case PROP_TIMER_SLACK:
+      sysclock->priv->timer_slack = g_value_get_uint64 (value);
+      GST_CAT_DEBUG_OBJECT (GST_CAT_CLOCK, sysclock, "timer-slack set to %"
+          GST_TIME_FORMAT, GST_TIME_ARGS (sysclock->priv->timer_slack));
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -558,6 +586,9 @@ gst_system_clock_get_property (GObject * object, guint prop_id, GValue * value,
     case PROP_CLOCK_TYPE:
       g_value_set_enum (value, sysclock->priv->clock_type);
       break;
+    case PROP_TIMER_SLACK:
+      g_value_set_uint64 (value, sysclock->priv->timer_slack);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -946,11 +977,16 @@ static GstClockReturn
 gst_system_clock_id_wait_jitter_unlocked (GstClock * clock,
     GstClockEntry * entry, GstClockTimeDiff * jitter, gboolean restart)
 {
-  GstClockTime entryt, now;
+  GstSystemClockPrivate *priv = GST_SYSTEM_CLOCK_CAST (clock)->priv;
+  GstClockTime entryt, now, min_wait_time;
   GstClockTimeDiff diff;
   GstClockReturn status;
   gint64 mono_ts;
 
+  /* waits may finish up to timer-slack early, which both shortens each wait
+   * and lets wakeups of entries with nearby deadlines coalesce */
+  min_wait_time = MAX (CLOCK_MIN_WAIT_TIME, priv->timer_slack);
+
   status = GST_CLOCK_ENTRY_STATUS (entry);
   if (G_UNLIKELY (status == GST_CLOCK_UNSCHEDULED)) {
     return GST_CLOCK_UNSCHEDULED;
@@ -976,7 +1012,7 @@ gst_system_clock_id_wait_jitter_unlocked (GstClock * clock,
       " diff (time-now) %" G_GINT64_FORMAT,
       entry, GST_TIME_ARGS (entryt), GST_TIME_ARGS (now), diff);
 
-  if (G_LIKELY (diff > CLOCK_MIN_WAIT_TIME)) {
+  if (G_LIKELY (diff > (GstClockTimeDiff) min_wait_time)) {
 #ifdef WAIT_DEBUGGING
     GstClockTime final;
 #endif
@@ -1054,7 +1090,7 @@ gst_system_clock_id_wait_jitter_unlocked (GstClock * clock,
         now = gst_clock_get_time (clock);
         diff = GST_CLOCK_DIFF (now, entryt);
 
-        if (diff <= CLOCK_MIN_WAIT_TIME) {
+        if (diff <= (GstClockTimeDiff) min_wait_time) {
           /* timeout, this is fine, we can report success now */
           GST_CLOCK_ENTRY_STATUS (entry) = status = GST_CLOCK_OK;
           GST_CAT_DEBUG_OBJECT (GST_CAT_CLOCK, clock,
@@ -1080,8 +1116,8 @@ gst_system_clock_id_wait_jitter_unlocked (GstClock * clock,
       }
     }
   } else {
-    /* we are right on time or too late */
-    if (G_UNLIKELY (diff == 0)) {
+    /* we are right on time (or within the configured slack) or too late */
+    if (G_UNLIKELY (diff >= 0 && (GstClockTime) diff <= priv->timer_slack)) {
       GST_CLOCK_ENTRY_STATUS (entry) = status = GST_CLOCK_OK;
     } else {
       GST_CLOCK_ENTRY_STATUS (entry) = status = GST_CLOCK_EARLY;
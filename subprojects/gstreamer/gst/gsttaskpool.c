@@ -353,9 +353,30 @@ shared_task_data_unref (SharedTaskData * tdata)
   }
 }
 
+/* A worker thread of a shared task pool. Each worker owns a queue of
+ * pending work; new work is distributed round-robin over the workers and
+ * an idle worker steals from the tail of a busy neighbour's queue before
+ * going to sleep, so a fixed worker set stays busy regardless of which
+ * queue the work was originally pushed to. */
+typedef struct
+{
+  GstSharedTaskPool *pool;
+  GThread *thread;
+  GQueue queue;                 /* of SharedTaskData */
+  gboolean stopping;
+} SharedWorker;
+
 struct _GstSharedTaskPoolPrivate
 {
   guint max_threads;
+
+  /* protects the worker set and all worker queues */
+  GMutex lock;
+  GCond cond;
+  GPtrArray *workers;           /* of SharedWorker */
+  GQueue pending;               /* work queued while no worker exists */
+  guint next_worker;
+  gboolean running;
 };
 
 #define GST_SHARED_TASK_POOL_CAST(pool)       ((GstSharedTaskPool*)(pool))
@@ -364,7 +385,7 @@ G_DEFINE_TYPE_WITH_PRIVATE (GstSharedTaskPool, gst_shared_task_pool,
     GST_TYPE_TASK_POOL);
 
 static void
-shared_func (SharedTaskData * tdata, GstTaskPool * pool)
+shared_func (SharedTaskData * tdata)
 {
   tdata->func (tdata->user_data);
 
@@ -376,16 +397,89 @@ shared_func (SharedTaskData * tdata, GstTaskPool * pool)
   shared_task_data_unref (tdata);
 }
 
+/* Called with the pool lock. Take work for @worker: first from its own
+ * queue, then from the frozen-pool backlog, then by stealing the oldest
+ * item of the most loaded other worker. */
+static SharedTaskData *
+shared_worker_take (GstSharedTaskPoolPrivate * priv, SharedWorker * worker)
+{
+  SharedTaskData *tdata;
+  SharedWorker *victim = NULL;
+  guint i;
+
+  if ((tdata = g_queue_pop_head (&worker->queue)))
+    return tdata;
+
+  if ((tdata = g_queue_pop_head (&priv->pending)))
+    return tdata;
+
+  for (i = 0; i < priv->workers->len; i++) {
+    SharedWorker *other = g_ptr_array_index (priv->workers, i);
+
+    if (other == worker)
+      continue;
+    if (victim == NULL || other->queue.length > victim->queue.length)
+      victim = other;
+  }
+  if (victim && victim->queue.length > 0)
+    return g_queue_pop_tail (&victim->queue);
+
+  return NULL;
+}
+
+static gpointer
+shared_worker_main (SharedWorker * worker)
+{
+  GstSharedTaskPoolPrivate *priv = worker->pool->priv;
+  SharedTaskData *tdata;
+
+  g_mutex_lock (&priv->lock);
+  while (TRUE) {
+    if ((tdata = shared_worker_take (priv, worker))) {
+      g_mutex_unlock (&priv->lock);
+      shared_func (tdata);
+      g_mutex_lock (&priv->lock);
+      continue;
+    }
+    /* drain the queues completely before honouring shutdown so that
+     * every pushed task still runs and joiners don't block forever */
+    if (worker->stopping || !priv->running)
+      break;
+    g_cond_wait (&priv->cond, &priv->lock);
+  }
+  g_mutex_unlock (&priv->lock);
+
+  return NULL;
+}
+
+/* Called with the pool lock */
+static void
+shared_worker_start (GstSharedTaskPool * pool)
+{
+  SharedWorker *worker;
+
+  worker = g_slice_new0 (SharedWorker);
+  worker->pool = pool;
+  g_queue_init (&worker->queue);
+  worker->thread = g_thread_new ("taskpool-worker",
+      (GThreadFunc) shared_worker_main, worker);
+  g_ptr_array_add (pool->priv->workers, worker);
+}
+
 static gpointer
 shared_push (GstTaskPool * pool, GstTaskPoolFunction func,
     gpointer user_data, GError ** error)
 {
+  GstSharedTaskPool *shared_pool = GST_SHARED_TASK_POOL_CAST (pool);
+  GstSharedTaskPoolPrivate *priv = shared_pool->priv;
   SharedTaskData *ret = NULL;
 
-  GST_OBJECT_LOCK (pool);
+  g_mutex_lock (&priv->lock);
 
-  if (!pool->pool) {
-    GST_OBJECT_UNLOCK (pool);
+  if (!priv->running) {
+    g_mutex_unlock (&priv->lock);
+    g_set_error_literal (error, GST_CORE_ERROR, GST_CORE_ERROR_FAILED,
+        "No thread pool");
     goto done;
   }
 
@@ -398,9 +492,19 @@ shared_push (GstTaskPool * pool, GstTaskPoolFunction func,
   g_cond_init (&ret->done_cond);
   g_mutex_init (&ret->done_lock);
 
-  g_thread_pool_push (pool->pool, shared_task_data_ref (ret), error);
+  if (priv->workers->len > 0) {
+    SharedWorker *worker;
 
-  GST_OBJECT_UNLOCK (pool);
+    priv->next_worker = (priv->next_worker + 1) % priv->workers->len;
+    worker = g_ptr_array_index (priv->workers, priv->next_worker);
+    g_queue_push_tail (&worker->queue, shared_task_data_ref (ret));
+  } else {
+    /* pool is frozen (max-threads == 0), keep the work for later */
+    g_queue_push_tail (&priv->pending, shared_task_data_ref (ret));
+  }
+  g_cond_broadcast (&priv->cond);
+
+  g_mutex_unlock (&priv->lock);
 
 done:
   return ret;
@@ -443,20 +547,76 @@ static void
 shared_prepare (GstTaskPool * pool, GError ** error)
 {
   GstSharedTaskPool *shared_pool = GST_SHARED_TASK_POOL_CAST (pool);
+  GstSharedTaskPoolPrivate *priv = shared_pool->priv;
+  guint i;
+
+  g_mutex_lock (&priv->lock);
+  priv->running = TRUE;
+  for (i = priv->workers->len; i < priv->max_threads; i++)
+    shared_worker_start (shared_pool);
+  g_mutex_unlock (&priv->lock);
+}
 
-  GST_OBJECT_LOCK (pool);
-  pool->pool =
-      g_thread_pool_new ((GFunc) shared_func, pool,
-      shared_pool->priv->max_threads, FALSE, error);
-  GST_OBJECT_UNLOCK (pool);
+static void
+shared_cleanup (GstTaskPool * pool)
+{
+  GstSharedTaskPool *shared_pool = GST_SHARED_TASK_POOL_CAST (pool);
+  GstSharedTaskPoolPrivate *priv = shared_pool->priv;
+  GPtrArray *workers;
+  SharedTaskData *tdata;
+  guint i;
+
+  g_mutex_lock (&priv->lock);
+  priv->running = FALSE;
+  workers = priv->workers;
+  priv->workers = g_ptr_array_new ();
+  /* a frozen pool can't process its backlog anymore, mark the queued
+   * work as done so joiners are not stuck forever */
+  while ((tdata = g_queue_pop_head (&priv->pending))) {
+    g_mutex_lock (&tdata->done_lock);
+    tdata->done = TRUE;
+    g_cond_signal (&tdata->done_cond);
+    g_mutex_unlock (&tdata->done_lock);
+    shared_task_data_unref (tdata);
+  }
+  g_cond_broadcast (&priv->cond);
+  g_mutex_unlock (&priv->lock);
+
+  /* wait for the workers to drain their queues and exit */
+  for (i = 0; i < workers->len; i++) {
+    SharedWorker *worker = g_ptr_array_index (workers, i);
+
+    g_thread_join (worker->thread);
+    g_slice_free (SharedWorker, worker);
+  }
+  g_ptr_array_unref (workers);
+}
+
+static void
+gst_shared_task_pool_finalize (GObject * object)
+{
+  GstSharedTaskPool *pool = GST_SHARED_TASK_POOL_CAST (object);
+  GstSharedTaskPoolPrivate *priv = pool->priv;
+
+  shared_cleanup (GST_TASK_POOL (object));
+
+  g_ptr_array_unref (priv->workers);
+  g_mutex_clear (&priv->lock);
+  g_cond_clear (&priv->cond);
+
+  G_OBJECT_CLASS (gst_shared_task_pool_parent_class)->finalize (object);
 }
 
 static void
 gst_shared_task_pool_class_init (GstSharedTaskPoolClass * klass)
 {
+  GObjectClass *gobject_class = (GObjectClass *) klass;
   GstTaskPoolClass *taskpoolclass = GST_TASK_POOL_CLASS (klass);
 
+  gobject_class->finalize = gst_shared_task_pool_finalize;
+
   taskpoolclass->prepare = shared_prepare;
+  taskpoolclass->cleanup = shared_cleanup;
   taskpoolclass->push = shared_push;
   taskpoolclass->join = shared_join;
   taskpoolclass->dispose_handle = shared_dispose_handle;
@@ -469,6 +629,10 @@ gst_shared_task_pool_init (GstSharedTaskPool * pool)
 
   priv = pool->priv = gst_shared_task_pool_get_instance_private (pool);
   priv->max_threads = 1;
+  g_mutex_init (&priv->lock);
+  g_cond_init (&priv->cond);
+  priv->workers = g_ptr_array_new ();
+  g_queue_init (&priv->pending);
 }
 
 /**
@@ -477,8 +641,8 @@ gst_shared_task_pool_init (GstSharedTaskPool * pool)
  * @max_threads: Maximum number of threads to spawn.
  *
  * Update the maximal number of threads the @pool may spawn. When
- * the maximal number of threads is reduced, existing threads are not
- * immediately shut down, see g_thread_pool_set_max_threads().
+ * the maximal number of threads is reduced, the surplus workers first
+ * finish the work already queued on them before shutting down.
  *
  * Setting @max_threads to 0 effectively freezes the pool.
  *
@@ -488,17 +652,44 @@ void
 gst_shared_task_pool_set_max_threads (GstSharedTaskPool * pool,
     guint max_threads)
 {
-  GstTaskPool *taskpool;
+  GstSharedTaskPoolPrivate *priv;
+  GPtrArray *stopped = NULL;
+  guint i;
 
   g_return_if_fail (GST_IS_SHARED_TASK_POOL (pool));
 
-  taskpool = GST_TASK_POOL (pool);
+  priv = pool->priv;
+
+  g_mutex_lock (&priv->lock);
+  priv->max_threads = max_threads;
+  if (priv->running) {
+    while (priv->workers->len < max_threads)
+      shared_worker_start (pool);
+    while (priv->workers->len > max_threads) {
+      SharedWorker *worker;
+
+      worker = g_ptr_array_index (priv->workers, priv->workers->len - 1);
+      g_ptr_array_remove_index (priv->workers, priv->workers->len - 1);
+      worker->stopping = TRUE;
+      if (stopped == NULL)
+        stopped = g_ptr_array_new ();
+      g_ptr_array_add (stopped, worker);
+    }
+    if (stopped)
+      g_cond_broadcast (&priv->cond);
+  }
+  g_mutex_unlock (&priv->lock);
 
-  GST_OBJECT_LOCK (pool);
-  if (taskpool->pool)
-    g_thread_pool_set_max_threads (taskpool->pool, max_threads, NULL);
-  pool->priv->max_threads = max_threads;
-  GST_OBJECT_UNLOCK (pool);
+  /* stopped workers finish their queued work and exit, wait for them */
+  if (stopped) {
+    for (i = 0; i < stopped->len; i++) {
+      SharedWorker *worker = g_ptr_array_index (stopped, i);
+
+      g_thread_join (worker->thread);
+      g_slice_free (SharedWorker, worker);
+    }
+    g_ptr_array_unref (stopped);
+  }
 }
 
 /**
@@ -515,9 +706,9 @@ gst_shared_task_pool_get_max_threads (GstSharedTaskPool * pool)
 
   g_return_val_if_fail (GST_IS_SHARED_TASK_POOL (pool), 0);
 
-  GST_OBJECT_LOCK (pool);
+  g_mutex_lock (&pool->priv->lock);
   ret = pool->priv->max_threads;
-  GST_OBJECT_UNLOCK (pool);
+  g_mutex_unlock (&pool->priv->lock);
 
   return ret;
 }
@@ -120,6 +120,7 @@ gst_type_find_factory_dispose (GObject * object)
     gst_caps_unref (factory->caps);
     factory->caps = NULL;
   }
+  g_clear_pointer (&factory->caps_string, g_free);
   if (factory->extensions) {
     g_strfreev (factory->extensions);
     factory->extensions = NULL;
@@ -166,6 +167,15 @@ gst_type_find_factory_get_caps (GstTypeFindFactory * factory)
 {
   g_return_val_if_fail (GST_IS_TYPE_FIND_FACTORY (factory), NULL);
 
+  /* factories loaded from the binary registry carry their caps in
+   * serialized form and parse them on first use */
+  if (G_UNLIKELY (factory->caps == NULL && factory->caps_string != NULL)) {
+    GST_OBJECT_LOCK (factory);
+    if (factory->caps == NULL)
+      factory->caps = gst_caps_from_string (factory->caps_string);
+    GST_OBJECT_UNLOCK (factory);
+  }
+
   return factory->caps;
 }
 
@@ -1892,13 +1892,14 @@ static void
 gst_value_init_fraction_range (GValue * value)
 {
   GValue *vals;
-  GType ftype;
-
-  ftype = GST_TYPE_FRACTION;
 
   value->data[0].v_pointer = vals = g_slice_alloc0 (2 * sizeof (GValue));
-  g_value_init (&vals[0], ftype);
-  g_value_init (&vals[1], ftype);
+  /* set up the two fraction values directly, going through g_value_init()
+   * would do a value table lookup per value just to store 0/1 */
+  vals[0].g_type = GST_TYPE_FRACTION;
+  vals[0].data[1].v_int = 1;
+  vals[1].g_type = GST_TYPE_FRACTION;
+  vals[1].data[1].v_int = 1;
 }
 
 static void
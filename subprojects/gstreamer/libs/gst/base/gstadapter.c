@@ -556,6 +556,59 @@ gst_adapter_map (GstAdapter * adapter, gsize size)
   return adapter->assembled_data;
 }
 
+/**
+ * gst_adapter_map_fast:
+ * @adapter: a #GstAdapter
+ * @size: (out): the number of bytes mapped
+ *
+ * Maps the largest contiguous region at the head of the @adapter without
+ * copying and stores its size in @size. Unlike gst_adapter_map(), this
+ * function never assembles data into a scratch buffer: the returned region
+ * is exactly gst_adapter_available_fast() bytes large.
+ *
+ * This is useful for parsers and demuxers that can consume their input
+ * incrementally: process as much of the returned region as possible,
+ * gst_adapter_flush() the consumed part, and only fall back to
+ * gst_adapter_map() for the (usually rare) element that straddles a buffer
+ * boundary. This way the bulk of the data is parsed in place.
+ *
+ * The returned pointer is valid until the next function is called on the
+ * adapter. Release the mapping with gst_adapter_unmap().
+ *
+ * Returns: (transfer none) (array length=size) (element-type guint8) (nullable):
+ *     a pointer to the first contiguous region of data, or %NULL if the
+ *     adapter is empty
+ *
+ * Since: 1.22
+ */
+gconstpointer
+gst_adapter_map_fast (GstAdapter * adapter, gsize * size)
+{
+  GstBuffer *cur;
+  gsize skip;
+
+  g_return_val_if_fail (GST_IS_ADAPTER (adapter), NULL);
+  g_return_val_if_fail (size != NULL, NULL);
+
+  if (adapter->info.memory)
+    gst_adapter_unmap (adapter);
+
+  *size = 0;
+
+  if (G_UNLIKELY (adapter->size == 0))
+    return NULL;
+
+  cur = gst_queue_array_peek_head (adapter->bufqueue);
+  skip = adapter->skip;
+
+  if (!gst_buffer_map (cur, &adapter->info, GST_MAP_READ))
+    return NULL;
+
+  *size = adapter->info.size - skip;
+
+  return (guint8 *) adapter->info.data + skip;
+}
+
 /**
  * gst_adapter_unmap:
  * @adapter: a #GstAdapter
@@ -66,6 +66,9 @@ gconstpointer           gst_adapter_map                 (GstAdapter *adapter, gs
 GST_BASE_API
 void                    gst_adapter_unmap               (GstAdapter *adapter);
 
+GST_BASE_API
+gconstpointer           gst_adapter_map_fast            (GstAdapter *adapter, gsize *size);
+
 GST_BASE_API
 void                    gst_adapter_copy                (GstAdapter *adapter, gpointer dest,
                                                          gsize offset, gsize size);
@@ -231,17 +231,24 @@ GST_DEBUG_CATEGORY_STATIC (aggregator_debug);
 #define SRC_WAIT(self) G_STMT_START {                               \
   GST_LOG_OBJECT (self, "Waiting for src on thread %p",             \
         g_thread_self());                                           \
+  self->priv->src_waiting = TRUE;                                   \
   g_cond_wait(&(self->priv->src_cond), &(self->priv->src_lock));    \
+  self->priv->src_waiting = FALSE;                                  \
   GST_LOG_OBJECT (self, "DONE Waiting for src on thread %p",        \
         g_thread_self());                                           \
   } G_STMT_END
 
+/* Called with the SRC_LOCK held, which also protects src_waiting. Only
+ * issue the (syscall-backed) broadcast when the src thread can actually
+ * be waiting on the condition; with many sinkpads most data arrivals
+ * find it busy aggregating or waiting on the clock instead. */
 #define SRC_BROADCAST(self) G_STMT_START {                          \
     GST_LOG_OBJECT (self, "Signaling src from thread %p",           \
         g_thread_self());                                           \
     if (self->priv->aggregate_id)                                   \
       gst_clock_id_unschedule (self->priv->aggregate_id);           \
-    g_cond_broadcast(&(self->priv->src_cond));                      \
+    if (self->priv->src_waiting)                                    \
+      g_cond_broadcast(&(self->priv->src_cond));                    \
   } G_STMT_END
 
 struct _GstAggregatorPadPrivate
@@ -390,6 +397,7 @@ struct _GstAggregatorPrivate
   gboolean selected_samples_called_or_warned;   /* protected by src_lock */
   GMutex src_lock;
   GCond src_cond;
+  gboolean src_waiting;         /* protected by src_lock */
 
   gboolean first_buffer;        /* protected by object lock */
   GstAggregatorStartTimeSelection start_time_selection;
@@ -4347,6 +4347,22 @@ gst_base_parse_find_frame (GstBaseParse * parse, gint64 * pos,
       "frame with time %" GST_TIME_FORMAT " at offset %" G_GINT64_FORMAT,
       GST_TIME_ARGS (*time), *pos);
 
+  /* remember what the scan just learned, so a subsequent seek around here
+   * can resume from the index rather than bisect the same region again;
+   * forced since scan probes do not arrive in ascending order */
+  if (GST_CLOCK_TIME_IS_VALID (*time) &&
+      !GST_BUFFER_FLAG_IS_SET (buf, GST_BUFFER_FLAG_DELTA_UNIT)) {
+    gint64 last_offset = parse->priv->index_last_offset;
+    GstClockTime last_ts = parse->priv->index_last_ts;
+
+    gst_base_parse_add_index_entry (parse, *pos, *time, TRUE, TRUE);
+    /* do not disturb ongoing linear collection; the index now holds
+     * entries from several disjoint intervals */
+    parse->priv->index_last_offset = last_offset;
+    parse->priv->index_last_ts = last_ts;
+    parse->priv->index_last_valid = FALSE;
+  }
+
 done:
   if (sframe)
     gst_base_parse_frame_free (sframe);
@@ -4367,8 +4383,8 @@ gst_base_parse_locate_time (GstBaseParse * parse, GstClockTime * _time,
     gint64 * _offset)
 {
   GstFlowReturn ret = GST_FLOW_OK;
-  gint64 lpos, hpos, newpos;
-  GstClockTime time, ltime, htime, newtime, dur;
+  gint64 lpos, hpos, newpos, idx_pos;
+  GstClockTime time, ltime, htime, newtime, dur, idx_time;
   gboolean cont = TRUE;
   const GstClockTime tolerance = TARGET_DIFFERENCE;
   const guint chunk = 4 * 1024;
@@ -4424,6 +4440,17 @@ gst_base_parse_locate_time (GstBaseParse * parse, GstClockTime * _time,
     return GST_FLOW_OK;
   }
 
+  /* resume from whatever previous playback and scans already collected in
+   * the index instead of bisecting all the way from the first frame */
+  idx_pos = gst_base_parse_find_offset (parse, time, TRUE, &idx_time);
+  if (idx_pos >= 0 && GST_CLOCK_TIME_IS_VALID (idx_time) &&
+      idx_time > ltime && idx_time <= time) {
+    GST_DEBUG_OBJECT (parse, "resuming scan from index entry %" GST_TIME_FORMAT
+        " at offset %" G_GINT64_FORMAT, GST_TIME_ARGS (idx_time), idx_pos);
+    lpos = idx_pos;
+    ltime = idx_time;
+  }
+
   /* shortcut cases */
   if (time < ltime) {
     goto exit;
@@ -278,6 +278,17 @@ struct _GstBaseSinkPrivate
   gsize rc_accumulated;
 
   gboolean drop_out_of_segment;
+
+  /* cached linear transform of the current segment, refreshed whenever the
+   * segment parameters change, so that the per-buffer running-time
+   * conversion in get_sync_times does not redo the rate division */
+  struct
+  {
+    gdouble rate;
+    guint64 start, offset, base;
+    guint64 rt_start;           /* start + offset */
+    gdouble inv_abs_rate;       /* 1.0 / ABS (rate) */
+  } segtrans;
 };
 
 #define DO_RUNNING_AVG(avg,val,size) (((val) + ((size)-1) * (avg)) / (size))
@@ -2056,6 +2067,52 @@ handle_stepping (GstBaseSink * sink, GstSegment * segment,
   return step_end;
 }
 
+/* with STREAM_LOCK, PREROLL_LOCK
+ *
+ * Fast equivalent of gst_segment_to_running_time() for the common
+ * forward-playback, in-segment case. The segment transform is cached as a
+ * (reciprocal, offset) pair and only recomputed when the segment changed, so
+ * the per-buffer conversion is a subtract and, for non-1.0 rates, a multiply
+ * instead of a division. All other cases take the generic conversion.
+ */
+static inline GstClockTime
+gst_base_sink_to_running_time (GstBaseSink * basesink,
+    const GstSegment * segment, GstFormat format, guint64 position)
+{
+  GstBaseSinkPrivate *priv = basesink->priv;
+  guint64 result;
+
+  if (G_UNLIKELY (segment->rate <= 0.0 || position == -1))
+    goto fallback;
+
+  /* refresh the cached transform when the segment changed */
+  if (G_UNLIKELY (segment->rate != priv->segtrans.rate
+          || segment->start != priv->segtrans.start
+          || segment->offset != priv->segtrans.offset
+          || segment->base != priv->segtrans.base)) {
+    priv->segtrans.rate = segment->rate;
+    priv->segtrans.start = segment->start;
+    priv->segtrans.offset = segment->offset;
+    priv->segtrans.base = segment->base;
+    priv->segtrans.rt_start = segment->start + segment->offset;
+    priv->segtrans.inv_abs_rate = 1.0 / ABS (segment->rate);
+  }
+
+  /* positions before the segment start go negative against the base, let
+   * the generic code sort that out */
+  if (G_UNLIKELY (position < priv->segtrans.rt_start))
+    goto fallback;
+
+  result = position - priv->segtrans.rt_start;
+  if (G_UNLIKELY (segment->rate != 1.0))
+    result = (guint64) (result * priv->segtrans.inv_abs_rate);
+
+  return result + segment->base;
+
+fallback:
+  return gst_segment_to_running_time (segment, format, position);
+}
+
 /* with STREAM_LOCK, PREROLL_LOCK
  *
  * Returns %TRUE if the object needs synchronisation and takes therefore
@@ -2201,8 +2258,8 @@ again:
     segment->position = cstart;
 
 do_times:
-  rstart = gst_segment_to_running_time (segment, format, cstart);
-  rstop = gst_segment_to_running_time (segment, format, cstop);
+  rstart = gst_base_sink_to_running_time (basesink, segment, format, cstart);
+  rstop = gst_base_sink_to_running_time (basesink, segment, format, cstop);
 
   /* In reverse playback, play from stop to start */
   if (segment->rate < 0.0 && GST_CLOCK_TIME_IS_VALID (rstop)
@@ -278,6 +278,8 @@ static GstFlowReturn gst_base_transform_getrange (GstPad * pad,
     GstObject * parent, guint64 offset, guint length, GstBuffer ** buffer);
 static GstFlowReturn gst_base_transform_chain (GstPad * pad, GstObject * parent,
     GstBuffer * buffer);
+static GstFlowReturn gst_base_transform_chain_list (GstPad * pad,
+    GstObject * parent, GstBufferList * list);
 static GstCaps *gst_base_transform_default_transform_caps (GstBaseTransform *
     trans, GstPadDirection direction, GstCaps * caps, GstCaps * filter);
 static GstCaps *gst_base_transform_default_fixate_caps (GstBaseTransform *
@@ -390,6 +392,8 @@ gst_base_transform_init (GstBaseTransform * trans,
       GST_DEBUG_FUNCPTR (gst_base_transform_sink_event));
   gst_pad_set_chain_function (trans->sinkpad,
       GST_DEBUG_FUNCPTR (gst_base_transform_chain));
+  gst_pad_set_chain_list_function (trans->sinkpad,
+      GST_DEBUG_FUNCPTR (gst_base_transform_chain_list));
   gst_pad_set_activatemode_function (trans->sinkpad,
       GST_DEBUG_FUNCPTR (gst_base_transform_sink_activate_mode));
   gst_pad_set_query_function (trans->sinkpad,
@@ -2298,12 +2302,15 @@ pull_error:
 /* The flow of the chain function is the reverse of the
  * getrange() function - we have data, feed it to the sub-class
  * and then iterate, pushing buffers it generates until it either
- * wants more data or returns an error */
+ * wants more data or returns an error.
+ *
+ * When @outlist is non-NULL, generated buffers are collected there
+ * instead of being pushed; the caller then pushes the whole list
+ * downstream in one go. */
 static GstFlowReturn
-gst_base_transform_chain (GstPad * pad, GstObject * parent, GstBuffer * buffer)
+gst_base_transform_chain_one (GstBaseTransform * trans,
+    GstBaseTransformClass * klass, GstBuffer * buffer, GstBufferList * outlist)
 {
-  GstBaseTransform *trans = GST_BASE_TRANSFORM_CAST (parent);
-  GstBaseTransformClass *klass = GST_BASE_TRANSFORM_GET_CLASS (trans);
   GstBaseTransformPrivate *priv = trans->priv;
   GstFlowReturn ret;
   GstClockTime position = GST_CLOCK_TIME_NONE;
@@ -2374,7 +2381,10 @@ gst_base_transform_chain (GstPad * pad, GstObject * parent, GstBuffer * buffer)
         }
         priv->processed++;
 
-        ret = gst_pad_push (trans->srcpad, outbuf);
+        if (outlist != NULL)
+          gst_buffer_list_add (outlist, outbuf);
+        else
+          ret = gst_pad_push (trans->srcpad, outbuf);
       } else {
         GST_DEBUG_OBJECT (trans, "we got return %s", gst_flow_get_name (ret));
         gst_buffer_unref (outbuf);
@@ -2393,6 +2403,51 @@ done:
   return ret;
 }
 
+static GstFlowReturn
+gst_base_transform_chain (GstPad * pad, GstObject * parent, GstBuffer * buffer)
+{
+  GstBaseTransform *trans = GST_BASE_TRANSFORM_CAST (parent);
+  GstBaseTransformClass *klass = GST_BASE_TRANSFORM_GET_CLASS (trans);
+
+  return gst_base_transform_chain_one (trans, klass, buffer, NULL);
+}
+
+/* Process a whole buffer list in one go and push the generated buffers
+ * downstream as a list again. This keeps lists intact across transform
+ * elements so the per-buffer pad push overhead is only paid once per
+ * batch instead of once per buffer. */
+static GstFlowReturn
+gst_base_transform_chain_list (GstPad * pad, GstObject * parent,
+    GstBufferList * list)
+{
+  GstBaseTransform *trans = GST_BASE_TRANSFORM_CAST (parent);
+  GstBaseTransformClass *klass = GST_BASE_TRANSFORM_GET_CLASS (trans);
+  GstBufferList *outlist;
+  GstFlowReturn ret = GST_FLOW_OK;
+  guint i, len;
+
+  len = gst_buffer_list_length (list);
+
+  GST_LOG_OBJECT (trans, "chaining list with %u buffers", len);
+
+  outlist = gst_buffer_list_new_sized (len);
+
+  for (i = 0; i < len && ret == GST_FLOW_OK; i++) {
+    GstBuffer *buffer = gst_buffer_list_get (list, i);
+
+    ret = gst_base_transform_chain_one (trans, klass,
+        gst_buffer_ref (buffer), outlist);
+  }
+  gst_buffer_list_unref (list);
+
+  if (ret == GST_FLOW_OK && gst_buffer_list_length (outlist) > 0)
+    ret = gst_pad_push_list (trans->srcpad, outlist);
+  else
+    gst_buffer_list_unref (outlist);
+
+  return ret;
+}
+
 static void
 gst_base_transform_set_property (GObject * object, guint prop_id,
     const GValue * value, GParamSpec * pspec)
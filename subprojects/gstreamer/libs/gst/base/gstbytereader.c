@@ -870,6 +870,22 @@ _scan_for_start_code (const guint8 * data, guint size)
   guint8 *pend = (guint8 *) (data + size - 4);
 
   while (pdata <= pend) {
+    /* a start code begins with a zero byte, so whole words without any
+     * zero byte can be skipped with the usual has-zero-byte bit trick.
+     * memcpy keeps the load alignment-safe and compiles to a plain
+     * (unaligned) move on the usual targets. */
+    while (pdata + 8 <= pend) {
+      guint64 w;
+
+      memcpy (&w, pdata, 8);
+      if ((w - G_GUINT64_CONSTANT (0x0101010101010101)) & ~w &
+          G_GUINT64_CONSTANT (0x8080808080808080))
+        break;
+      pdata += 8;
+    }
+    if (pdata > pend)
+      break;
+
     if (pdata[2] > 1) {
       pdata += 3;
     } else if (pdata[1]) {
@@ -916,6 +932,31 @@ _masked_scan_uint32_peek (const GstByteReader * reader,
     return ret + offset;
   }
 
+  /* when the first pattern byte is fully masked, let memchr() - which
+   * is vectorized in every modern libc - skip ahead to candidate
+   * positions instead of feeding each byte through the shift register */
+  if ((mask & 0xff000000) == 0xff000000) {
+    const guint8 first = pattern >> 24;
+    guint pos = 0;
+
+    while (pos + 4 <= size) {
+      const guint8 *cand = memchr (data + pos, first, size - 3 - pos);
+      guint32 v;
+
+      if (cand == NULL)
+        break;
+      pos = cand - data;
+      v = GST_READ_UINT32_BE (cand);
+      if ((v & mask) == pattern) {
+        if (value)
+          *value = v;
+        return offset + pos;
+      }
+      pos++;
+    }
+    return -1;
+  }
+
   /* set the state to something that does not match */
   state = ~pattern;
 
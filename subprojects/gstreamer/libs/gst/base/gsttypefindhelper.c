@@ -41,6 +41,36 @@
 
 #include "gsttypefindhelper.h"
 
+/* list of all typefind factories sorted by rank, cached between calls so
+ * that repeated typefinding does not filter and sort the registry features
+ * over and over again. Invalidated with the registry feature list cookie. */
+G_LOCK_DEFINE_STATIC (type_find_factories);
+static GList *type_find_factories = NULL;       /* protected by above lock */
+static guint32 type_find_factories_cookie = 0;  /* protected by above lock */
+
+static GList *
+get_type_find_factory_list (void)
+{
+  GstRegistry *registry;
+  guint32 cookie;
+  GList *list;
+
+  registry = gst_registry_get ();
+  cookie = gst_registry_get_feature_list_cookie (registry);
+
+  G_LOCK (type_find_factories);
+  if (type_find_factories == NULL || type_find_factories_cookie != cookie) {
+    gst_plugin_feature_list_free (type_find_factories);
+    type_find_factories = gst_type_find_factory_get_list ();
+    type_find_factories_cookie = cookie;
+  }
+  /* callers reorder and free their list, hand out a copy */
+  list = gst_plugin_feature_list_copy (type_find_factories);
+  G_UNLOCK (type_find_factories);
+
+  return list;
+}
+
 /* ********************** typefinding in pull mode ************************ */
 
 static void
@@ -409,7 +439,7 @@ gst_type_find_helper_get_range_full (GstObject * obj, GstObject * parent,
     find.get_length = helper_find_get_length;
   }
 
-  type_list = gst_type_find_factory_get_list ();
+  type_list = get_type_find_factory_list ();
   type_list = prioritize_extension (obj, type_list, extension);
 
   for (l = type_list; l; l = l->next) {
@@ -658,7 +688,7 @@ gst_type_find_helper_for_data_with_extension (GstObject * obj,
   find.suggest = buf_helper_find_suggest;
   find.get_length = NULL;
 
-  type_list = gst_type_find_factory_get_list ();
+  type_list = get_type_find_factory_list ();
   type_list = prioritize_extension (obj, type_list, extension);
 
   for (l = type_list; l; l = l->next) {
@@ -793,7 +823,7 @@ gst_type_find_helper_for_extension (GstObject * obj, const gchar * extension)
 
   GST_LOG_OBJECT (obj, "finding caps for extension %s", extension);
 
-  type_list = gst_type_find_factory_get_list ();
+  type_list = get_type_find_factory_list ();
 
   for (l = type_list; l; l = g_list_next (l)) {
     GstTypeFindFactory *factory;
@@ -128,6 +128,7 @@
 #include "gstharness.h"
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <math.h>
 
@@ -3515,3 +3516,102 @@ gst_harness_stress_requestpad_start_full (GstHarness * h,
   GST_HARNESS_THREAD_START (requestpad, t);
   return &t->t;
 }
+
+/* Benchmarking */
+
+static gint
+harness_benchmark_compare_times (gconstpointer a, gconstpointer b)
+{
+  GstClockTime ta = *(const GstClockTime *) a;
+  GstClockTime tb = *(const GstClockTime *) b;
+
+  if (ta < tb)
+    return -1;
+  return ta > tb;
+}
+
+static GstClockTime
+harness_benchmark_percentile (const GstClockTime * sorted, guint n, guint p)
+{
+  return sorted[(p * (n - 1)) / 100];
+}
+
+/**
+ * gst_harness_benchmark:
+ * @h: a #GstHarness
+ * @func: a #GstHarnessPrepareBufferFunc producing the buffer to push for
+ * each iteration
+ * @data: user data for @func
+ * @warmup: number of untimed buffers to push before measuring
+ * @iterations: number of timed buffers to push
+ *
+ * Push @warmup + @iterations buffers produced by @func through the harnessed
+ * element, draining any produced output after each push, and time each of the
+ * measured iterations. The warmup rounds let caches, pools and threads settle
+ * so they don't skew the measurement.
+ *
+ * MT safe.
+ *
+ * Returns: (transfer full): a #GstStructure with the fields @iterations
+ * (guint), @total-time (guint64, nanoseconds), @buffers-per-second (gdouble)
+ * and the per-buffer times in nanoseconds @mean, @min, @max, @p50, @p90 and
+ * @p99 (all guint64)
+ *
+ * Since: 1.22
+ */
+GstStructure *
+gst_harness_benchmark (GstHarness * h, GstHarnessPrepareBufferFunc func,
+    gpointer data, guint warmup, guint iterations)
+{
+  GstClockTime *times;
+  GstClockTime total = 0;
+  GstStructure *s;
+  GstBuffer *buf;
+  guint i;
+
+  g_return_val_if_fail (h != NULL, NULL);
+  g_return_val_if_fail (func != NULL, NULL);
+  g_return_val_if_fail (iterations > 0, NULL);
+
+  for (i = 0; i < warmup; i++) {
+    gst_harness_push (h, func (h, data));
+    while ((buf = gst_harness_try_pull (h)) != NULL)
+      gst_buffer_unref (buf);
+  }
+
+  times = g_new (GstClockTime, iterations);
+
+  for (i = 0; i < iterations; i++) {
+    GstBuffer *in = func (h, data);
+    GstClockTime start = gst_util_get_timestamp ();
+
+    gst_harness_push (h, in);
+    while ((buf = gst_harness_try_pull (h)) != NULL)
+      gst_buffer_unref (buf);
+
+    times[i] = gst_util_get_timestamp () - start;
+    total += times[i];
+  }
+
+  qsort (times, iterations, sizeof (GstClockTime),
+      harness_benchmark_compare_times);
+
+  s = gst_structure_new ("harness-benchmark",
+      "iterations", G_TYPE_UINT, iterations,
+      "total-time", G_TYPE_UINT64, (guint64) total,
+      "buffers-per-second", G_TYPE_DOUBLE,
+      total > 0 ? (gdouble) iterations * GST_SECOND / (gdouble) total : 0.0,
+      "mean", G_TYPE_UINT64, (guint64) (total / iterations),
+      "min", G_TYPE_UINT64, (guint64) times[0],
+      "max", G_TYPE_UINT64, (guint64) times[iterations - 1],
+      "p50", G_TYPE_UINT64,
+      (guint64) harness_benchmark_percentile (times, iterations, 50),
+      "p90", G_TYPE_UINT64,
+      (guint64) harness_benchmark_percentile (times, iterations, 90),
+      "p99", G_TYPE_UINT64,
+      (guint64) harness_benchmark_percentile (times, iterations, 99), NULL);
+
+  g_free (times);
+
+  return s;
+}
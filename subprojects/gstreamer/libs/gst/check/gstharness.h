@@ -469,6 +469,15 @@ GstHarnessThread * gst_harness_stress_requestpad_start_full (GstHarness     * h,
                                                              gboolean         release,
                                                              gulong           sleep);
 
+/* Benchmarking */
+
+GST_CHECK_API
+GstStructure * gst_harness_benchmark (GstHarness * h,
+                                      GstHarnessPrepareBufferFunc func,
+                                      gpointer     data,
+                                      guint        warmup,
+                                      guint        iterations);
+
 G_END_DECLS
 
 #endif /* __GST_HARNESS_H__ */
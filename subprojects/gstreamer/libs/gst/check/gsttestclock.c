@@ -183,7 +183,8 @@ enum
 {
   PROP_0,
   PROP_START_TIME,
-  PROP_CLOCK_TYPE
+  PROP_CLOCK_TYPE,
+  PROP_AUTO_ADVANCE
 };
 
 typedef struct _GstClockEntryContext GstClockEntryContext;
@@ -199,6 +200,7 @@ struct _GstTestClockPrivate
   GstClockType clock_type;
   GstClockTime start_time;
   GstClockTime internal_time;
+  gboolean auto_advance;
   GList *entry_contexts;
   GCond entry_added_cond;
   GCond entry_processed_cond;
@@ -249,6 +251,9 @@ static void gst_test_clock_remove_entry (GstTestClock * test_clock,
 static GstClockEntryContext *gst_test_clock_lookup_entry_context (GstTestClock *
     test_clock, GstClockEntry * clock_entry);
 
+static gboolean gst_test_clock_auto_advance_unlocked (GstTestClock * test_clock,
+    GstClockEntry * entry);
+
 static gint gst_clock_entry_context_compare_func (gconstpointer a,
     gconstpointer b);
 
@@ -295,6 +300,28 @@ gst_test_clock_class_init (GstTestClockClass * klass)
           GST_TYPE_CLOCK_TYPE, DEFAULT_CLOCK_TYPE,
           G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
 
+  /**
+   * GstTestClock:auto-advance:
+   *
+   * When %TRUE, a thread waiting synchronously on the clock advances the
+   * clock to its own entry as soon as no earlier synchronous wait is
+   * pending, processing any earlier asynchronous entries on the way. Time-
+   * dependent scenarios then run in virtual time without any manual
+   * cranking.
+   *
+   * Threads that are busy for other reasons than waiting on the clock are
+   * not taken into account, so tests that depend on real-time interleaving
+   * of such threads with clock waits should keep driving the clock
+   * manually with gst_test_clock_crank() instead.
+   *
+   * Since: 1.22
+   */
+  g_object_class_install_property (gobject_class, PROP_AUTO_ADVANCE,
+      g_param_spec_boolean ("auto-advance", "Auto advance",
+          "Automatically advance the clock to the earliest pending entry "
+          "whenever no earlier synchronous wait is pending",
+          FALSE, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+
 }
 
 static void
@@ -372,6 +399,11 @@ gst_test_clock_get_property (GObject * object, guint property_id,
     case PROP_CLOCK_TYPE:
       g_value_set_enum (value, priv->clock_type);
       break;
+    case PROP_AUTO_ADVANCE:
+      GST_OBJECT_LOCK (test_clock);
+      g_value_set_boolean (value, priv->auto_advance);
+      GST_OBJECT_UNLOCK (test_clock);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
       break;
@@ -397,6 +429,16 @@ gst_test_clock_set_property (GObject * object, guint property_id,
       GST_CAT_DEBUG (GST_CAT_TEST_CLOCK, "clock-type set to %d",
           priv->clock_type);
       break;
+    case PROP_AUTO_ADVANCE:
+      GST_OBJECT_LOCK (test_clock);
+      priv->auto_advance = g_value_get_boolean (value);
+      GST_CAT_DEBUG (GST_CAT_TEST_CLOCK, "auto-advance set to %d",
+          priv->auto_advance);
+      /* wake up synchronous waiters so they re-evaluate whether they should
+       * advance the clock themselves */
+      g_cond_broadcast (&priv->entry_processed_cond);
+      GST_OBJECT_UNLOCK (test_clock);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, property_id, pspec);
       break;
@@ -450,8 +492,12 @@ gst_test_clock_wait (GstClock * clock,
 
   GST_CLOCK_ENTRY_STATUS (entry) = GST_CLOCK_BUSY;
 
-  while (GST_CLOCK_ENTRY_STATUS (entry) == GST_CLOCK_BUSY)
+  while (GST_CLOCK_ENTRY_STATUS (entry) == GST_CLOCK_BUSY) {
+    if (priv->auto_advance &&
+        gst_test_clock_auto_advance_unlocked (test_clock, entry))
+      continue;
     g_cond_wait (&priv->entry_processed_cond, GST_OBJECT_GET_LOCK (test_clock));
+  }
 
   GST_OBJECT_UNLOCK (test_clock);
 
@@ -640,6 +686,43 @@ process_entry_context_unlocked (GstTestClock * test_clock,
   }
 }
 
+/* Advance the clock on behalf of a synchronously waiting thread. The waiter
+ * may only make progress once no other synchronous wait is pending at an
+ * earlier time; until then the earlier waiter is responsible for advancing
+ * the clock. Asynchronous entries scheduled before the waiter's own entry
+ * are processed on the way. Returns TRUE if an entry was processed, FALSE
+ * if the caller has to wait for another thread to make progress first. */
+static gboolean
+gst_test_clock_auto_advance_unlocked (GstTestClock * test_clock,
+    GstClockEntry * entry)
+{
+  GstTestClockPrivate *priv = GST_TEST_CLOCK_GET_PRIVATE (test_clock);
+  GstClockEntryContext *ctx;
+  GstClockTime entry_time;
+
+  if (priv->entry_contexts == NULL)
+    return FALSE;
+
+  ctx = priv->entry_contexts->data;
+
+  if (ctx->clock_entry != entry &&
+      GST_CLOCK_ENTRY_STATUS (ctx->clock_entry) == GST_CLOCK_BUSY)
+    return FALSE;
+
+  entry_time = GST_CLOCK_ENTRY_TIME (ctx->clock_entry);
+  if (GST_CLOCK_TIME_IS_VALID (entry_time)
+      && entry_time > priv->internal_time) {
+    GST_CAT_DEBUG_OBJECT (GST_CAT_TEST_CLOCK, test_clock,
+        "auto-advancing clock to %" GST_TIME_FORMAT,
+        GST_TIME_ARGS (entry_time));
+    priv->internal_time = entry_time;
+  }
+
+  process_entry_context_unlocked (test_clock, ctx);
+
+  return TRUE;
+}
+
 static GList *
 gst_test_clock_get_pending_id_list_unlocked (GstTestClock * test_clock)
 {
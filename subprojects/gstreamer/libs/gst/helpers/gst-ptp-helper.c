@@ -90,6 +90,7 @@ have_socket_data_cb (GSocket * socket, GIOCondition condition,
     gpointer user_data)
 {
   gchar buffer[8192];
+  guint8 receive_time_data[8];
   gssize read;
   gsize written;
   GError *err = NULL;
@@ -101,11 +102,17 @@ have_socket_data_cb (GSocket * socket, GIOCondition condition,
     g_error ("Failed to read from socket: %s", err->message);
   g_clear_error (&err);
 
+  /* Take the receive timestamp right after the socket read; the process on
+   * the other side of the pipe would only be able to take it after pipe
+   * transfer and scheduling latency */
+  GST_WRITE_UINT64_BE (receive_time_data,
+      (guint64) g_get_monotonic_time () * 1000);
+
   if (verbose)
     g_message ("Received %" G_GSSIZE_FORMAT " bytes from %s socket", read,
         (socket == socket_event ? "event" : "general"));
 
-  header.size = read;
+  header.size = read + sizeof (receive_time_data);
   header.type = (socket == socket_event) ? TYPE_EVENT : TYPE_GENERAL;
 
   status =
@@ -123,6 +130,21 @@ have_socket_data_cb (GSocket * socket, GIOCondition condition,
     g_error ("Unexpected write size: %" G_GSIZE_FORMAT, written);
   }
 
+  status =
+      g_io_channel_write_chars (stdout_channel, (gchar *) receive_time_data,
+      sizeof (receive_time_data), &written, &err);
+  if (status == G_IO_STATUS_ERROR) {
+    g_error ("Failed to write to stdout: %s", err->message);
+    g_clear_error (&err);
+  } else if (status == G_IO_STATUS_EOF) {
+    g_message ("EOF on stdout");
+    exit (0);
+  } else if (status != G_IO_STATUS_NORMAL) {
+    g_error ("Unexpected stdout write status: %d", status);
+  } else if (written != sizeof (receive_time_data)) {
+    g_error ("Unexpected write size: %" G_GSIZE_FORMAT, written);
+  }
+
   status =
       g_io_channel_write_chars (stdout_channel, buffer, read, &written, &err);
   if (status == G_IO_STATUS_ERROR) {
@@ -67,6 +67,13 @@
 
 #include <string.h>
 
+#ifdef __linux__
+#include <errno.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <time.h>
+#endif
+
 GST_DEBUG_CATEGORY_STATIC (ncc_debug);
 #define GST_CAT_DEFAULT (ncc_debug)
 
@@ -113,6 +120,17 @@ G_GNUC_INTERNAL GType gst_net_client_internal_clock_get_type (void);
 
 #define MEDIAN_PRE_FILTERING_WINDOW 9
 
+/* On Linux the kernel timestamps incoming packets for us. Using that
+ * timestamp instead of the time at which our thread got around to reading
+ * the packet removes the scheduling jitter from the local receive time of
+ * each observation. */
+#if defined (__linux__) && defined (SIOCGSTAMPNS) && defined (SO_TIMESTAMPNS)
+#define USE_KERNEL_RX_TIMESTAMPS 1
+/* Discard kernel timestamps that are implausibly old, e.g. because the
+ * realtime clock was stepped between packet arrival and processing */
+#define MAX_RX_QUEUING_DELAY (10 * GST_MSECOND)
+#endif
+
 enum
 {
   PROP_0,
@@ -651,6 +669,46 @@ bogus_observation:
   return;
 }
 
+#ifdef USE_KERNEL_RX_TIMESTAMPS
+static void
+gst_net_client_internal_clock_enable_rx_timestamps (GSocket * socket)
+{
+  gint fd = g_socket_get_fd (socket);
+  gint on = 1;
+
+  if (setsockopt (fd, SOL_SOCKET, SO_TIMESTAMPNS, &on, sizeof (on)) < 0)
+    GST_DEBUG ("could not enable kernel receive timestamps: %s",
+        g_strerror (errno));
+}
+
+/* Returns a refined local receive time for the packet that was just read
+ * from @socket, based on the time at which the kernel recorded its arrival,
+ * or @fallback if no usable kernel timestamp is available */
+static GstClockTime
+gst_net_client_internal_clock_refine_local_time (GstNetClientInternalClock *
+    self, GSocket * socket, GstClockTime fallback)
+{
+  struct timespec pkt_ts, now_ts;
+  GstClockTimeDiff queuing_delay;
+
+  if (ioctl (g_socket_get_fd (socket), SIOCGSTAMPNS, &pkt_ts) < 0)
+    return fallback;
+
+  if (clock_gettime (CLOCK_REALTIME, &now_ts) != 0)
+    return fallback;
+
+  queuing_delay =
+      GST_TIMESPEC_TO_TIME (now_ts) - GST_TIMESPEC_TO_TIME (pkt_ts);
+  if (queuing_delay < 0 || queuing_delay > MAX_RX_QUEUING_DELAY)
+    return fallback;
+
+  GST_TRACE_OBJECT (self, "packet waited %" GST_STIME_FORMAT
+      " between arrival and processing", GST_STIME_ARGS (queuing_delay));
+
+  return gst_clock_get_internal_time (GST_CLOCK_CAST (self)) - queuing_delay;
+}
+#endif
+
 static gpointer
 gst_net_client_internal_clock_thread (gpointer data)
 {
@@ -752,6 +810,10 @@ gst_net_client_internal_clock_thread (gpointer data)
         packet = gst_ntp_packet_receive (socket, NULL, &err);
 
         if (packet != NULL) {
+#ifdef USE_KERNEL_RX_TIMESTAMPS
+          new_local = gst_net_client_internal_clock_refine_local_time (self,
+              socket, new_local);
+#endif
           GST_LOG_OBJECT (self, "got packet back");
           GST_LOG_OBJECT (self, "local_1 = %" GST_TIME_FORMAT,
               GST_TIME_ARGS (packet->origin_time));
@@ -807,6 +869,10 @@ gst_net_client_internal_clock_thread (gpointer data)
         packet = gst_net_time_packet_receive (socket, NULL, &err);
 
         if (packet != NULL) {
+#ifdef USE_KERNEL_RX_TIMESTAMPS
+          new_local = gst_net_client_internal_clock_refine_local_time (self,
+              socket, new_local);
+#endif
           GST_LOG_OBJECT (self, "got packet back");
           GST_LOG_OBJECT (self, "local_1 = %" GST_TIME_FORMAT,
               GST_TIME_ARGS (packet->local_time));
@@ -880,6 +946,10 @@ gst_net_client_internal_clock_start (GstNetClientInternalClock * self)
   if (socket == NULL)
     goto no_socket;
 
+#ifdef USE_KERNEL_RX_TIMESTAMPS
+  gst_net_client_internal_clock_enable_rx_timestamps (socket);
+#endif
+
   GST_DEBUG_OBJECT (self, "binding socket");
   inetaddr = g_inet_address_new_any (family);
   anyaddr = g_inet_socket_address_new (inetaddr, 0);
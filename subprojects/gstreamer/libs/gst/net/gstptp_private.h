@@ -3,6 +3,9 @@
 
 #include <glib.h>
 
+/* TYPE_EVENT and TYPE_GENERAL packets are prefixed with the monotonic
+ * receive timestamp (8 bytes, big endian, in nanoseconds) taken by the
+ * helper right after the socket read */
 enum
 {
   TYPE_EVENT,
@@ -1845,10 +1845,25 @@ have_stdin_data_cb (GIOChannel * channel, GIOCondition condition,
   switch (header.type) {
     case TYPE_EVENT:
     case TYPE_GENERAL:{
-      GstClockTime receive_time = gst_clock_get_time (observation_system_clock);
+      GstClockTime receive_time;
       PtpMessage msg;
 
-      if (parse_ptp_message (&msg, (const guint8 *) buffer, header.size)) {
+      if (header.size < 8) {
+        GST_ERROR ("Unexpected packet size (%u < 8)", header.size);
+        g_main_loop_quit (main_loop);
+        return G_SOURCE_REMOVE;
+      }
+
+      /* The helper prefixes every packet with the receive timestamp it took
+       * right after the socket read, from the same monotonic clock the
+       * observation system clock uses. This keeps pipe transfer and
+       * scheduling latency out of the observations */
+      receive_time = GST_READ_UINT64_BE (buffer);
+      if (receive_time == 0)
+        receive_time = gst_clock_get_time (observation_system_clock);
+
+      if (parse_ptp_message (&msg, (const guint8 *) buffer + 8,
+              header.size - 8)) {
         dump_ptp_message (&msg);
         handle_ptp_message (&msg, receive_time);
       }
@@ -267,6 +267,10 @@ gst_capsfilter_dispose (GObject * object)
   GstCapsFilter *filter = GST_CAPS_FILTER (object);
 
   gst_caps_replace (&filter->filter_caps, NULL);
+  gst_caps_replace (&filter->cached_caps, NULL);
+  gst_caps_replace (&filter->cached_filter, NULL);
+  gst_caps_replace (&filter->cached_filter_caps, NULL);
+  gst_caps_replace (&filter->cached_ret, NULL);
   g_list_free_full (filter->pending_events, (GDestroyNotify) gst_event_unref);
   filter->pending_events = NULL;
 
@@ -278,7 +282,7 @@ gst_capsfilter_transform_caps (GstBaseTransform * base,
     GstPadDirection direction, GstCaps * caps, GstCaps * filter)
 {
   GstCapsFilter *capsfilter = GST_CAPS_FILTER (base);
-  GstCaps *ret, *filter_caps, *tmp;
+  GstCaps *ret, *filter_caps, *orig_filter_caps, *tmp;
   gboolean retried = FALSE;
   GstCapsFilterCapsChangeMode caps_change_mode;
 
@@ -286,8 +290,23 @@ gst_capsfilter_transform_caps (GstBaseTransform * base,
   filter_caps = gst_caps_ref (capsfilter->filter_caps);
   capsfilter->filter_caps_used = TRUE;
   caps_change_mode = capsfilter->caps_change_mode;
+
+  /* caps are immutable, so identical pointers pose an identical problem;
+   * reconfigure storms ask the same question over and over again */
+  if (capsfilter->cached_ret && capsfilter->cached_caps == caps
+      && capsfilter->cached_filter == filter
+      && capsfilter->cached_filter_caps == filter_caps) {
+    ret = gst_caps_ref (capsfilter->cached_ret);
+    GST_OBJECT_UNLOCK (capsfilter);
+    gst_caps_unref (filter_caps);
+    GST_LOG_OBJECT (capsfilter, "reusing cached intersection %" GST_PTR_FORMAT,
+        ret);
+    return ret;
+  }
   GST_OBJECT_UNLOCK (capsfilter);
 
+  orig_filter_caps = gst_caps_ref (filter_caps);
+
 retry:
   if (filter) {
     tmp =
@@ -326,6 +345,18 @@ retry:
 
   gst_caps_unref (filter_caps);
 
+  /* remember the result; the DELAYED retry path depends on the mutable
+   * previous-caps list, so only plain results are kept */
+  if (!retried) {
+    GST_OBJECT_LOCK (capsfilter);
+    gst_caps_replace (&capsfilter->cached_caps, caps);
+    gst_caps_replace (&capsfilter->cached_filter, filter);
+    gst_caps_replace (&capsfilter->cached_filter_caps, orig_filter_caps);
+    gst_caps_replace (&capsfilter->cached_ret, ret);
+    GST_OBJECT_UNLOCK (capsfilter);
+  }
+  gst_caps_unref (orig_filter_caps);
+
   return ret;
 }
 
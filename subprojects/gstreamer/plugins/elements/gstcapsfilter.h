@@ -71,6 +71,13 @@ struct _GstCapsFilter {
 
   GList *pending_events;
   GList *previous_caps;
+
+  /* memo of the last transform_caps result, keyed on the (immutable) caps
+   * identities; protected by the object lock */
+  GstCaps *cached_caps;
+  GstCaps *cached_filter;
+  GstCaps *cached_filter_caps;
+  GstCaps *cached_ret;
 };
 
 struct _GstCapsFilterClass {
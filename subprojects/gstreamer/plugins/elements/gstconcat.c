@@ -75,6 +75,11 @@ struct _GstConcatPad
 
   /* Protected by the concat lock */
   gboolean flushing;
+
+  /* TRUE when sticky events were accepted while this pad was not the
+   * current sinkpad and still have to be sent downstream. Only used from
+   * this pad's streaming thread */
+  gboolean pending_stickies;
 };
 
 struct _GstConcatPadClass
@@ -94,6 +99,7 @@ gst_concat_pad_init (GstConcatPad * self)
 {
   gst_segment_init (&self->segment, GST_FORMAT_UNDEFINED);
   self->flushing = FALSE;
+  self->pending_stickies = FALSE;
 }
 
 static GstStaticPadTemplate sink_template = GST_STATIC_PAD_TEMPLATE ("sink_%u",
@@ -425,6 +431,82 @@ gst_concat_pad_wait (GstConcatPad * spad, GstConcat * self)
   return TRUE;
 }
 
+/* Like gst_concat_pad_wait() but never blocks: returns whether the pad is
+ * (or, as the sole sinkpad, just became) the current sinkpad */
+static gboolean
+gst_concat_pad_is_current (GstConcat * self, GstConcatPad * spad)
+{
+  gboolean is_current;
+
+  g_mutex_lock (&self->lock);
+  if (self->current_sinkpad == NULL && g_list_length (self->sinkpads) == 1)
+    self->current_sinkpad = gst_object_ref (self->sinkpads->data);
+  is_current = (spad == GST_CONCAT_PAD_CAST (self->current_sinkpad));
+  g_mutex_unlock (&self->lock);
+
+  return is_current;
+}
+
+static gboolean
+forward_sticky (GstPad * pad, GstEvent ** event, gpointer user_data)
+{
+  GstConcat *self = user_data;
+  GstConcatPad *spad = GST_CONCAT_PAD_CAST (pad);
+  GstEvent *fwd;
+
+  /* EOS is handled separately by the event function */
+  if (GST_EVENT_TYPE (*event) == GST_EVENT_EOS)
+    return TRUE;
+
+  g_mutex_lock (&self->lock);
+  if (GST_EVENT_TYPE (*event) == GST_EVENT_SEGMENT) {
+    /* Build our own segment, as the event function does for the current
+     * sinkpad */
+    GstSegment segment = spad->segment;
+
+    if (self->adjust_base) {
+      segment.duration = -1;
+      if (self->format == GST_FORMAT_TIME) {
+        segment.base += self->current_start_offset;
+      } else {
+        segment.start += self->current_start_offset;
+        if (segment.stop != -1)
+          segment.stop += self->current_start_offset;
+      }
+    }
+    fwd = gst_event_new_segment (&segment);
+    gst_event_set_seqnum (fwd, gst_event_get_seqnum (*event));
+  } else {
+    fwd = gst_event_ref (*event);
+    if (self->adjust_base && self->format == GST_FORMAT_TIME) {
+      gint64 offset;
+
+      fwd = gst_event_make_writable (fwd);
+      offset = gst_event_get_running_time_offset (fwd);
+      offset += self->current_start_offset;
+
+      gst_event_set_running_time_offset (fwd, offset);
+    }
+  }
+  g_mutex_unlock (&self->lock);
+
+  gst_pad_push_event (self->srcpad, fwd);
+
+  return TRUE;
+}
+
+/* Send the sticky events that were deferred while this pad was waiting to
+ * become the current sinkpad. Must be called from the pad's streaming
+ * thread once it is the current sinkpad, before any data is forwarded */
+static void
+gst_concat_pad_forward_stickies (GstConcat * self, GstConcatPad * spad)
+{
+  GST_DEBUG_OBJECT (spad, "Forwarding deferred sticky events");
+
+  spad->pending_stickies = FALSE;
+  gst_pad_sticky_events_foreach (GST_PAD_CAST (spad), forward_sticky, self);
+}
+
 static GstFlowReturn
 gst_concat_sink_chain (GstPad * pad, GstObject * parent, GstBuffer * buffer)
 {
@@ -437,6 +519,9 @@ gst_concat_sink_chain (GstPad * pad, GstObject * parent, GstBuffer * buffer)
   if (!gst_concat_pad_wait (spad, self))
     return GST_FLOW_FLUSHING;
 
+  if (spad->pending_stickies)
+    gst_concat_pad_forward_stickies (self, spad);
+
   if (self->last_stop == GST_CLOCK_TIME_NONE)
     self->last_stop = spad->segment.start;
 
@@ -534,9 +619,17 @@ gst_concat_sink_event (GstPad * pad, GstObject * parent, GstEvent * event)
 
   switch (GST_EVENT_TYPE (event)) {
     case GST_EVENT_STREAM_START:{
-      if (!gst_concat_pad_wait (spad, self)) {
+      if (!gst_concat_pad_is_current (self, spad)) {
+        /* Accept and store the event but defer forwarding it until this
+         * pad becomes the current sinkpad, so the upstream branch can keep
+         * prerolling while the current stream still plays */
+        spad->pending_stickies = TRUE;
+        gst_event_replace (&event, NULL);
+      } else if (!gst_concat_pad_wait (spad, self)) {
         ret = FALSE;
         gst_event_replace (&event, NULL);
+      } else if (spad->pending_stickies) {
+        gst_concat_pad_forward_stickies (self, spad);
       }
       break;
     }
@@ -571,10 +664,19 @@ gst_concat_sink_event (GstPad * pad, GstObject * parent, GstEvent * event)
 
       g_mutex_unlock (&self->lock);
 
-      if (!gst_concat_pad_wait (spad, self)) {
+      if (!gst_concat_pad_is_current (self, spad)) {
+        /* Defer building the outgoing segment until this pad is active;
+         * the start offset is only final once the current stream finished */
+        spad->pending_stickies = TRUE;
+      } else if (!gst_concat_pad_wait (spad, self)) {
         ret = FALSE;
       } else {
-        GstSegment segment = spad->segment;
+        GstSegment segment;
+
+        if (spad->pending_stickies)
+          gst_concat_pad_forward_stickies (self, spad);
+
+        segment = spad->segment;
 
         g_mutex_lock (&self->lock);
 
@@ -623,6 +725,11 @@ gst_concat_sink_event (GstPad * pad, GstObject * parent, GstEvent * event)
       } else {
         gboolean next;
 
+        /* streams without buffers still forward their sticky events in
+         * order before we move on */
+        if (spad->pending_stickies)
+          gst_concat_pad_forward_stickies (self, spad);
+
         g_mutex_lock (&self->lock);
         next = gst_concat_switch_pad (self);
         g_mutex_unlock (&self->lock);
@@ -682,10 +789,19 @@ gst_concat_sink_event (GstPad * pad, GstObject * parent, GstEvent * event)
       break;
     }
     default:{
-      /* Wait for other serialized events before forwarding */
-      if (GST_EVENT_IS_SERIALIZED (event) && !gst_concat_pad_wait (spad, self)) {
-        gst_event_replace (&event, NULL);
-        ret = FALSE;
+      if (GST_EVENT_IS_SERIALIZED (event)) {
+        if (GST_EVENT_IS_STICKY (event)
+            && !gst_concat_pad_is_current (self, spad)) {
+          /* Store now, forward when this pad becomes the current sinkpad */
+          spad->pending_stickies = TRUE;
+          gst_event_replace (&event, NULL);
+        } else if (!gst_concat_pad_wait (spad, self)) {
+          /* Wait for other serialized events before forwarding */
+          gst_event_replace (&event, NULL);
+          ret = FALSE;
+        } else if (spad->pending_stickies) {
+          gst_concat_pad_forward_stickies (self, spad);
+        }
       }
       break;
     }
@@ -67,6 +67,14 @@
 #endif
 #endif
 
+/* fdatasync forces the data to storage like fsync but can skip unneeded
+ * metadata-only updates such as the modification time, which is all that
+ * GST_BUFFER_FLAG_SYNC_AFTER asks for */
+#ifdef HAVE_FDATASYNC
+#undef fsync
+#define fsync fdatasync
+#endif
+
 #include <sys/stat.h>
 #ifdef HAVE_UNISTD_H
 #include <unistd.h>
@@ -562,6 +562,14 @@ gst_file_src_start (GstBaseSrc * basesrc)
 
   gst_base_src_set_dynamic_size (basesrc, src->seekable);
 
+#ifdef HAVE_POSIX_FADVISE
+  /* ask the kernel for aggressive readahead; playback mostly reads the file
+   * front to back and a seek resets the window again quickly. Purely a hint,
+   * so failure is of no concern */
+  if (src->is_regular)
+    posix_fadvise (fileno (src->fp), 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
   if (src->buffer_size) {
     src->buffer = g_malloc (src->buffer_size);
     if (setvbuf (src->fp, (char *) src->buffer, _IOFBF, src->buffer_size) != 0) {
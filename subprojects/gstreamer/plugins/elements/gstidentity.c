@@ -796,7 +796,10 @@ gst_identity_transform_ip (GstBaseTransform * trans, GstBuffer * buf)
   if (identity->signal_handoffs)
     g_signal_emit (identity, gst_identity_signals[SIGNAL_HANDOFF], 0, buf);
 
-  if (trans->segment.format == GST_FORMAT_TIME) {
+  /* the running times are only consumed by sync waiting and single-segment
+   * rewriting; skip the conversions when neither is active */
+  if ((identity->sync || identity->single_segment) &&
+      trans->segment.format == GST_FORMAT_TIME) {
     if (trans->segment.rate > 0) {
       runpts = gst_segment_to_running_time (&trans->segment,
           GST_FORMAT_TIME, GST_BUFFER_PTS (buf));
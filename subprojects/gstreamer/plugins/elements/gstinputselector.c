@@ -161,6 +161,11 @@ struct _GstSelectorPad
   GstSegment segment;           /* the current segment on the pad */
   guint32 segment_seqnum;       /* sequence number of the current segment */
 
+  GstClockTime blocked_running_time;    /* running time this pad is blocked
+                                           on in wait_running_time, NONE when
+                                           not waiting; protected by the
+                                           SELECTOR_LOCK */
+
   gboolean events_pending;      /* TRUE if sticky events need to be updated */
 
   gboolean sending_cached_buffers;
@@ -342,6 +347,7 @@ gst_selector_pad_reset (GstSelectorPad * pad)
   pad->events_pending = FALSE;
   pad->discont = FALSE;
   pad->flushing = FALSE;
+  pad->blocked_running_time = GST_CLOCK_TIME_NONE;
   gst_segment_init (&pad->segment, GST_FORMAT_UNDEFINED);
   pad->sending_cached_buffers = FALSE;
   gst_selector_pad_free_cached_buffers (pad);
@@ -507,6 +513,44 @@ gst_input_selector_all_eos (GstInputSelector * sel)
   return TRUE;
 }
 
+/* must be called with the SELECTOR_LOCK. Wake the pads blocked in
+ * wait_running_time after the active pad advanced to @selpad's current
+ * segment position. When syncing to the active segment we know exactly
+ * which running time the waiters compare against, so the (syscall-backed)
+ * broadcast can be skipped while no waiter's threshold is crossed yet;
+ * in clock mode the waiters re-check against the clock and always need
+ * the wakeup */
+static void
+gst_input_selector_broadcast_position (GstInputSelector * sel,
+    GstSelectorPad * selpad)
+{
+  GstClockTime cur_running_time = GST_CLOCK_TIME_NONE;
+  GList *walk;
+
+  if (sel->sync_mode == GST_INPUT_SELECTOR_SYNC_MODE_ACTIVE_SEGMENT &&
+      selpad->segment.format == GST_FORMAT_TIME)
+    cur_running_time = gst_segment_to_running_time (&selpad->segment,
+        GST_FORMAT_TIME, selpad->segment.position);
+
+  if (!GST_CLOCK_TIME_IS_VALID (cur_running_time)) {
+    GST_INPUT_SELECTOR_BROADCAST (sel);
+    return;
+  }
+
+  for (walk = GST_ELEMENT_CAST (sel)->sinkpads; walk; walk = walk->next) {
+    GstSelectorPad *other = GST_SELECTOR_PAD_CAST (walk->data);
+
+    if (other != selpad
+        && GST_CLOCK_TIME_IS_VALID (other->blocked_running_time)
+        && other->blocked_running_time < cur_running_time) {
+      GST_INPUT_SELECTOR_BROADCAST (sel);
+      return;
+    }
+  }
+
+  GST_LOG_OBJECT (selpad, "no waiter can progress yet, skipping broadcast");
+}
+
 static gboolean
 gst_selector_pad_event (GstPad * pad, GstObject * parent, GstEvent * event)
 {
@@ -619,7 +663,7 @@ gst_selector_pad_event (GstPad * pad, GstObject * parent, GstEvent * event)
         selpad->segment.position = ts;
         GST_OBJECT_UNLOCK (pad);
         if (sel->sync_streams && active_sinkpad == pad)
-          GST_INPUT_SELECTOR_BROADCAST (sel);
+          gst_input_selector_broadcast_position (sel, selpad);
       }
 
     }
@@ -825,7 +869,9 @@ gst_input_selector_wait_running_time (GstInputSelector * sel,
           "Waiting for active streams to advance. %" GST_TIME_FORMAT " >= %"
           GST_TIME_FORMAT, GST_TIME_ARGS (running_time),
           GST_TIME_ARGS (cur_running_time));
+      selpad->blocked_running_time = running_time;
       GST_INPUT_SELECTOR_WAIT (sel);
+      selpad->blocked_running_time = GST_CLOCK_TIME_NONE;
     } else {
       GST_INPUT_SELECTOR_UNLOCK (sel);
       break;
@@ -1089,7 +1135,7 @@ gst_selector_pad_chain (GstPad * pad, GstObject * parent, GstBuffer * buf)
 
   /* Tell all non-active pads that we advanced the running time */
   if (sel->sync_streams)
-    GST_INPUT_SELECTOR_BROADCAST (sel);
+    gst_input_selector_broadcast_position (sel, selpad);
 
   GST_INPUT_SELECTOR_UNLOCK (sel);
 
@@ -133,6 +133,12 @@ struct _GstSingleQueue
    */
   gboolean pushed;
 
+  /* Protects the segments, positions, tainted flags and cur_time of this
+   * single queue, so per-buffer time-level tracking of independent streams
+   * does not serialize on the global qlock. Lock order: when both are
+   * needed, the global qlock is always taken before this lock. */
+  GMutex lock;
+
   /* segments */
   GstSegment sink_segment;
   GstSegment src_segment;
@@ -438,24 +444,14 @@ static guint64
 gst_multiqueue_pad_get_current_level_time (GstMultiQueuePad * pad)
 {
   GstSingleQueue *sq = pad->sq;
-  GstMultiQueue *mq;
   guint64 ret;
 
   if (!sq)
     return 0;
 
-  mq = g_weak_ref_get (&pad->sq->mqueue);
-
-  if (mq) {
-    GST_MULTI_QUEUE_MUTEX_LOCK (mq);
-  }
-
+  g_mutex_lock (&sq->lock);
   ret = sq->cur_time;
-
-  if (mq) {
-    GST_MULTI_QUEUE_MUTEX_UNLOCK (mq);
-    gst_object_unref (mq);
-  }
+  g_mutex_unlock (&sq->lock);
 
   return ret;
 }
@@ -1385,13 +1381,15 @@ gst_single_queue_flush (GstMultiQueue * mq, GstSingleQueue * sq, gboolean flush,
     gst_single_queue_flush_queue (sq, full);
 
     GST_MULTI_QUEUE_MUTEX_LOCK (mq);
+    g_mutex_lock (&sq->lock);
     gst_segment_init (&sq->sink_segment, GST_FORMAT_TIME);
     gst_segment_init (&sq->src_segment, GST_FORMAT_TIME);
     sq->has_src_segment = FALSE;
+    sq->cur_time = 0;
+    g_mutex_unlock (&sq->lock);
     /* All pads start off OK for a smooth kick-off */
     sq->srcresult = GST_FLOW_OK;
     sq->pushed = FALSE;
-    sq->cur_time = 0;
     sq->max_size.visible = mq->max_size.visible;
     sq->is_eos = FALSE;
     sq->is_segment_done = FALSE;
@@ -1650,9 +1648,13 @@ beach:
 
 /* calculate the diff between running time on the sink and src of the queue.
  * This is the total amount of time in the queue.
- * WITH LOCK TAKEN */
+ * WITH sq->lock TAKEN. @global_locked says whether the caller also holds the
+ * global qlock, which is required for the interleave computation; when it is
+ * not held the interleave update is skipped and will happen on the next
+ * buffer. */
 static void
-update_time_level (GstMultiQueue * mq, GstSingleQueue * sq)
+update_time_level (GstMultiQueue * mq, GstSingleQueue * sq,
+    gboolean global_locked)
 {
   GstClockTimeDiff sink_time, src_time;
 
@@ -1675,7 +1677,7 @@ update_time_level (GstMultiQueue * mq, GstSingleQueue * sq)
     if (G_UNLIKELY (sink_time != GST_CLOCK_STIME_NONE)) {
       /* if we have a time, we become untainted and use the time */
       sq->sink_tainted = FALSE;
-      if (mq->use_interleave) {
+      if (global_locked && mq->use_interleave) {
         sq->cached_sinktime = sink_time;
         calculate_interleave (mq, sq);
       }
@@ -1723,9 +1725,6 @@ update_time_level (GstMultiQueue * mq, GstSingleQueue * sq)
   else
     sq->cur_time = 0;
 
-  /* updating the time level can change the buffering state */
-  update_buffering (mq, sq);
-
   return;
 }
 
@@ -1748,6 +1747,7 @@ apply_segment (GstMultiQueue * mq, GstSingleQueue * sq, GstEvent * event,
     segment->time = 0;
   }
   GST_MULTI_QUEUE_MUTEX_LOCK (mq);
+  g_mutex_lock (&sq->lock);
 
   /* Make sure we have a valid initial segment position (and not garbage
    * from upstream) */
@@ -1766,7 +1766,11 @@ apply_segment (GstMultiQueue * mq, GstSingleQueue * sq, GstEvent * event,
       "queue %d, configured SEGMENT %" GST_SEGMENT_FORMAT, sq->id, segment);
 
   /* segment can update the time level of the queue */
-  update_time_level (mq, sq);
+  update_time_level (mq, sq, TRUE);
+  g_mutex_unlock (&sq->lock);
+
+  /* updating the time level can change the buffering state */
+  update_buffering (mq, sq);
 
   GST_MULTI_QUEUE_MUTEX_UNLOCK (mq);
   gst_multi_queue_post_buffering (mq);
@@ -1777,7 +1781,16 @@ static void
 apply_buffer (GstMultiQueue * mq, GstSingleQueue * sq, GstClockTime timestamp,
     GstClockTime duration, GstSegment * segment)
 {
-  GST_MULTI_QUEUE_MUTEX_LOCK (mq);
+  gboolean need_global;
+
+  /* buffering and interleave are cross-queue computations that need the
+   * global lock; plain time-level tracking only needs the single queue
+   * lock so that independent streams do not serialize on the global lock
+   * for every buffer */
+  need_global = mq->use_buffering || mq->use_interleave;
+  if (need_global)
+    GST_MULTI_QUEUE_MUTEX_LOCK (mq);
+  g_mutex_lock (&sq->lock);
 
   /* if no timestamp is set, assume it's continuous with the previous
    * time */
@@ -1800,9 +1813,15 @@ apply_buffer (GstMultiQueue * mq, GstSingleQueue * sq, GstClockTime timestamp,
     sq->src_tainted = TRUE;
 
   /* calc diff with other end */
-  update_time_level (mq, sq);
-  GST_MULTI_QUEUE_MUTEX_UNLOCK (mq);
-  gst_multi_queue_post_buffering (mq);
+  update_time_level (mq, sq, need_global);
+  g_mutex_unlock (&sq->lock);
+
+  if (need_global) {
+    /* updating the time level can change the buffering state */
+    update_buffering (mq, sq);
+    GST_MULTI_QUEUE_MUTEX_UNLOCK (mq);
+    gst_multi_queue_post_buffering (mq);
+  }
 }
 
 static void
@@ -1811,8 +1830,13 @@ apply_gap (GstMultiQueue * mq, GstSingleQueue * sq, GstEvent * event,
 {
   GstClockTime timestamp;
   GstClockTime duration;
+  gboolean need_global;
 
-  GST_MULTI_QUEUE_MUTEX_LOCK (mq);
+  /* same locking rationale as apply_buffer() */
+  need_global = mq->use_buffering || mq->use_interleave;
+  if (need_global)
+    GST_MULTI_QUEUE_MUTEX_LOCK (mq);
+  g_mutex_lock (&sq->lock);
 
   gst_event_parse_gap (event, &timestamp, &duration);
 
@@ -1834,11 +1858,17 @@ apply_gap (GstMultiQueue * mq, GstSingleQueue * sq, GstEvent * event,
       sq->src_tainted = TRUE;
 
     /* calc diff with other end */
-    update_time_level (mq, sq);
+    update_time_level (mq, sq, need_global);
   }
 
-  GST_MULTI_QUEUE_MUTEX_UNLOCK (mq);
-  gst_multi_queue_post_buffering (mq);
+  g_mutex_unlock (&sq->lock);
+
+  if (need_global) {
+    /* updating the time level can change the buffering state */
+    update_buffering (mq, sq);
+    GST_MULTI_QUEUE_MUTEX_UNLOCK (mq);
+    gst_multi_queue_post_buffering (mq);
+  }
 }
 
 static GstClockTimeDiff
@@ -2198,9 +2228,9 @@ next:
         /* Wake up all non-linked pads before we sleep */
         wake_up_next_non_linked (mq);
 
-        mq->numwaiting++;
+        g_atomic_int_inc (&mq->numwaiting);
         g_cond_wait (&sq->turn, &mq->qlock);
-        mq->numwaiting--;
+        g_atomic_int_add (&mq->numwaiting, -1);
 
         if (sq->flushing) {
           GST_MULTI_QUEUE_MUTEX_UNLOCK (mq);
@@ -2339,15 +2369,19 @@ next:
   GST_LOG_OBJECT (mq, "sq:%d AFTER PUSHING sq->srcresult: %s (is_eos:%d)",
       sq->id, gst_flow_get_name (sq->srcresult), GST_PAD_IS_EOS (srcpad));
 
-  /* Need to make sure wake up any sleeping pads when we exit */
-  GST_MULTI_QUEUE_MUTEX_LOCK (mq);
-  if (mq->numwaiting > 0 && (GST_PAD_IS_EOS (srcpad)
+  /* Need to make sure wake up any sleeping pads when we exit. Check the
+   * waiter count without the lock first so the common case of nobody
+   * sleeping does not take the global lock at all */
+  if (g_atomic_int_get (&mq->numwaiting) > 0 && (GST_PAD_IS_EOS (srcpad)
           || sq->srcresult == GST_FLOW_EOS)) {
-    compute_high_time (mq, sq->groupid);
-    compute_high_id (mq);
-    wake_up_next_non_linked (mq);
+    GST_MULTI_QUEUE_MUTEX_LOCK (mq);
+    if (mq->numwaiting > 0) {
+      compute_high_time (mq, sq->groupid);
+      compute_high_id (mq);
+      wake_up_next_non_linked (mq);
+    }
+    GST_MULTI_QUEUE_MUTEX_UNLOCK (mq);
   }
-  GST_MULTI_QUEUE_MUTEX_UNLOCK (mq);
 
   if (dropping)
     goto next;
@@ -3348,6 +3382,7 @@ gst_single_queue_unref (GstSingleQueue * sq)
     /* DRAIN QUEUE */
     gst_data_queue_flush (sq->queue);
     g_object_unref (sq->queue);
+    g_mutex_clear (&sq->lock);
     g_cond_clear (&sq->turn);
     g_cond_clear (&sq->query_handled);
     g_weak_ref_clear (&sq->sinkpad);
@@ -3437,6 +3472,7 @@ gst_single_queue_new (GstMultiQueue * mqueue, guint id)
   sq->oldid = 0;
   sq->next_time = GST_CLOCK_STIME_NONE;
   sq->last_time = GST_CLOCK_STIME_NONE;
+  g_mutex_init (&sq->lock);
   g_cond_init (&sq->turn);
   g_cond_init (&sq->query_handled);
 
@@ -78,7 +78,8 @@ struct _GstMultiQueue {
 			/* queues lock). Protects nbqueues, queues, global */
 			/* GstMultiQueueSize, counter and highid */
 
-  gint numwaiting;	/* number of not-linked pads waiting */
+  gint numwaiting;	/* number of not-linked pads waiting, modified with
+			 * qlock held but also read atomically without it */
 
   gboolean buffering_percent_changed;
   GMutex buffering_post_lock; /* assures only one posted at a time */
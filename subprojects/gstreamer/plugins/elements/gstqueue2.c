@@ -633,9 +633,22 @@ find_range (GstQueue2 * queue, guint64 offset)
   GstQueue2Range *range = NULL;
   GstQueue2Range *walk;
 
-  /* first do a quick check for the current range */
+  /* first do a quick check for the current range, sequential access stays
+   * within it almost all of the time */
+  if (queue->current && offset >= queue->current->offset
+      && offset <= queue->current->writing_pos) {
+    GST_DEBUG_OBJECT (queue,
+        "found current range for %" G_GUINT64_FORMAT ": [%" G_GUINT64_FORMAT
+        "-%" G_GUINT64_FORMAT "]", offset, queue->current->offset,
+        queue->current->writing_pos);
+    return queue->current;
+  }
+
+  /* the list is sorted by offset, we can stop as soon as we passed it */
   for (walk = queue->ranges; walk; walk = walk->next) {
-    if (offset >= walk->offset && offset <= walk->writing_pos) {
+    if (walk->offset > offset)
+      break;
+    if (offset <= walk->writing_pos) {
       /* we can reuse an existing range */
       range = walk;
       break;
@@ -44,6 +44,13 @@
 #define FSEEK_FILE(file,offset)  (fseek (file, offset, SEEK_SET) != 0)
 #endif
 
+#ifdef HAVE_POSIX_FADVISE
+#include <fcntl.h>
+/* how far ahead of the current read position we ask the kernel to
+ * prefetch downloaded data */
+#define READAHEAD_SIZE (2 * 1024 * 1024)
+#endif
+
 #define GST_SPARSE_FILE_IO_ERROR \
     g_quark_from_static_string("gst-sparse-file-io-error-quark")
 
@@ -74,6 +81,8 @@ struct _GstSparseFile
 
   GstSparseRange *write_range;
   GstSparseRange *read_range;
+
+  gsize readahead_pos;          /* how far ahead we hinted the kernel */
 };
 
 static GstSparseRange *
@@ -197,6 +206,7 @@ gst_sparse_file_clear (GstSparseFile * file)
   file->ranges = NULL;
   file->n_ranges = 0;
   file->was_writing = FALSE;
+  file->readahead_pos = 0;
 }
 
 /**
@@ -342,6 +352,8 @@ gst_sparse_file_read (GstSparseFile * file, gsize offset, gpointer data,
           file->current_pos, offset);
       if (FSEEK_FILE (file->file, offset))
         goto error;
+      /* the readahead window is only valid for sequential reads */
+      file->readahead_pos = 0;
     } else if (file->was_writing) {
       fflush (file->file);
     }
@@ -349,6 +361,23 @@ gst_sparse_file_read (GstSparseFile * file, gsize offset, gpointer data,
     res = fread (data, 1, count, file->file);
     if (G_UNLIKELY (res < count))
       goto error;
+
+#ifdef HAVE_POSIX_FADVISE
+    {
+      /* ask the kernel to prefetch the downloaded data following the read
+       * position, so the next reads from the streaming thread find their
+       * pages in cache even when the disk is busy. Only the part of the
+       * window that was not hinted before is advised. */
+      gsize from = offset + res;
+      gsize frontier = MIN (range->stop, from + READAHEAD_SIZE);
+
+      from = MAX (from, file->readahead_pos);
+      if (frontier > from) {
+        posix_fadvise (file->fd, from, frontier - from, POSIX_FADV_WILLNEED);
+        file->readahead_pos = frontier;
+      }
+    }
+#endif
   }
 
   file->current_pos = offset + res;
@@ -171,8 +171,8 @@ local_latency_query_stack_push (struct LatencyQueryTableValue *value)
 /* hooks */
 
 static void
-log_latency (const GstStructure * data, GstElement * sink_parent,
-    GstPad * sink_pad, guint64 sink_ts)
+log_latency (GstLatencyTracer * self, const GstStructure * data,
+    GstElement * sink_parent, GstPad * sink_pad, guint64 sink_ts)
 {
   guint64 src_ts;
   const char *src, *element_src, *id_element_src;
@@ -206,8 +206,8 @@ log_latency (const GstStructure * data, GstElement * sink_parent,
 }
 
 static void
-log_element_latency (const GstStructure * data, GstElement * parent,
-    GstPad * pad, guint64 sink_ts)
+log_element_latency (GstLatencyTracer * self, const GstStructure * data,
+    GstElement * parent, GstPad * pad, guint64 sink_ts)
 {
   guint64 src_ts;
   gchar *pad_name, *element_name, *element_id;
@@ -297,10 +297,12 @@ send_latency_probe (GstLatencyTracer * self, GstElement * parent, GstPad * pad,
 }
 
 static void
-calculate_latency (GstElement * parent, GstPad * pad, guint64 ts)
+calculate_latency (GstLatencyTracer * self, GstElement * parent, GstPad * pad,
+    guint64 ts)
 {
   if (parent && (!GST_IS_BIN (parent)) &&
       (!GST_OBJECT_FLAG_IS_SET (parent, GST_ELEMENT_FLAG_SOURCE))) {
+    GstLatencyTracerClass *klass = GST_LATENCY_TRACER_GET_CLASS (self);
     GstEvent *ev;
     GstPad *peer_pad = gst_pad_get_peer (pad);
     GstElement *peer_parent = get_real_pad_parent (peer_pad);
@@ -312,7 +314,8 @@ calculate_latency (GstElement * parent, GstPad * pad, guint64 ts)
       GST_DEBUG ("%s_%s: Should log full latency now (event %p)",
           GST_DEBUG_PAD_NAME (pad), ev);
       if (ev) {
-        log_latency (gst_event_get_structure (ev), peer_parent, peer_pad, ts);
+        klass->latency (self, gst_event_get_structure (ev), peer_parent,
+            peer_pad, ts);
         g_object_set_qdata ((GObject *) pad, latency_probe_id, NULL);
       }
     }
@@ -321,7 +324,8 @@ calculate_latency (GstElement * parent, GstPad * pad, guint64 ts)
     GST_DEBUG ("%s_%s: Should log sub latency now (event %p)",
         GST_DEBUG_PAD_NAME (pad), ev);
     if (ev) {
-      log_element_latency (gst_event_get_structure (ev), parent, pad, ts);
+      klass->element_latency (self, gst_event_get_structure (ev), parent, pad,
+          ts);
       g_object_set_qdata ((GObject *) pad, sub_latency_probe_id, NULL);
     }
     if (peer_pad)
@@ -338,7 +342,7 @@ do_push_buffer_pre (GstTracer * tracer, guint64 ts, GstPad * pad)
   GstElement *parent = get_real_pad_parent (pad);
 
   send_latency_probe (self, parent, pad, ts);
-  calculate_latency (parent, pad, ts);
+  calculate_latency (self, parent, pad, ts);
 
   if (parent)
     gst_object_unref (parent);
@@ -362,7 +366,7 @@ do_pull_range_post (GstTracer * self, guint64 ts, GstPad * pad)
 {
   GstElement *parent = get_real_pad_parent (pad);
 
-  calculate_latency (parent, pad, ts);
+  calculate_latency ((GstLatencyTracer *) self, parent, pad, ts);
 
   if (parent)
     gst_object_unref (parent);
@@ -602,6 +606,9 @@ gst_latency_tracer_class_init (GstLatencyTracerClass * klass)
 
   gobject_class->constructed = gst_latency_tracer_constructed;
 
+  klass->latency = log_latency;
+  klass->element_latency = log_element_latency;
+
   latency_probe_id = g_quark_from_static_string ("latency_probe.id");
   sub_latency_probe_id = g_quark_from_static_string ("sub_latency_probe.id");
   latency_probe_pad = g_quark_from_static_string ("latency_probe.pad");
@@ -38,6 +38,8 @@ G_BEGIN_DECLS
 #define GST_IS_LATENCY_TRACER_CLASS(klass) \
   (G_TYPE_CHECK_CLASS_TYPE((klass),GST_TYPE_LATENCY_TRACER))
 #define GST_LATENCY_TRACER_CAST(obj) ((GstLatencyTracer *)(obj))
+#define GST_LATENCY_TRACER_GET_CLASS(obj) \
+  (G_TYPE_INSTANCE_GET_CLASS((obj),GST_TYPE_LATENCY_TRACER,GstLatencyTracerClass))
 
 typedef struct _GstLatencyTracer GstLatencyTracer;
 typedef struct _GstLatencyTracerClass GstLatencyTracerClass;
@@ -64,6 +66,16 @@ struct _GstLatencyTracer {
 struct _GstLatencyTracerClass {
   GstTracerClass parent_class;
 
+  /* vmethods, called whenever a latency measurement is complete; the default
+   * implementations log one tracer record per measurement. Subclasses (such
+   * as the latencyhist tracer) can override them to aggregate instead.
+   * @data is the custom event structure injected at the source and carries
+   * the "latency_probe.ts" field with the source timestamp. */
+  void (*latency) (GstLatencyTracer * self, const GstStructure * data,
+      GstElement * sink_parent, GstPad * sink_pad, guint64 sink_ts);
+  void (*element_latency) (GstLatencyTracer * self, const GstStructure * data,
+      GstElement * parent, GstPad * pad, guint64 sink_ts);
+
   /* signals */
 };
 
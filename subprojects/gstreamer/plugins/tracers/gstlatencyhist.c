@@ -0,0 +1,479 @@
+/* GStreamer
+ * Copyright (C) 2013 Stefan Sauer <ensonic@users.sf.net>
+ *
+ * gstlatencyhist.c: tracing module that aggregates latency histograms
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+/**
+ * SECTION:tracer-latencyhist
+ * @short_description: aggregate processing latency into histograms
+ *
+ * A tracing module that measures src-to-sink and per-element latencies like
+ * the latency tracer, but instead of emitting one log line per buffer it
+ * accumulates the measurements into per-pad log-linear histograms (HDR-style,
+ * ~9% relative precision). The hot path is a couple of atomic increments, so
+ * the tracer is cheap enough to stay enabled in production; no log output is
+ * produced while the pipeline runs.
+ *
+ * ```
+ * GST_TRACERS="latencyhist(flags=pipeline+element)" GST_DEBUG=GST_TRACER:7 ./...
+ * ```
+ *
+ * A summary record per histogram (count, mean, p50/p90/p99/p99.9) is written
+ * to the debug log when the tracer is destroyed. The same data is available
+ * on demand from the application through the `get-stats` action signal, or
+ * can be dumped to the log with `log-stats`; `reset-stats` clears all
+ * histograms, e.g. to implement periodic reporting.
+ */
+
+#ifdef HAVE_CONFIG_H
+#  include "config.h"
+#endif
+
+#include "gstlatencyhist.h"
+
+GST_DEBUG_CATEGORY_STATIC (gst_latency_hist_debug);
+#define GST_CAT_DEFAULT gst_latency_hist_debug
+
+#define _do_init \
+    GST_DEBUG_CATEGORY_INIT (gst_latency_hist_debug, "latencyhist", 0, \
+        "latency histogram tracer");
+#define gst_latency_hist_tracer_parent_class parent_class
+G_DEFINE_TYPE_WITH_CODE (GstLatencyHistTracer, gst_latency_hist_tracer,
+    GST_TYPE_LATENCY_TRACER, _do_init);
+
+static GQuark latency_probe_ts;
+static GQuark hist_pipeline_quark;
+static GQuark hist_element_quark;
+
+static GstTracerRecord *tr_latency_hist;
+
+enum
+{
+  SIGNAL_GET_STATS,
+  SIGNAL_LOG_STATS,
+  SIGNAL_RESET_STATS,
+  LAST_SIGNAL
+};
+
+static guint gst_latency_hist_tracer_signals[LAST_SIGNAL] = { 0 };
+
+/* log-linear histogram: values are grouped in powers of two, each power of
+ * two split into 2^GST_LATENCY_HIST_SUB_BITS linear sub-buckets. With 3 sub
+ * bits the relative bucket width is 2^-3 = 12.5%, which is plenty for
+ * latency percentiles, and the whole 64-bit nanosecond range is covered by
+ * (64 - 3 + 1) * 8 = 496 counters (~2KB per histogram). */
+#define GST_LATENCY_HIST_SUB_BITS 3
+#define GST_LATENCY_HIST_SUB_COUNT (1 << GST_LATENCY_HIST_SUB_BITS)
+#define GST_LATENCY_HIST_N_BUCKETS \
+    ((64 - GST_LATENCY_HIST_SUB_BITS + 1) * GST_LATENCY_HIST_SUB_COUNT)
+
+typedef struct
+{
+  gchar *key;
+  /* updated with atomic ops, without taking any lock */
+  gint buckets[GST_LATENCY_HIST_N_BUCKETS];
+} GstLatencyHist;
+
+static guint
+hist_bucket_index (guint64 value)
+{
+  guint shift = 0;
+
+  if (value < GST_LATENCY_HIST_SUB_COUNT)
+    return (guint) value;
+
+  while ((value >> shift) >= (GST_LATENCY_HIST_SUB_COUNT << 1))
+    shift++;
+
+  return ((shift + 1) << GST_LATENCY_HIST_SUB_BITS) +
+      (guint) ((value >> shift) & (GST_LATENCY_HIST_SUB_COUNT - 1));
+}
+
+/* lower bound of the bucket, the inverse of hist_bucket_index() */
+static guint64
+hist_bucket_value (guint index)
+{
+  guint shift, sub;
+
+  if (index < GST_LATENCY_HIST_SUB_COUNT)
+    return index;
+
+  shift = (index >> GST_LATENCY_HIST_SUB_BITS) - 1;
+  sub = index & (GST_LATENCY_HIST_SUB_COUNT - 1);
+
+  return ((guint64) (GST_LATENCY_HIST_SUB_COUNT + sub)) << shift;
+}
+
+static void
+hist_free (gpointer data)
+{
+  GstLatencyHist *hist = data;
+
+  g_free (hist->key);
+  g_free (hist);
+}
+
+/* Get (or lazily create) the histogram cached on @pad under @quark. The
+ * cached pointer makes the per-buffer path free of any string building or
+ * hash lookup; the table insertion only happens on the first measurement for
+ * a pad. The histogram is owned by the tracer and outlives the pad. */
+static GstLatencyHist *
+get_pad_hist (GstLatencyHistTracer * self, GstPad * pad, GQuark quark,
+    const gchar * key)
+{
+  GstLatencyHist *hist;
+
+  hist = g_object_get_qdata ((GObject *) pad, quark);
+  if (G_LIKELY (hist))
+    return hist;
+
+  g_mutex_lock (&self->lock);
+  hist = g_hash_table_lookup (self->histograms, key);
+  if (!hist) {
+    hist = g_new0 (GstLatencyHist, 1);
+    hist->key = g_strdup (key);
+    g_hash_table_insert (self->histograms, hist->key, hist);
+  }
+  g_mutex_unlock (&self->lock);
+
+  g_object_set_qdata ((GObject *) pad, quark, hist);
+
+  return hist;
+}
+
+static void
+hist_add_measurement (GstLatencyHist * hist, GstClockTimeDiff latency)
+{
+  if (G_UNLIKELY (latency < 0))
+    latency = 0;
+
+  g_atomic_int_inc (&hist->buckets[hist_bucket_index ((guint64) latency)]);
+}
+
+/* percentiles from a snapshot of the bucket counters; only used on the cold
+ * reporting paths */
+static void
+hist_get_stats (GstLatencyHist * hist, guint64 * count, guint64 * mean,
+    guint64 * p50, guint64 * p90, guint64 * p99, guint64 * p999)
+{
+  gint snapshot[GST_LATENCY_HIST_N_BUCKETS];
+  guint64 total = 0, sum = 0, acc = 0;
+  guint64 q50, q90, q99, q999;
+  guint i;
+
+  for (i = 0; i < GST_LATENCY_HIST_N_BUCKETS; i++) {
+    snapshot[i] = g_atomic_int_get (&hist->buckets[i]);
+    total += snapshot[i];
+    sum += snapshot[i] * hist_bucket_value (i);
+  }
+
+  *count = total;
+  *mean = total ? sum / total : 0;
+  *p50 = *p90 = *p99 = *p999 = 0;
+
+  if (total == 0)
+    return;
+
+  q50 = (total * 50 + 99) / 100;
+  q90 = (total * 90 + 99) / 100;
+  q99 = (total * 99 + 99) / 100;
+  q999 = (total * 999 + 999) / 1000;
+
+  for (i = 0; i < GST_LATENCY_HIST_N_BUCKETS; i++) {
+    acc += snapshot[i];
+    if (acc >= q50 && *p50 == 0)
+      *p50 = hist_bucket_value (i);
+    if (acc >= q90 && *p90 == 0)
+      *p90 = hist_bucket_value (i);
+    if (acc >= q99 && *p99 == 0)
+      *p99 = hist_bucket_value (i);
+    if (acc >= q999) {
+      *p999 = hist_bucket_value (i);
+      break;
+    }
+  }
+}
+
+/* vmethods */
+
+static void
+record_latency (GstLatencyTracer * tracer, const GstStructure * data,
+    GstElement * sink_parent, GstPad * sink_pad, guint64 sink_ts)
+{
+  GstLatencyHistTracer *self = GST_LATENCY_HIST_TRACER_CAST (tracer);
+  GstLatencyHist *hist;
+  guint64 src_ts;
+
+  hist = g_object_get_qdata ((GObject *) sink_pad, hist_pipeline_quark);
+  if (G_UNLIKELY (!hist)) {
+    const gchar *element_src =
+        gst_structure_get_string (data, "latency_probe.element");
+    const gchar *pad_src = gst_structure_get_string (data, "latency_probe.pad");
+    gchar *element_sink = gst_element_get_name (sink_parent);
+    gchar *pad_sink = gst_pad_get_name (sink_pad);
+    /* with multiple sources feeding one sink, the measurements end up merged
+     * in the histogram named after the first source seen */
+    gchar *key = g_strdup_printf ("%s.%s-%s.%s", element_src, pad_src,
+        element_sink, pad_sink);
+
+    hist = get_pad_hist (self, sink_pad, hist_pipeline_quark, key);
+    g_free (key);
+    g_free (pad_sink);
+    g_free (element_sink);
+  }
+
+  gst_structure_id_get (data, latency_probe_ts, G_TYPE_UINT64, &src_ts, NULL);
+  hist_add_measurement (hist, GST_CLOCK_DIFF (src_ts, sink_ts));
+}
+
+static void
+record_element_latency (GstLatencyTracer * tracer, const GstStructure * data,
+    GstElement * parent, GstPad * pad, guint64 sink_ts)
+{
+  GstLatencyHistTracer *self = GST_LATENCY_HIST_TRACER_CAST (tracer);
+  GstLatencyHist *hist;
+  guint64 src_ts;
+
+  hist = g_object_get_qdata ((GObject *) pad, hist_element_quark);
+  if (G_UNLIKELY (!hist)) {
+    gchar *element_name = gst_element_get_name (parent);
+    gchar *pad_name = gst_pad_get_name (pad);
+    gchar *key = g_strdup_printf ("%s.%s", element_name, pad_name);
+
+    hist = get_pad_hist (self, pad, hist_element_quark, key);
+    g_free (key);
+    g_free (pad_name);
+    g_free (element_name);
+  }
+
+  gst_structure_id_get (data, latency_probe_ts, G_TYPE_UINT64, &src_ts, NULL);
+  hist_add_measurement (hist, GST_CLOCK_DIFF (src_ts, sink_ts));
+}
+
+/* actions */
+
+static GstStructure *
+gst_latency_hist_tracer_get_stats (GstLatencyHistTracer * self)
+{
+  GstStructure *stats = gst_structure_new_empty ("latency-hist-stats");
+  GHashTableIter iter;
+  gpointer value;
+
+  g_mutex_lock (&self->lock);
+  g_hash_table_iter_init (&iter, self->histograms);
+  while (g_hash_table_iter_next (&iter, NULL, &value)) {
+    GstLatencyHist *hist = value;
+    guint64 count, mean, p50, p90, p99, p999;
+    GstStructure *s;
+
+    hist_get_stats (hist, &count, &mean, &p50, &p90, &p99, &p999);
+
+    s = gst_structure_new ("latency-hist",
+        "count", G_TYPE_UINT64, count,
+        "mean", G_TYPE_UINT64, mean,
+        "p50", G_TYPE_UINT64, p50,
+        "p90", G_TYPE_UINT64, p90,
+        "p99", G_TYPE_UINT64, p99,
+        "p999", G_TYPE_UINT64, p999, NULL);
+    gst_structure_set (stats, hist->key, GST_TYPE_STRUCTURE, s, NULL);
+    gst_structure_free (s);
+  }
+  g_mutex_unlock (&self->lock);
+
+  return stats;
+}
+
+static void
+gst_latency_hist_tracer_log_stats (GstLatencyHistTracer * self)
+{
+  GHashTableIter iter;
+  gpointer value;
+
+  g_mutex_lock (&self->lock);
+  g_hash_table_iter_init (&iter, self->histograms);
+  while (g_hash_table_iter_next (&iter, NULL, &value)) {
+    GstLatencyHist *hist = value;
+    guint64 count, mean, p50, p90, p99, p999;
+
+    hist_get_stats (hist, &count, &mean, &p50, &p90, &p99, &p999);
+    gst_tracer_record_log (tr_latency_hist, hist->key, count, mean, p50, p90,
+        p99, p999);
+  }
+  g_mutex_unlock (&self->lock);
+}
+
+static void
+gst_latency_hist_tracer_reset_stats (GstLatencyHistTracer * self)
+{
+  GHashTableIter iter;
+  gpointer value;
+
+  g_mutex_lock (&self->lock);
+  g_hash_table_iter_init (&iter, self->histograms);
+  while (g_hash_table_iter_next (&iter, NULL, &value)) {
+    GstLatencyHist *hist = value;
+    guint i;
+
+    /* concurrent increments during the reset can be lost, which is fine for
+     * a statistics reset */
+    for (i = 0; i < GST_LATENCY_HIST_N_BUCKETS; i++)
+      g_atomic_int_set (&hist->buckets[i], 0);
+  }
+  g_mutex_unlock (&self->lock);
+}
+
+/* tracer class */
+
+static void
+gst_latency_hist_tracer_finalize (GObject * object)
+{
+  GstLatencyHistTracer *self = GST_LATENCY_HIST_TRACER (object);
+
+  /* dump the aggregated numbers once at the end of the run */
+  gst_latency_hist_tracer_log_stats (self);
+
+  g_hash_table_destroy (self->histograms);
+  g_mutex_clear (&self->lock);
+
+  G_OBJECT_CLASS (parent_class)->finalize (object);
+}
+
+static void
+gst_latency_hist_tracer_class_init (GstLatencyHistTracerClass * klass)
+{
+  GObjectClass *gobject_class = G_OBJECT_CLASS (klass);
+  GstLatencyTracerClass *latency_class = GST_LATENCY_TRACER_CLASS (klass);
+
+  gobject_class->finalize = gst_latency_hist_tracer_finalize;
+
+  latency_class->latency = record_latency;
+  latency_class->element_latency = record_element_latency;
+
+  latency_probe_ts = g_quark_from_static_string ("latency_probe.ts");
+  hist_pipeline_quark = g_quark_from_static_string ("latency_hist.pipeline");
+  hist_element_quark = g_quark_from_static_string ("latency_hist.element");
+
+  /* announce trace formats */
+  /* *INDENT-OFF* */
+  tr_latency_hist = gst_tracer_record_new ("latency-hist.class",
+      "pad", GST_TYPE_STRUCTURE, gst_structure_new ("scope",
+          "type", G_TYPE_GTYPE, G_TYPE_STRING,
+          "related-to", GST_TYPE_TRACER_VALUE_SCOPE, GST_TRACER_VALUE_SCOPE_PAD,
+          NULL),
+      "count", GST_TYPE_STRUCTURE, gst_structure_new ("value",
+          "type", G_TYPE_GTYPE, G_TYPE_UINT64,
+          "description", G_TYPE_STRING, "number of latency measurements",
+          "min", G_TYPE_UINT64, G_GUINT64_CONSTANT (0),
+          "max", G_TYPE_UINT64, G_MAXUINT64,
+          NULL),
+      "mean", GST_TYPE_STRUCTURE, gst_structure_new ("value",
+          "type", G_TYPE_GTYPE, G_TYPE_UINT64,
+          "description", G_TYPE_STRING, "mean latency in ns",
+          "min", G_TYPE_UINT64, G_GUINT64_CONSTANT (0),
+          "max", G_TYPE_UINT64, G_MAXUINT64,
+          NULL),
+      "p50", GST_TYPE_STRUCTURE, gst_structure_new ("value",
+          "type", G_TYPE_GTYPE, G_TYPE_UINT64,
+          "description", G_TYPE_STRING, "50th percentile latency in ns",
+          "min", G_TYPE_UINT64, G_GUINT64_CONSTANT (0),
+          "max", G_TYPE_UINT64, G_MAXUINT64,
+          NULL),
+      "p90", GST_TYPE_STRUCTURE, gst_structure_new ("value",
+          "type", G_TYPE_GTYPE, G_TYPE_UINT64,
+          "description", G_TYPE_STRING, "90th percentile latency in ns",
+          "min", G_TYPE_UINT64, G_GUINT64_CONSTANT (0),
+          "max", G_TYPE_UINT64, G_MAXUINT64,
+          NULL),
+      "p99", GST_TYPE_STRUCTURE, gst_structure_new ("value",
+          "type", G_TYPE_GTYPE, G_TYPE_UINT64,
+          "description", G_TYPE_STRING, "99th percentile latency in ns",
+          "min", G_TYPE_UINT64, G_GUINT64_CONSTANT (0),
+          "max", G_TYPE_UINT64, G_MAXUINT64,
+          NULL),
+      "p999", GST_TYPE_STRUCTURE, gst_structure_new ("value",
+          "type", G_TYPE_GTYPE, G_TYPE_UINT64,
+          "description", G_TYPE_STRING, "99.9th percentile latency in ns",
+          "min", G_TYPE_UINT64, G_GUINT64_CONSTANT (0),
+          "max", G_TYPE_UINT64, G_MAXUINT64,
+          NULL),
+      NULL);
+  /* *INDENT-ON* */
+
+  GST_OBJECT_FLAG_SET (tr_latency_hist, GST_OBJECT_FLAG_MAY_BE_LEAKED);
+
+  /**
+   * GstLatencyHistTracer::get-stats:
+   * @latencyhisttracer: the tracer object to emit this signal on
+   *
+   * Returns the aggregated latency statistics as a #GstStructure with one
+   * field per histogram, named after the measured pad(s). Each field is a
+   * #GstStructure with `count`, `mean`, `p50`, `p90`, `p99` and `p999`
+   * fields, all of type #G_TYPE_UINT64 and in nanoseconds.
+   *
+   * Returns: (transfer full): a newly-allocated #GstStructure
+   *
+   * Since: 1.22
+   */
+  gst_latency_hist_tracer_signals[SIGNAL_GET_STATS] =
+      g_signal_new ("get-stats", G_TYPE_FROM_CLASS (klass),
+      G_SIGNAL_RUN_LAST | G_SIGNAL_ACTION,
+      G_STRUCT_OFFSET (GstLatencyHistTracerClass, get_stats), NULL, NULL, NULL,
+      GST_TYPE_STRUCTURE, 0, G_TYPE_NONE);
+
+  /**
+   * GstLatencyHistTracer::log-stats:
+   * @latencyhisttracer: the tracer object to emit this signal on
+   *
+   * Writes one summary record per histogram to the debug log under
+   * `GST_TRACER:7`, in the same format as the dump on tracer destruction.
+   *
+   * Since: 1.22
+   */
+  gst_latency_hist_tracer_signals[SIGNAL_LOG_STATS] =
+      g_signal_new ("log-stats", G_TYPE_FROM_CLASS (klass),
+      G_SIGNAL_RUN_LAST | G_SIGNAL_ACTION,
+      G_STRUCT_OFFSET (GstLatencyHistTracerClass, log_stats), NULL, NULL, NULL,
+      G_TYPE_NONE, 0, G_TYPE_NONE);
+
+  /**
+   * GstLatencyHistTracer::reset-stats:
+   * @latencyhisttracer: the tracer object to emit this signal on
+   *
+   * Clears all histograms, e.g. to implement interval-based reporting
+   * together with `get-stats`.
+   *
+   * Since: 1.22
+   */
+  gst_latency_hist_tracer_signals[SIGNAL_RESET_STATS] =
+      g_signal_new ("reset-stats", G_TYPE_FROM_CLASS (klass),
+      G_SIGNAL_RUN_LAST | G_SIGNAL_ACTION,
+      G_STRUCT_OFFSET (GstLatencyHistTracerClass, reset_stats), NULL, NULL,
+      NULL, G_TYPE_NONE, 0, G_TYPE_NONE);
+
+  klass->get_stats = gst_latency_hist_tracer_get_stats;
+  klass->log_stats = gst_latency_hist_tracer_log_stats;
+  klass->reset_stats = gst_latency_hist_tracer_reset_stats;
+}
+
+static void
+gst_latency_hist_tracer_init (GstLatencyHistTracer * self)
+{
+  g_mutex_init (&self->lock);
+  self->histograms = g_hash_table_new_full (g_str_hash, g_str_equal, NULL,
+      hist_free);
+}
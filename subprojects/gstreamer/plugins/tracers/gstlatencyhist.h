@@ -0,0 +1,73 @@
+/* GStreamer
+ * Copyright (C) 2013 Stefan Sauer <ensonic@users.sf.net>
+ *
+ * gstlatencyhist.h: tracing module that aggregates latency histograms
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GST_LATENCY_HIST_TRACER_H__
+#define __GST_LATENCY_HIST_TRACER_H__
+
+#include <gst/gst.h>
+#include <gst/gsttracer.h>
+
+#include "gstlatency.h"
+
+G_BEGIN_DECLS
+
+#define GST_TYPE_LATENCY_HIST_TRACER \
+  (gst_latency_hist_tracer_get_type())
+#define GST_LATENCY_HIST_TRACER(obj) \
+  (G_TYPE_CHECK_INSTANCE_CAST((obj),GST_TYPE_LATENCY_HIST_TRACER,GstLatencyHistTracer))
+#define GST_LATENCY_HIST_TRACER_CLASS(klass) \
+  (G_TYPE_CHECK_CLASS_CAST((klass),GST_TYPE_LATENCY_HIST_TRACER,GstLatencyHistTracerClass))
+#define GST_IS_LATENCY_HIST_TRACER(obj) \
+  (G_TYPE_CHECK_INSTANCE_TYPE((obj),GST_TYPE_LATENCY_HIST_TRACER))
+#define GST_IS_LATENCY_HIST_TRACER_CLASS(klass) \
+  (G_TYPE_CHECK_CLASS_TYPE((klass),GST_TYPE_LATENCY_HIST_TRACER))
+#define GST_LATENCY_HIST_TRACER_CAST(obj) ((GstLatencyHistTracer *)(obj))
+
+typedef struct _GstLatencyHistTracer GstLatencyHistTracer;
+typedef struct _GstLatencyHistTracerClass GstLatencyHistTracerClass;
+
+/**
+ * GstLatencyHistTracer:
+ *
+ * Opaque #GstLatencyHistTracer data structure
+ */
+struct _GstLatencyHistTracer {
+  GstLatencyTracer parent;
+
+  /*< private >*/
+  GMutex lock;                  /* protects the histograms table */
+  GHashTable *histograms;       /* key string -> GstLatencyHist */
+};
+
+struct _GstLatencyHistTracerClass {
+  GstLatencyTracerClass parent_class;
+
+  /* actions */
+  GstStructure *(*get_stats) (GstLatencyHistTracer * self);
+  void (*log_stats) (GstLatencyHistTracer * self);
+  void (*reset_stats) (GstLatencyHistTracer * self);
+};
+
+G_GNUC_INTERNAL GType gst_latency_hist_tracer_get_type (void);
+
+G_END_DECLS
+
+#endif /* __GST_LATENCY_HIST_TRACER_H__ */
@@ -39,7 +39,7 @@
  * active at the same time.
  *
  * Parameters can also be passed to each tracer. The leaks tracer currently
- * accepts five params:
+ * accepts six params:
  * 1. filters: (string) to filter which objects to record
  * 2. check-refs: (boolean) whether to record every location where a leaked
  *    object was reffed and unreffed
@@ -47,6 +47,11 @@
  * 4. name: (string) set a name for the tracer object itself
  * 5. log-leaks-on-deinit: (boolean) whether to report all leaks on
  *    gst_deinit() by printing them in the debug log; "true" by default
+ * 6. sample-rate: (uint) only track one out of every N created objects;
+ *    "1" by default, meaning every object is tracked. Sampling makes the
+ *    tracer cheap enough to leave enabled in production: a steady leak
+ *    still shows up in the tracked subset, only the reported object count
+ *    is scaled down accordingly (Since: 1.22)
  *
  * Examples:
  * ```
@@ -229,6 +234,12 @@ set_params_from_structure (GstLeaksTracer * self, GstStructure * params)
 
   gst_structure_get_boolean (params, "check-refs", &self->check_refs);
   gst_structure_get_boolean (params, "log-leaks-on-deinit", &self->log_leaks);
+
+  gst_structure_get_uint (params, "sample-rate", &self->sample_rate);
+  if (self->sample_rate == 0) {
+    GST_WARNING_OBJECT (self, "sample-rate must be at least 1");
+    self->sample_rate = 1;
+  }
 }
 
 static void
@@ -387,6 +398,14 @@ handle_object_created (GstLeaksTracer * self, gpointer object, GType type,
   if (!should_handle_object_type (self, type))
     return;
 
+  /* In sampling mode only every sample-rate'th creation is tracked. Untracked
+   * objects never get a weak ref, so the destroy and ref/unref paths stay
+   * free for them as well. */
+  if (self->sample_rate > 1 &&
+      ((guint) g_atomic_int_add (&self->sample_counter, 1)) %
+      self->sample_rate != 0)
+    return;
+
   infos = g_malloc0 (sizeof (ObjectRefingInfos));
   if (gobject)
     g_object_weak_ref ((GObject *) object, object_weak_cb, self);
@@ -502,6 +521,7 @@ static void
 gst_leaks_tracer_init (GstLeaksTracer * self)
 {
   self->log_leaks = DEFAULT_LOG_LEAKS;
+  self->sample_rate = 1;
   self->objects = g_hash_table_new_full (NULL, NULL, NULL,
       (GDestroyNotify) object_refing_infos_free);
 
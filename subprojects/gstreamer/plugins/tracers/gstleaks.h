@@ -70,6 +70,9 @@ struct _GstLeaksTracer {
 
   gboolean check_refs;
   gboolean log_leaks;
+  /* only track one out of sample-rate created objects (1 = track all) */
+  guint sample_rate;
+  gint sample_counter;
 
   GstStackTraceFlags trace_flags;
 };
@@ -129,12 +129,17 @@ get_element_stats (GstStatsTracer * self, GstElement * element)
     return &no_elem_stats;
   }
 
-  G_LOCK (_elem_stats);
+  /* the qdata read is thread-safe by itself, the lock only guards against
+   * two threads creating the stats for the same element; don't make every
+   * hook invocation pay for it */
   if (!(stats = g_object_get_qdata ((GObject *) element, data_quark))) {
-    stats = create_element_stats (self, element);
-    is_new = TRUE;
+    G_LOCK (_elem_stats);
+    if (!(stats = g_object_get_qdata ((GObject *) element, data_quark))) {
+      stats = create_element_stats (self, element);
+      is_new = TRUE;
+    }
+    G_UNLOCK (_elem_stats);
   }
-  G_UNLOCK (_elem_stats);
   if (G_UNLIKELY (stats->parent_ix == G_MAXUINT)) {
     GstElement *parent = GST_ELEMENT_PARENT (element);
     if (parent) {
@@ -220,14 +225,17 @@ get_pad_stats (GstStatsTracer * self, GstPad * pad)
     return &no_pad_stats;
   }
 
-  G_LOCK (_pad_stats);
+  /* see get_element_stats() for the locking rationale */
   if (!(stats = g_object_get_qdata ((GObject *) pad, data_quark))) {
-    stats = fill_pad_stats (self, pad);
-    g_object_set_qdata_full ((GObject *) pad, data_quark, stats,
-        free_pad_stats);
-    is_new = TRUE;
+    G_LOCK (_pad_stats);
+    if (!(stats = g_object_get_qdata ((GObject *) pad, data_quark))) {
+      stats = fill_pad_stats (self, pad);
+      g_object_set_qdata_full ((GObject *) pad, data_quark, stats,
+          free_pad_stats);
+      is_new = TRUE;
+    }
+    G_UNLOCK (_pad_stats);
   }
-  G_UNLOCK (_pad_stats);
   if (G_UNLIKELY (stats->parent_ix == G_MAXUINT)) {
     GstElement *elem = get_real_pad_parent (pad);
     if (elem) {
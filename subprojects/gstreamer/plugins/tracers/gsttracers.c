@@ -25,6 +25,7 @@
 
 #include <gst/gst.h>
 #include "gstlatency.h"
+#include "gstlatencyhist.h"
 #include "gstlog.h"
 #include "gstrusage.h"
 #include "gststats.h"
@@ -36,6 +37,9 @@ plugin_init (GstPlugin * plugin)
 {
   if (!gst_tracer_register (plugin, "latency", gst_latency_tracer_get_type ()))
     return FALSE;
+  if (!gst_tracer_register (plugin, "latencyhist",
+          gst_latency_hist_tracer_get_type ()))
+    return FALSE;
 #ifndef GST_DISABLE_GST_DEBUG
   if (!gst_tracer_register (plugin, "log", gst_log_tracer_get_type ()))
     return FALSE;
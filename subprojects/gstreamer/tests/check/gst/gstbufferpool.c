@@ -105,6 +105,47 @@ GST_START_TEST (test_buffer_is_recycled)
 GST_END_TEST;
 
 
+GST_START_TEST (test_buffer_batch_acquire_release)
+{
+  GstBufferPool *pool = create_pool (10, 0, 4);
+  GstBuffer *bufs[4] = { NULL, };
+  GstBufferPoolAcquireParams params = { 0, };
+  GstFlowReturn ret;
+  gint i;
+
+  gst_buffer_pool_set_active (pool, TRUE);
+
+  ret = gst_buffer_pool_acquire_buffers (pool, bufs, 4, NULL);
+  fail_unless (ret == GST_FLOW_OK);
+  for (i = 0; i < 4; i++)
+    fail_if (bufs[i] == NULL, "batch acquire returned NULL buffer");
+
+  /* pool is exhausted now, a non-blocking batch must fail and leave the
+   * array cleared */
+  params.flags = GST_BUFFER_POOL_ACQUIRE_FLAG_DONTWAIT;
+  {
+    GstBuffer *more[2] = { NULL, };
+
+    ret = gst_buffer_pool_acquire_buffers (pool, more, 2, &params);
+    fail_unless (ret == GST_FLOW_EOS);
+    fail_unless (more[0] == NULL && more[1] == NULL);
+  }
+
+  gst_buffer_pool_release_buffers (pool, bufs, 4);
+
+  /* all buffers are back, acquiring works again */
+  ret = gst_buffer_pool_acquire_buffers (pool, bufs, 4, &params);
+  fail_unless (ret == GST_FLOW_OK);
+  for (i = 0; i < 4; i++)
+    gst_buffer_unref (bufs[i]);
+
+  gst_buffer_pool_set_active (pool, FALSE);
+  gst_object_unref (pool);
+}
+
+GST_END_TEST;
+
+
 GST_START_TEST (test_buffer_out_of_order_reuse)
 {
   GstBufferPool *pool = create_pool (10, 0, 0);
@@ -347,6 +388,7 @@ gst_buffer_pool_suite (void)
   suite_add_tcase (s, tc_chain);
   tcase_add_test (tc_chain, test_new_buffer_from_empty_pool);
   tcase_add_test (tc_chain, test_buffer_is_recycled);
+  tcase_add_test (tc_chain, test_buffer_batch_acquire_release);
   tcase_add_test (tc_chain, test_buffer_out_of_order_reuse);
   tcase_add_test (tc_chain, test_pool_config_buffer_size);
   tcase_add_test (tc_chain, test_inactive_pool_returns_flushing);
@@ -535,6 +535,50 @@ GST_START_TEST (test_meta_foreach_remove_several)
 
 GST_END_TEST;
 
+/* more metas than the inline slots in GstBufferImpl can hold, so that both
+ * the inline and the fallback allocation paths are exercised */
+GST_START_TEST (test_meta_many)
+{
+  GstBuffer *buffer;
+  GstMetaTest *metas[8];
+  gpointer state = NULL;
+  GstMeta *m;
+  guint i, count;
+
+  buffer = gst_buffer_new_and_alloc (4);
+  fail_if (buffer == NULL);
+
+  for (i = 0; i < G_N_ELEMENTS (metas); i++) {
+    metas[i] = GST_META_TEST_ADD (buffer);
+    fail_if (metas[i] == NULL);
+  }
+
+  fail_unless_equals_int (count_buffer_meta (buffer), G_N_ELEMENTS (metas));
+
+  /* remove every other meta so that inline slots get recycled */
+  for (i = 0; i < G_N_ELEMENTS (metas); i += 2)
+    fail_unless (gst_buffer_remove_meta (buffer, (GstMeta *) metas[i]));
+
+  count = 0;
+  while ((m = gst_buffer_iterate_meta (buffer, &state))) {
+    fail_unless (m == (GstMeta *) metas[count * 2 + 1]);
+    count++;
+  }
+  fail_unless_equals_int (count, G_N_ELEMENTS (metas) / 2);
+
+  /* and add some again, reusing the freed slots */
+  for (i = 0; i < 4; i++)
+    fail_if (GST_META_TEST_ADD (buffer) == NULL);
+
+  fail_unless_equals_int (count_buffer_meta (buffer),
+      G_N_ELEMENTS (metas) / 2 + 4);
+
+  /* clean up */
+  gst_buffer_unref (buffer);
+}
+
+GST_END_TEST;
+
 GST_START_TEST (test_meta_iterate)
 {
   GstBuffer *buffer;
@@ -812,6 +856,7 @@ gst_buffermeta_suite (void)
   tcase_add_test (tc_chain, test_meta_foreach_remove_tail_of_three);
   tcase_add_test (tc_chain, test_meta_foreach_remove_head_and_tail_of_three);
   tcase_add_test (tc_chain, test_meta_foreach_remove_several);
+  tcase_add_test (tc_chain, test_meta_many);
   tcase_add_test (tc_chain, test_meta_iterate);
   tcase_add_test (tc_chain, test_meta_seqnum);
   tcase_add_test (tc_chain, test_meta_custom);
@@ -1018,6 +1018,57 @@ GST_START_TEST (test_flagset)
 
 GST_END_TEST;
 
+GST_START_TEST (test_many_fields)
+{
+  GstStructure *s, *copy;
+  gchar *name;
+  gint val;
+  guint i;
+
+  /* structures with more than a handful of fields use an internal lookup
+   * index; exercise set/get/remove around that threshold */
+  s = gst_structure_new_empty ("test-struct");
+  for (i = 0; i < 32; i++) {
+    name = g_strdup_printf ("field-%u", i);
+    gst_structure_set (s, name, G_TYPE_INT, (gint) i, NULL);
+    g_free (name);
+  }
+  fail_unless_equals_int (gst_structure_n_fields (s), 32);
+
+  for (i = 0; i < 32; i++) {
+    name = g_strdup_printf ("field-%u", i);
+    fail_unless (gst_structure_get_int (s, name, &val));
+    fail_unless_equals_int (val, (gint) i);
+    g_free (name);
+  }
+  fail_if (gst_structure_has_field (s, "no-such-field"));
+
+  /* overwriting must not grow the structure */
+  gst_structure_set (s, "field-5", G_TYPE_INT, 55, NULL);
+  fail_unless_equals_int (gst_structure_n_fields (s), 32);
+  fail_unless (gst_structure_get_int (s, "field-5", &val));
+  fail_unless_equals_int (val, 55);
+
+  copy = gst_structure_copy (s);
+  fail_unless (gst_structure_is_equal (s, copy));
+  gst_structure_free (copy);
+
+  /* remove down across the index threshold */
+  for (i = 0; i < 28; i++) {
+    name = g_strdup_printf ("field-%u", i);
+    gst_structure_remove_field (s, name);
+    g_free (name);
+  }
+  fail_unless_equals_int (gst_structure_n_fields (s), 4);
+  fail_unless (gst_structure_get_int (s, "field-31", &val));
+  fail_unless_equals_int (val, 31);
+  fail_if (gst_structure_has_field (s, "field-5"));
+
+  gst_structure_free (s);
+}
+
+GST_END_TEST;
+
 static Suite *
 gst_structure_suite (void)
 {
@@ -1050,6 +1101,7 @@ gst_structure_suite (void)
   tcase_add_test (tc_chain, test_map_in_place);
   tcase_add_test (tc_chain, test_filter_and_map_in_place);
   tcase_add_test (tc_chain, test_flagset);
+  tcase_add_test (tc_chain, test_many_fields);
   return s;
 }
 
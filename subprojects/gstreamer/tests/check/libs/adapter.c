@@ -157,6 +157,56 @@ GST_START_TEST (test_peek3)
 
 GST_END_TEST;
 
+/* map the contiguous head of an adapter with 2 non-mergeable buffers
+ * pushed, without copying.
+ */
+GST_START_TEST (test_map_fast)
+{
+  GstAdapter *adapter;
+  GstBuffer *buffer;
+  const guint8 *data;
+  gsize size;
+
+  adapter = gst_adapter_new ();
+  fail_if (adapter == NULL);
+
+  /* empty adapter returns NULL and size 0 */
+  size = 42;
+  data = gst_adapter_map_fast (adapter, &size);
+  fail_if (data != NULL);
+  fail_if (size != 0);
+
+  buffer = gst_buffer_new_and_alloc (512);
+  gst_adapter_push (adapter, buffer);
+  buffer = gst_buffer_new_and_alloc (1024);
+  gst_adapter_push (adapter, buffer);
+
+  /* we should get the first buffer only */
+  data = gst_adapter_map_fast (adapter, &size);
+  fail_if (data == NULL);
+  fail_if (size != 512);
+  gst_adapter_unmap (adapter);
+
+  /* flushing into the first buffer shrinks the contiguous region */
+  gst_adapter_flush (adapter, 10);
+  data = gst_adapter_map_fast (adapter, &size);
+  fail_if (data == NULL);
+  fail_if (size != 502);
+  fail_if (size != gst_adapter_available_fast (adapter));
+  gst_adapter_unmap (adapter);
+
+  /* flushing past the first buffer exposes the second one */
+  gst_adapter_flush (adapter, 502);
+  data = gst_adapter_map_fast (adapter, &size);
+  fail_if (data == NULL);
+  fail_if (size != 1024);
+  gst_adapter_unmap (adapter);
+
+  g_object_unref (adapter);
+}
+
+GST_END_TEST;
+
 /* take data from an adapter with 1 buffer pushed.
  */
 GST_START_TEST (test_take1)
@@ -1458,6 +1508,7 @@ gst_adapter_suite (void)
   tcase_add_test (tc_chain, test_peek1);
   tcase_add_test (tc_chain, test_peek2);
   tcase_add_test (tc_chain, test_peek3);
+  tcase_add_test (tc_chain, test_map_fast);
   tcase_add_test (tc_chain, test_take1);
   tcase_add_test (tc_chain, test_take2);
   tcase_add_test (tc_chain, test_take3);
@@ -293,6 +293,44 @@ GST_START_TEST (test_get_all_data)
 
 GST_END_TEST;
 
+static GstBuffer *
+benchmark_prepare_buffer (GstHarness * h, gpointer data)
+{
+  return gst_buffer_new_allocate (NULL, 16, NULL);
+}
+
+GST_START_TEST (test_benchmark)
+{
+  GstHarness *h = gst_harness_new ("identity");
+  GstStructure *s;
+  guint64 total, mean, min, max, p50, p99;
+  guint iterations;
+
+  gst_harness_set_src_caps_str (h, "mycaps");
+  gst_harness_play (h);
+
+  s = gst_harness_benchmark (h, benchmark_prepare_buffer, NULL, 2, 10);
+  fail_unless (s != NULL);
+
+  fail_unless (gst_structure_get_uint (s, "iterations", &iterations));
+  fail_unless_equals_int (iterations, 10);
+  fail_unless (gst_structure_get_uint64 (s, "total-time", &total));
+  fail_unless (gst_structure_get_uint64 (s, "mean", &mean));
+  fail_unless (gst_structure_get_uint64 (s, "min", &min));
+  fail_unless (gst_structure_get_uint64 (s, "max", &max));
+  fail_unless (gst_structure_get_uint64 (s, "p50", &p50));
+  fail_unless (gst_structure_get_uint64 (s, "p99", &p99));
+  fail_unless (min <= p50);
+  fail_unless (p50 <= p99);
+  fail_unless (p99 <= max);
+  fail_unless (mean <= total);
+
+  gst_structure_free (s);
+  gst_harness_teardown (h);
+}
+
+GST_END_TEST;
+
 static Suite *
 gst_harness_suite (void)
 {
@@ -314,6 +352,8 @@ gst_harness_suite (void)
 
   tcase_add_test (tc_chain, test_get_all_data);
 
+  tcase_add_test (tc_chain, test_benchmark);
+
   return s;
 }
 
@@ -0,0 +1,165 @@
+/* GStreamer
+ * Copyright (C) 2022 GStreamer developers
+ *
+ * gst-bench.c: benchmark an element or pipeline fragment
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifdef HAVE_CONFIG_H
+#  include "config.h"
+#endif
+
+#include <stdlib.h>
+#include <locale.h>
+
+#include <gst/check/gstharness.h>
+
+#include "tools.h"
+
+static guint buffer_size = 4096;
+static guint iterations = 10000;
+static guint warmup = 100;
+static gchar *caps_str = NULL;
+static gboolean print_json = FALSE;
+
+static GstBuffer *
+prepare_buffer (GstHarness * h, gpointer data)
+{
+  return gst_buffer_new_allocate (NULL, buffer_size, NULL);
+}
+
+static void
+print_results (const GstStructure * s)
+{
+  if (print_json) {
+    /* machine-readable output for CI regression gating */
+    g_print ("{ \"iterations\": %u, \"buffer-size\": %u, "
+        "\"total-time-ns\": %" G_GUINT64_FORMAT ", "
+        "\"buffers-per-second\": %f, "
+        "\"mean-ns\": %" G_GUINT64_FORMAT ", "
+        "\"min-ns\": %" G_GUINT64_FORMAT ", "
+        "\"max-ns\": %" G_GUINT64_FORMAT ", "
+        "\"p50-ns\": %" G_GUINT64_FORMAT ", "
+        "\"p90-ns\": %" G_GUINT64_FORMAT ", "
+        "\"p99-ns\": %" G_GUINT64_FORMAT " }\n",
+        g_value_get_uint (gst_structure_get_value (s, "iterations")),
+        buffer_size,
+        g_value_get_uint64 (gst_structure_get_value (s, "total-time")),
+        g_value_get_double (gst_structure_get_value (s, "buffers-per-second")),
+        g_value_get_uint64 (gst_structure_get_value (s, "mean")),
+        g_value_get_uint64 (gst_structure_get_value (s, "min")),
+        g_value_get_uint64 (gst_structure_get_value (s, "max")),
+        g_value_get_uint64 (gst_structure_get_value (s, "p50")),
+        g_value_get_uint64 (gst_structure_get_value (s, "p90")),
+        g_value_get_uint64 (gst_structure_get_value (s, "p99")));
+  } else {
+    guint64 total, mean, min, max, p50, p90, p99;
+    gdouble bps;
+    guint iters;
+
+    gst_structure_get_uint (s, "iterations", &iters);
+    gst_structure_get_uint64 (s, "total-time", &total);
+    gst_structure_get_double (s, "buffers-per-second", &bps);
+    gst_structure_get_uint64 (s, "mean", &mean);
+    gst_structure_get_uint64 (s, "min", &min);
+    gst_structure_get_uint64 (s, "max", &max);
+    gst_structure_get_uint64 (s, "p50", &p50);
+    gst_structure_get_uint64 (s, "p90", &p90);
+    gst_structure_get_uint64 (s, "p99", &p99);
+
+    g_print ("pushed %u buffers of %u bytes in %" GST_TIME_FORMAT
+        " (%.0f buffers/sec)\n", iters, buffer_size, GST_TIME_ARGS (total),
+        bps);
+    g_print ("per buffer: mean %" G_GUINT64_FORMAT " ns, min %"
+        G_GUINT64_FORMAT " ns, max %" G_GUINT64_FORMAT " ns\n", mean, min,
+        max);
+    g_print ("percentiles: p50 %" G_GUINT64_FORMAT " ns, p90 %"
+        G_GUINT64_FORMAT " ns, p99 %" G_GUINT64_FORMAT " ns\n", p50, p90, p99);
+  }
+}
+
+int
+main (int argc, char *argv[])
+{
+  GstHarness *h;
+  GstStructure *results;
+  GError *err = NULL;
+  gchar **args = NULL;
+  GOptionContext *ctx;
+  GOptionEntry options[] = {
+    {"iterations", 'n', 0, G_OPTION_ARG_INT, &iterations,
+        N_("Number of timed buffers to push (default 10000)"), "COUNT"},
+    {"warmup", 'w', 0, G_OPTION_ARG_INT, &warmup,
+        N_("Number of untimed warmup buffers to push (default 100)"), "COUNT"},
+    {"size", 's', 0, G_OPTION_ARG_INT, &buffer_size,
+        N_("Size in bytes of the buffers to push (default 4096)"), "BYTES"},
+    {"caps", 'c', 0, G_OPTION_ARG_STRING, &caps_str,
+        N_("Caps to set on the harness source pad"), "CAPS"},
+    {"json", 'j', 0, G_OPTION_ARG_NONE, &print_json,
+        N_("Output the results as a single line of JSON"), NULL},
+    GST_TOOLS_GOPTION_VERSION,
+    {G_OPTION_REMAINING, 0, 0, G_OPTION_ARG_STRING_ARRAY, &args, NULL,
+        N_("PIPELINE-DESCRIPTION")},
+    {NULL}
+  };
+
+  setlocale (LC_ALL, "");
+
+  ctx = g_option_context_new ("PIPELINE-DESCRIPTION");
+  g_option_context_set_summary (ctx,
+      N_("Benchmark an element or pipeline fragment by pushing buffers "
+          "through it."));
+  g_option_context_add_main_entries (ctx, options, GETTEXT_PACKAGE);
+  g_option_context_add_group (ctx, gst_init_get_option_group ());
+  if (!g_option_context_parse (ctx, &argc, &argv, &err)) {
+    g_printerr ("Error initializing: %s\n", GST_STR_NULL (err->message));
+    g_clear_error (&err);
+    g_option_context_free (ctx);
+    return 1;
+  }
+  g_option_context_free (ctx);
+
+  gst_tools_print_version ();
+
+  if (args == NULL || args[0] == NULL || iterations == 0) {
+    g_printerr ("Please give a pipeline description to benchmark, "
+        "e.g. gst-bench-1.0 -c video/x-raw \"videoconvert\"\n");
+    return 1;
+  }
+
+  h = gst_harness_new_parse (args[0]);
+  if (h == NULL) {
+    g_printerr ("Could not create pipeline '%s'\n", args[0]);
+    return 1;
+  }
+
+  if (caps_str != NULL)
+    gst_harness_set_src_caps_str (h, caps_str);
+
+  gst_harness_play (h);
+
+  results = gst_harness_benchmark (h, prepare_buffer, NULL, warmup,
+      iterations);
+  print_results (results);
+
+  gst_structure_free (results);
+  gst_harness_teardown (h);
+  g_strfreev (args);
+  g_free (caps_str);
+
+  return 0;
+}